@@ -3,6 +3,7 @@
 #include <WiFi.h>
 #include <cstdio>
 #include <gob_datetime.hpp>
+#include <gob_zone_context.hpp>
 using namespace goblib::datetime;
 
 #ifndef TIMEZONE_LOCATION
@@ -46,9 +47,8 @@ void setup()
     WiFi.disconnect(true);
     WiFi.mode(WIFI_OFF);
 
-    auto p = goblib::datetime::locationToPOSIX("America/Los_Angeles"); // => "PST8PDT,M3.2.0,M11.1.0"
-    setenv("TZ", p ? p : "", 1);
-    tzset(); // Set timezone by POSIX tz string.
+    // Set timezone of this task without setenv("TZ") and tzset().
+    ZoneContext::setCurrent(ZoneContext::ofLocation("America/Los_Angeles")); // "PST8PDT,M3.2.0,M11.1.0"
 }
 
 const ZoneOffset zo = ZoneOffset::of(+9); // +09:00
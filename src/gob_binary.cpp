@@ -0,0 +1,179 @@
+/*!
+  @file gob_binary.cpp
+  @brief Fixed-width, endian-stable binary encoding of date-time classes.
+*/
+#include "gob_binary.hpp"
+
+namespace
+{
+inline void put16(uint8_t* p, const int16_t v)
+{
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(static_cast<uint16_t>(v) >> 8);
+}
+
+inline int16_t get16(const uint8_t* p)
+{
+    return static_cast<int16_t>(p[0] | (p[1] << 8));
+}
+
+inline void put32(uint8_t* p, const int32_t v)
+{
+    const uint32_t u = static_cast<uint32_t>(v);
+    p[0] = static_cast<uint8_t>(u);
+    p[1] = static_cast<uint8_t>(u >> 8);
+    p[2] = static_cast<uint8_t>(u >> 16);
+    p[3] = static_cast<uint8_t>(u >> 24);
+}
+
+inline int32_t get32(const uint8_t* p)
+{
+    return static_cast<int32_t>(p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24));
+}
+
+// Checks if the encoding of the sample is the same as the memory image.
+template<typename T> bool sameAsMemory(const T& sample)
+{
+    using goblib::datetime::BinaryCodec;
+    if(sizeof(T) != BinaryCodec<T>::SIZE) { return false; }
+    uint8_t buf[BinaryCodec<T>::SIZE];
+    BinaryCodec<T>::encode(sample, buf);
+    return std::memcmp(buf, &sample, sizeof(buf)) == 0;
+}
+
+// Decodes again the elements whose reserved byte of LocalTime (at offset) is not zero.
+template<typename T> void decodeNonzeroReserved(const uint8_t* in, const size_t n, T* out, const size_t offset)
+{
+    using goblib::datetime::BinaryCodec;
+    for(size_t i = 0; i < n; ++i, in += BinaryCodec<T>::SIZE)
+    {
+        if(in[offset]) { out[i] = BinaryCodec<T>::decode(in); }
+    }
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+// for GCC C++11,C++14
+#if !defined(__clang__) && defined(__GNUG__) && __cplusplus < 201703L
+constexpr size_t BinaryCodec<LocalDate>::SIZE;
+constexpr size_t BinaryCodec<LocalTime>::SIZE;
+constexpr size_t BinaryCodec<ZoneOffset>::SIZE;
+constexpr size_t BinaryCodec<LocalDateTime>::SIZE;
+constexpr size_t BinaryCodec<OffsetDateTime>::SIZE;
+#endif
+
+// ----------------------------------------------------------------------
+// LocalDate
+void BinaryCodec<LocalDate>::encode(const LocalDate& v, uint8_t* out)
+{
+    put16(out, v.year());
+    out[2] = static_cast<uint8_t>(v.month());
+    out[3] = static_cast<uint8_t>(v.day());
+}
+
+LocalDate BinaryCodec<LocalDate>::decode(const uint8_t* in)
+{
+    return LocalDate(get16(in), static_cast<int8_t>(in[2]), static_cast<int8_t>(in[3]));
+}
+
+bool BinaryCodec<LocalDate>::isNativeLayout()
+{
+    static const bool native = sameAsMemory(LocalDate(0x1234, 0x56, 0x78));
+    return native;
+}
+
+// ----------------------------------------------------------------------
+// LocalTime
+void BinaryCodec<LocalTime>::encode(const LocalTime& v, uint8_t* out)
+{
+    out[0] = static_cast<uint8_t>(v.hour());
+    out[1] = static_cast<uint8_t>(v.minute());
+    out[2] = static_cast<uint8_t>(v.second());
+    out[3] = 0;
+}
+
+LocalTime BinaryCodec<LocalTime>::decode(const uint8_t* in)
+{
+    return LocalTime(static_cast<int8_t>(in[0]), static_cast<int8_t>(in[1]), static_cast<int8_t>(in[2]));
+}
+
+void BinaryCodec<LocalTime>::clearReserved(const uint8_t* in, const size_t n, LocalTime* out)
+{
+    decodeNonzeroReserved(in, n, out, 3);
+}
+
+bool BinaryCodec<LocalTime>::isNativeLayout()
+{
+    static const bool native = sameAsMemory(LocalTime(0x12, 0x34, 0x56));
+    return native;
+}
+
+// ----------------------------------------------------------------------
+// ZoneOffset
+void BinaryCodec<ZoneOffset>::encode(const ZoneOffset& v, uint8_t* out)
+{
+    put32(out, v.totalSeconds());
+}
+
+ZoneOffset BinaryCodec<ZoneOffset>::decode(const uint8_t* in)
+{
+    return ZoneOffset(get32(in));
+}
+
+bool BinaryCodec<ZoneOffset>::isNativeLayout()
+{
+    static const bool native = sameAsMemory(ZoneOffset(0x12345678));
+    return native;
+}
+
+// ----------------------------------------------------------------------
+// LocalDateTime
+void BinaryCodec<LocalDateTime>::encode(const LocalDateTime& v, uint8_t* out)
+{
+    BinaryCodec<LocalDate>::encode(v.toLocalDate(), out);
+    BinaryCodec<LocalTime>::encode(v.toLocalTime(), out + BinaryCodec<LocalDate>::SIZE);
+}
+
+LocalDateTime BinaryCodec<LocalDateTime>::decode(const uint8_t* in)
+{
+    return LocalDateTime(BinaryCodec<LocalDate>::decode(in), BinaryCodec<LocalTime>::decode(in + BinaryCodec<LocalDate>::SIZE));
+}
+
+void BinaryCodec<LocalDateTime>::clearReserved(const uint8_t* in, const size_t n, LocalDateTime* out)
+{
+    decodeNonzeroReserved(in, n, out, BinaryCodec<LocalDate>::SIZE + 3);
+}
+
+bool BinaryCodec<LocalDateTime>::isNativeLayout()
+{
+    static const bool native = sameAsMemory(LocalDateTime(0x1234, 0x56, 0x78, 0x12, 0x34, 0x56));
+    return native;
+}
+
+// ----------------------------------------------------------------------
+// OffsetDateTime
+void BinaryCodec<OffsetDateTime>::encode(const OffsetDateTime& v, uint8_t* out)
+{
+    BinaryCodec<LocalDateTime>::encode(v.toLocalDateTime(), out);
+    BinaryCodec<ZoneOffset>::encode(v.offset(), out + BinaryCodec<LocalDateTime>::SIZE);
+}
+
+OffsetDateTime BinaryCodec<OffsetDateTime>::decode(const uint8_t* in)
+{
+    return OffsetDateTime(BinaryCodec<LocalDateTime>::decode(in), BinaryCodec<ZoneOffset>::decode(in + BinaryCodec<LocalDateTime>::SIZE));
+}
+
+void BinaryCodec<OffsetDateTime>::clearReserved(const uint8_t* in, const size_t n, OffsetDateTime* out)
+{
+    decodeNonzeroReserved(in, n, out, BinaryCodec<LocalDate>::SIZE + 3);
+}
+
+bool BinaryCodec<OffsetDateTime>::isNativeLayout()
+{
+    static const bool native = sameAsMemory(OffsetDateTime(LocalDateTime(0x1234, 0x56, 0x78, 0x12, 0x34, 0x56), ZoneOffset(0x12345678)));
+    return native;
+}
+//
+}}
@@ -0,0 +1,183 @@
+/*!
+  @file gob_binary.hpp
+  @brief Fixed-width, endian-stable binary encoding of date-time classes.
+
+  Format (all integers are little-endian, two's complement)
+  | Class          | Bytes | Layout |
+  |----------------|-------|--------|
+  | LocalDate      |  4    | [0-1] year (int16) [2] month (int8) [3] day (int8) |
+  | LocalTime      |  4    | [0] hour (int8) [1] minute (int8) [2] second (int8) [3] 0 (reserved) |
+  | ZoneOffset     |  4    | [0-3] total seconds (int32) |
+  | LocalDateTime  |  8    | [0-3] LocalDate [4-7] LocalTime |
+  | OffsetDateTime | 12    | [0-7] LocalDateTime [8-11] ZoneOffset |
+
+  @code
+  std::vector<OffsetDateTime> v = ...;
+  std::vector<uint8_t> buf(v.size() * BinaryCodec<OffsetDateTime>::SIZE);
+  encodeArray(v.data(), v.size(), buf.data());
+  // Receiver
+  BinaryView<OffsetDateTime> view(buf.data(), buf.size() / BinaryCodec<OffsetDateTime>::SIZE);
+  for(auto odt : view) { ... }
+  @endcode
+*/
+#ifndef GOBLIB_BINARY_HPP
+#define GOBLIB_BINARY_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @brief Encoder and decoder of the class.
+  @tparam T LocalDate, LocalTime, ZoneOffset, LocalDateTime or OffsetDateTime
+  @note SIZE is the number of bytes. encode() writes SIZE bytes and decode() reads SIZE bytes.
+  @note decode() does not validate the value. Use valid() of the result if needed.
+ */
+template<typename T> struct BinaryCodec;
+
+template<> struct BinaryCodec<LocalDate>
+{
+    static constexpr size_t SIZE = 4;
+    static void encode(const LocalDate& v, uint8_t* out);
+    static LocalDate decode(const uint8_t* in);
+    static bool isNativeLayout(); //!< @brief Is the encoding the same as the memory layout on this platform?
+    static void clearReserved(const uint8_t*, const size_t, LocalDate*) {} //!< @brief No reserved byte.
+};
+
+template<> struct BinaryCodec<LocalTime>
+{
+    static constexpr size_t SIZE = 4;
+    static void encode(const LocalTime& v, uint8_t* out);
+    static LocalTime decode(const uint8_t* in);
+    static bool isNativeLayout(); //!< @brief Is the encoding the same as the memory layout on this platform?
+    static void clearReserved(const uint8_t* in, const size_t n, LocalTime* out); //!< @brief Decodes again the elements whose reserved byte is not zero, after the native copy.
+};
+
+template<> struct BinaryCodec<ZoneOffset>
+{
+    static constexpr size_t SIZE = 4;
+    static void encode(const ZoneOffset& v, uint8_t* out);
+    static ZoneOffset decode(const uint8_t* in);
+    static bool isNativeLayout(); //!< @brief Is the encoding the same as the memory layout on this platform?
+    static void clearReserved(const uint8_t*, const size_t, ZoneOffset*) {} //!< @brief No reserved byte.
+};
+
+template<> struct BinaryCodec<LocalDateTime>
+{
+    static constexpr size_t SIZE = 8;
+    static void encode(const LocalDateTime& v, uint8_t* out);
+    static LocalDateTime decode(const uint8_t* in);
+    static bool isNativeLayout(); //!< @brief Is the encoding the same as the memory layout on this platform?
+    static void clearReserved(const uint8_t* in, const size_t n, LocalDateTime* out); //!< @brief Decodes again the elements whose reserved byte is not zero, after the native copy.
+};
+
+template<> struct BinaryCodec<OffsetDateTime>
+{
+    static constexpr size_t SIZE = 12;
+    static void encode(const OffsetDateTime& v, uint8_t* out);
+    static OffsetDateTime decode(const uint8_t* in);
+    static bool isNativeLayout(); //!< @brief Is the encoding the same as the memory layout on this platform?
+    static void clearReserved(const uint8_t* in, const size_t n, OffsetDateTime* out); //!< @brief Decodes again the elements whose reserved byte is not zero, after the native copy.
+};
+
+/*!
+  @brief Encodes contiguous array.
+  @param src Source array
+  @param n Number of elements
+  @param[out] out Buffer that has n * BinaryCodec<T>::SIZE bytes
+  @note Copied by memcpy if the encoding is the same as the memory layout. (e.g. little-endian platforms)
+ */
+template<typename T> void encodeArray(const T* src, const size_t n, uint8_t* out)
+{
+    if(BinaryCodec<T>::isNativeLayout()) { std::memcpy(out, src, n * BinaryCodec<T>::SIZE); return; }
+    for(size_t i = 0; i < n; ++i) { BinaryCodec<T>::encode(src[i], out + i * BinaryCodec<T>::SIZE); }
+}
+
+/*!
+  @brief Decodes contiguous array.
+  @param in Buffer that has n * BinaryCodec<T>::SIZE bytes
+  @param n Number of elements
+  @param[out] out Destination array
+  @note Copied by memcpy if the encoding is the same as the memory layout. (e.g. little-endian platforms) Nonzero reserved bytes are not copied into the padding.
+ */
+template<typename T> void decodeArray(const uint8_t* in, const size_t n, T* out)
+{
+    if(BinaryCodec<T>::isNativeLayout())
+    {
+        std::memcpy(static_cast<void*>(out), in, n * BinaryCodec<T>::SIZE);
+        BinaryCodec<T>::clearReserved(in, n, out);
+        return;
+    }
+    for(size_t i = 0; i < n; ++i) { out[i] = BinaryCodec<T>::decode(in + i * BinaryCodec<T>::SIZE); }
+}
+
+/*!
+  @class BinaryView
+  @brief Read-only view over an encoded buffer, without copying the buffer.
+  @note Each element is decoded on access. The buffer must outlive the view.
+ */
+template<typename T> class BinaryView
+{
+  public:
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = T;
+
+        const_iterator() {}
+        explicit const_iterator(const uint8_t* p) : _p(p) {}
+
+        T operator*() const { return BinaryCodec<T>::decode(_p); }
+        T operator[](const difference_type n) const { return BinaryCodec<T>::decode(_p + n * (difference_type)BinaryCodec<T>::SIZE); }
+        const_iterator& operator++() { _p += BinaryCodec<T>::SIZE; return *this; }
+        const_iterator  operator++(int) { auto t = *this; ++*this; return t; }
+        const_iterator& operator--() { _p -= BinaryCodec<T>::SIZE; return *this; }
+        const_iterator  operator--(int) { auto t = *this; --*this; return t; }
+        const_iterator& operator+=(const difference_type n) { _p += n * (difference_type)BinaryCodec<T>::SIZE; return *this; }
+        const_iterator& operator-=(const difference_type n) { _p -= n * (difference_type)BinaryCodec<T>::SIZE; return *this; }
+        friend const_iterator operator+(const_iterator a, const difference_type n) { return a += n; }
+        friend const_iterator operator+(const difference_type n, const_iterator a) { return a += n; }
+        friend const_iterator operator-(const_iterator a, const difference_type n) { return a -= n; }
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b) { return (a._p - b._p) / (difference_type)BinaryCodec<T>::SIZE; }
+        friend bool operator==(const const_iterator& a, const const_iterator& b) { return a._p == b._p; }
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a._p != b._p; }
+        friend bool operator< (const const_iterator& a, const const_iterator& b) { return a._p <  b._p; }
+        friend bool operator> (const const_iterator& a, const const_iterator& b) { return a._p >  b._p; }
+        friend bool operator<=(const const_iterator& a, const const_iterator& b) { return a._p <= b._p; }
+        friend bool operator>=(const const_iterator& a, const const_iterator& b) { return a._p >= b._p; }
+
+      private:
+        const uint8_t* _p{};
+    };
+    using iterator = const_iterator;
+
+    constexpr BinaryView() {}
+    /*!
+      @param buf Encoded buffer
+      @param n Number of elements
+     */
+    constexpr BinaryView(const uint8_t* buf, const size_t n) : _buf(buf), _size(n) {}
+
+    constexpr size_t size() const { return _size; } //!< @brief Gets the number of elements.
+    constexpr bool empty() const { return _size == 0; } //!< @brief Is empty?
+    constexpr const uint8_t* data() const { return _buf; } //!< @brief Gets the buffer.
+    T operator[](const size_t i) const { return BinaryCodec<T>::decode(_buf + i * BinaryCodec<T>::SIZE); } //!< @brief Gets the element.
+
+    const_iterator begin() const { return const_iterator(_buf); }
+    const_iterator end() const { return const_iterator(_buf + _size * BinaryCodec<T>::SIZE); }
+
+  private:
+    const uint8_t* _buf{};
+    size_t _size{};
+};
+
+//
+}}
+#endif
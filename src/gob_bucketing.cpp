@@ -0,0 +1,92 @@
+/*!
+  @file gob_bucketing.cpp
+  @brief Truncation kernels over epoch seconds for time-series aggregation.
+*/
+#include "gob_bucketing.hpp"
+#include "gob_datetime_internal.hpp"
+
+namespace
+{
+using goblib::datetime::ChronoUnit;
+using goblib::datetime::LocalDate;
+using goblib::datetime::detail::SEC_PER_DAY;
+using goblib::datetime::detail::floorDiv;
+
+constexpr int64_t MONDAY_SHIFT = 3 * SEC_PER_DAY; // 1970-01-01 is Thursday.
+
+// Shift and constant width are template parameters so that the divisions become multiplications.
+template<int64_t Width, int64_t Shift> void truncateFixed(time_t* out, const time_t* in, const size_t n, const int64_t offset)
+{
+    for(size_t i = 0; i < n; ++i)
+    {
+        const int64_t x = static_cast<int64_t>(in[i]) + offset + Shift;
+        int64_t r = x % Width;
+        r += (r < 0) ? Width : 0;
+        out[i] = static_cast<time_t>(in[i] - r);
+    }
+}
+
+// Local seconds of start of the month or year, and start of the next one.
+inline void calendarBucket(const int64_t local, const ChronoUnit unit, int64_t& lo, int64_t& hi)
+{
+    const LocalDate ld = LocalDate::ofEpochDay(static_cast<int32_t>(floorDiv(local, SEC_PER_DAY)));
+    const LocalDate first = (unit == ChronoUnit::Years) ? LocalDate(ld.year(), 1, 1) : LocalDate(ld.year(), ld.month(), 1);
+    const LocalDate next = (unit == ChronoUnit::Years || ld.month() == 12) ? LocalDate(ld.year() + 1, 1, 1) : LocalDate(ld.year(), ld.month() + 1, 1);
+    lo = first.toEpochDay() * SEC_PER_DAY;
+    hi = next.toEpochDay() * SEC_PER_DAY;
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+int32_t fixedUnitSeconds(const ChronoUnit unit)
+{
+    switch(unit)
+    {
+    case ChronoUnit::Seconds:  return 1;
+    case ChronoUnit::Minutes:  return 60;
+    case ChronoUnit::Hours:    return 60 * 60;
+    case ChronoUnit::HalfDays: return 12 * 60 * 60;
+    case ChronoUnit::Days:     return SEC_PER_DAY;
+    case ChronoUnit::Weeks:    return 7 * SEC_PER_DAY;
+    default: break;
+    }
+    return 0;
+}
+
+time_t truncateEpochSecond(const time_t epoch, const ChronoUnit unit, const ZoneOffset& zo)
+{
+    time_t out{};
+    truncateEpochSeconds(&out, &epoch, 1, unit, zo);
+    return out;
+}
+
+void truncateEpochSeconds(time_t* out, const time_t* epochs, const size_t n, const ChronoUnit unit, const ZoneOffset& zo)
+{
+    const int64_t offset = zo.totalSeconds();
+    switch(unit)
+    {
+    case ChronoUnit::Seconds:
+        if(out != epochs) { for(size_t i = 0; i < n; ++i) { out[i] = epochs[i]; } }
+        return;
+    case ChronoUnit::Minutes:  truncateFixed<60, 0>(out, epochs, n, offset); return;
+    case ChronoUnit::Hours:    truncateFixed<60 * 60, 0>(out, epochs, n, offset); return;
+    case ChronoUnit::HalfDays: truncateFixed<12 * 60 * 60, 0>(out, epochs, n, offset); return;
+    case ChronoUnit::Days:     truncateFixed<SEC_PER_DAY, 0>(out, epochs, n, offset); return;
+    case ChronoUnit::Weeks:    truncateFixed<7 * SEC_PER_DAY, MONDAY_SHIFT>(out, epochs, n, offset); return;
+    default: break;
+    }
+
+    // Months and years. [lo, hi) is the current bucket in local seconds.
+    int64_t lo{1}, hi{0};
+    for(size_t i = 0; i < n; ++i)
+    {
+        const int64_t local = static_cast<int64_t>(epochs[i]) + offset;
+        if(local < lo || local >= hi) { calendarBucket(local, unit, lo, hi); }
+        out[i] = static_cast<time_t>(lo - offset);
+    }
+}
+
+//
+}}
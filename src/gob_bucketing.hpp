@@ -0,0 +1,47 @@
+/*!
+  @file gob_bucketing.hpp
+  @brief Truncation kernels over epoch seconds for time-series aggregation.
+
+  @code
+  std::vector<time_t> epochs = ...;
+  std::vector<time_t> keys(epochs.size());
+  // Start of the local day (+09:00) of each epoch.
+  truncateEpochSeconds(keys.data(), epochs.data(), epochs.size(), ChronoUnit::Days, ZoneOffset::of(9));
+  @endcode
+*/
+#ifndef GOBLIB_BUCKETING_HPP
+#define GOBLIB_BUCKETING_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @brief Gets the length of the unit in seconds.
+  @return 0 if the length varies. (ChronoUnit::Months, ChronoUnit::Years)
+ */
+int32_t fixedUnitSeconds(const ChronoUnit unit);
+
+/*!
+  @brief Truncates the epoch to the start of the unit in the offset.
+  @return Same as LocalDateTime::ofEpochSecond(epoch, zo).truncatedTo(unit).toEpochSecond(zo), computed by integer arithmetic only.
+  @note ChronoUnit::Weeks starts on Monday.
+ */
+time_t truncateEpochSecond(const time_t epoch, const ChronoUnit unit, const ZoneOffset& zo = ZoneOffset::UTC);
+
+/*!
+  @brief Truncates the epochs to the start of the unit in the offset. (Bulk version of truncateEpochSecond)
+  @param[out] out Truncated epochs, the bucket keys. It may be the same as epochs.
+  @param epochs Epochs
+  @param n Number of the epochs
+  @param unit Unit to truncate
+  @param zo Offset
+  @note The loop of fixed length units is branch-free with a constant divisor, so that the compiler can vectorize it.
+  @note Months and years reuse the previous bucket while the epochs stay in it, which is fast for sorted input.
+ */
+void truncateEpochSeconds(time_t* out, const time_t* epochs, const size_t n, const ChronoUnit unit, const ZoneOffset& zo = ZoneOffset::UTC);
+
+//
+}}
+#endif
@@ -0,0 +1,203 @@
+/*!
+  @file gob_business_calendar.cpp
+  @brief Business-day calendar with weekends and holidays.
+*/
+#include "gob_business_calendar.hpp"
+#include "gob_datetime_internal.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+using goblib::datetime::LocalDate;
+using goblib::datetime::detail::ctz64;
+using goblib::datetime::detail::popcount64;
+
+// Mask of word i for the bit range [from, to)
+inline uint64_t rangeMask(const int i, const int from, const int to)
+{
+    const int lo = from - (i << 6), hi = to - (i << 6);
+    const uint64_t l = (lo <= 0) ? ~0ULL : (lo >= 64) ? 0 : (~0ULL << lo);
+    const uint64_t h = (hi >= 64) ? ~0ULL : (hi <= 0) ? 0 : ((1ULL << hi) - 1);
+    return l & h;
+}
+
+// Counts set bits in [from, to)
+int32_t countRange(const uint64_t* bits, const int from, const int to)
+{
+    if(from >= to) { return 0; }
+    int32_t c{};
+    for(int i = from >> 6; i <= ((to - 1) >> 6); ++i) { c += popcount64(bits[i] & rangeMask(i, from, to)); }
+    return c;
+}
+
+// Gets the k'th (1 origin) set bit position from the position. (The bit must exist)
+int select(const uint64_t* bits, const int from, int32_t k)
+{
+    for(int i = from >> 6; ; ++i)
+    {
+        uint64_t w = bits[i] & rangeMask(i, from, 384);
+        int pc = popcount64(w);
+        if(k > pc) { k -= pc; continue; }
+        while(--k) { w &= w - 1; }
+        return (i << 6) + ctz64(w);
+    }
+}
+
+inline int16_t lengthOfYear(const int16_t year)
+{
+    return LocalDate(year, 1, 1).lengthOfYear();
+}
+
+inline LocalDate checked(const LocalDate& ld)
+{
+    return (ld.valid() && !(LocalDate::MAX < ld)) ? ld : LocalDate(0, 0, 0);
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+// for GCC C++11,C++14
+#if !defined(__clang__) && defined(__GNUG__) && __cplusplus < 201703L
+constexpr uint8_t BusinessCalendar::SATURDAY_AND_SUNDAY;
+#endif
+
+BusinessCalendar::BusinessCalendar(const uint8_t weekends) : _weekends(weekends & 0x7F)
+{
+    for(int leap = 0; leap < 2; ++leap)
+    {
+        for(int dow = 0; dow < 7; ++dow)
+        {
+            auto& bits = _patterns[leap][dow];
+            for(int i = 0; i < 365 + leap; ++i)
+            {
+                if(!((_weekends >> ((dow + i) % 7)) & 1)) { bits[i >> 6] |= 1ULL << (i & 63); }
+            }
+            _patternCounts[leap][dow] = countRange(bits, 0, 365 + leap);
+        }
+    }
+}
+
+std::vector<BusinessCalendar::Year>::iterator BusinessCalendar::findYear(const int16_t year)
+{
+    auto it = std::lower_bound(_years.begin(), _years.end(), year, [](const Year& a, const int16_t y) { return a.year < y; });
+    return (it != _years.end() && it->year == year) ? it : _years.end();
+}
+
+std::vector<BusinessCalendar::Year>::const_iterator BusinessCalendar::findYear(const int16_t year) const
+{
+    auto it = std::lower_bound(_years.begin(), _years.end(), year, [](const Year& a, const int16_t y) { return a.year < y; });
+    return (it != _years.end() && it->year == year) ? it : _years.end();
+}
+
+const uint64_t* BusinessCalendar::bitsOf(const int16_t year) const
+{
+    auto it = findYear(year);
+    if(it != _years.end()) { return it->bits; }
+    const LocalDate jan1(year, 1, 1);
+    return _patterns[jan1.isLeapYear()][static_cast<uint8_t>(jan1.dayOfWeek())];
+}
+
+bool BusinessCalendar::addHoliday(const LocalDate& ld)
+{
+    if(!ld.valid()) { return false; }
+    auto it = std::lower_bound(_years.begin(), _years.end(), ld.year(), [](const Year& a, const int16_t y) { return a.year < y; });
+    if(it == _years.end() || it->year != ld.year())
+    {
+        Year y{};
+        y.year = ld.year();
+        std::memcpy(y.bits, bitsOf(ld.year()), sizeof(y.bits));
+        it = _years.insert(it, y);
+    }
+    const int doy = ld.dayOfYear();
+    it->bits[doy >> 6] &= ~(1ULL << (doy & 63));
+    return true;
+}
+
+void BusinessCalendar::removeHoliday(const LocalDate& ld)
+{
+    if(!ld.valid()) { return; }
+    auto it = findYear(ld.year());
+    if(it == _years.end()) { return; }
+
+    const LocalDate jan1(ld.year(), 1, 1);
+    const uint64_t* pattern = _patterns[jan1.isLeapYear()][static_cast<uint8_t>(jan1.dayOfWeek())];
+    const int doy = ld.dayOfYear();
+    it->bits[doy >> 6] |= pattern[doy >> 6] & (1ULL << (doy & 63));
+    // Year without holidays uses the pattern.
+    if(std::memcmp(it->bits, pattern, sizeof(it->bits)) == 0) { _years.erase(it); }
+}
+
+bool BusinessCalendar::isHoliday(const LocalDate& ld) const
+{
+    return ld.valid() && !isWeekend(ld.dayOfWeek()) && !isBusinessDay(ld);
+}
+
+bool BusinessCalendar::isBusinessDay(const LocalDate& ld) const
+{
+    if(!ld.valid()) { return false; }
+    const int doy = ld.dayOfYear();
+    return (bitsOf(ld.year())[doy >> 6] >> (doy & 63)) & 1;
+}
+
+int16_t BusinessCalendar::businessDaysInYear(const int16_t year) const
+{
+    auto it = findYear(year);
+    if(it != _years.end()) { return countRange(it->bits, 0, lengthOfYear(year)); }
+    const LocalDate jan1(year, 1, 1);
+    return _patternCounts[jan1.isLeapYear()][static_cast<uint8_t>(jan1.dayOfWeek())];
+}
+
+LocalDate BusinessCalendar::plusBusinessDays(const LocalDate& ld, const int32_t days) const
+{
+    if(!ld.valid()) { return LocalDate(0, 0, 0); }
+    if(days == 0) { return ld; }
+
+    int16_t y = ld.year();
+    if(days > 0)
+    {
+        int32_t k = days;
+        int from = ld.dayOfYear() + 1;
+        for(;;)
+        {
+            const int32_t c = from ? countRange(bitsOf(y), from, lengthOfYear(y)) : businessDaysInYear(y);
+            if(k <= c) { return checked(LocalDate::ofYearDay(y, select(bitsOf(y), from, k))); }
+            if(y >= LocalDate::MAX.year()) { break; }
+            k -= c;
+            ++y;
+            from = 0;
+        }
+    }
+    else
+    {
+        int32_t k = -days;
+        int to = ld.dayOfYear();
+        for(;;)
+        {
+            const int32_t c = countRange(bitsOf(y), 0, to);
+            if(k <= c) { return checked(LocalDate::ofYearDay(y, select(bitsOf(y), 0, c - k + 1))); }
+            if(y <= LocalDate::MIN.year()) { break; }
+            k -= c;
+            --y;
+            to = lengthOfYear(y);
+        }
+    }
+    return LocalDate(0, 0, 0);
+}
+
+int32_t BusinessCalendar::businessDaysBetween(const LocalDate& from, const LocalDate& to) const
+{
+    if(!from.valid() || !to.valid()) { return 0; }
+    if(to < from) { return -businessDaysBetween(to, from); }
+
+    if(from.year() == to.year())
+    {
+        return countRange(bitsOf(from.year()), from.dayOfYear(), to.dayOfYear());
+    }
+    int32_t c = countRange(bitsOf(from.year()), from.dayOfYear(), from.lengthOfYear());
+    for(int16_t y = from.year() + 1; y < to.year(); ++y) { c += businessDaysInYear(y); }
+    return c + countRange(bitsOf(to.year()), 0, to.dayOfYear());
+}
+//
+}}
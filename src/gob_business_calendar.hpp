@@ -0,0 +1,101 @@
+/*!
+  @file gob_business_calendar.hpp
+  @brief Business-day calendar with weekends and holidays.
+
+  @code
+  BusinessCalendar cal; // Saturday and Sunday are weekends
+  cal.addHoliday(LocalDate(2023, 1, 2));
+  auto d = cal.plusBusinessDays(LocalDate(2022, 12, 30), 1);                  // 2023-01-03
+  auto n = cal.businessDaysBetween(LocalDate(2023, 1, 1), LocalDate(2023, 2, 1)); // 21
+  @endcode
+*/
+#ifndef GOBLIB_BUSINESS_CALENDAR_HPP
+#define GOBLIB_BUSINESS_CALENDAR_HPP
+
+#include "gob_datetime.hpp"
+#include <vector>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class BusinessCalendar
+  @brief Calendar of business days, which are neither weekends nor holidays.
+  @note Business days of a year are held as a 366-bit bitmap indexed by LocalDate::dayOfYear().
+  Years without holidays share the bitmaps made from the weekend pattern, so only the years that have holidays consume memory.
+  @note Queries are computed by popcount and bit-scan per year, not per day.
+*/
+class BusinessCalendar
+{
+  public:
+    static constexpr uint8_t SATURDAY_AND_SUNDAY = (1U << static_cast<uint8_t>(DayOfWeek::Sat)) | (1U << static_cast<uint8_t>(DayOfWeek::Sun));
+
+    ///@name Constructors
+    ///@{
+    /*!
+      @param weekends Bits of weekend days. (bit position is DayOfWeek, Sunday is bit 0)
+     */
+    explicit BusinessCalendar(const uint8_t weekends = SATURDAY_AND_SUNDAY);
+    ///@}
+
+    /*! @brief Gets the bits of weekend days. */
+    inline uint8_t weekends() const { return _weekends; }
+    /*! @brief Checks if the day of week is a weekend. */
+    inline bool isWeekend(const DayOfWeek dow) const { return (_weekends >> static_cast<uint8_t>(dow)) & 1; }
+
+    ///@name Holidays
+    ///@{
+    /*!
+      @brief Adds a holiday.
+      @return True if succeeded. False if the date is invalid.
+     */
+    bool addHoliday(const LocalDate& ld);
+    /*!
+      @brief Removes a holiday.
+      @note Weekends can not be removed.
+     */
+    void removeHoliday(const LocalDate& ld);
+    /*! @brief Removes all holidays. */
+    void clearHolidays() { _years.clear(); }
+    /*! @brief Checks if the date is a holiday. (Not a weekend nor business day) */
+    bool isHoliday(const LocalDate& ld) const;
+    ///@}
+
+    /*! @brief Checks if the date is a business day. */
+    bool isBusinessDay(const LocalDate& ld) const;
+    /*!
+      @brief Gets the date after adding the number of business days.
+      @param ld Base date. (Need not be a business day)
+      @param days Business days to add. Negative value goes backward. 0 returns the date as is.
+      @return Invalid date if the result exceeds the supported range.
+      @note plusBusinessDays(ld, 1) returns the first business day after the date.
+     */
+    LocalDate plusBusinessDays(const LocalDate& ld, const int32_t days) const;
+    /*!
+      @brief Counts the business days in [from, to).
+      @return Negative value if to is before from.
+     */
+    int32_t businessDaysBetween(const LocalDate& from, const LocalDate& to) const;
+    /*! @brief Counts the business days in the year. */
+    int16_t businessDaysInYear(const int16_t year) const;
+
+  private:
+    static constexpr int WORDS = 6; // 384 bits >= 366 days
+    struct Year
+    {
+        int16_t year;
+        uint64_t bits[WORDS];
+    };
+
+    const uint64_t* bitsOf(const int16_t year) const;
+    std::vector<Year>::iterator findYear(const int16_t year);
+    std::vector<Year>::const_iterator findYear(const int16_t year) const;
+
+    uint8_t _weekends{};
+    uint64_t _patterns[2][7][WORDS]{}; // [leap][day of week of January 1st]
+    int16_t _patternCounts[2][7]{};
+    std::vector<Year> _years; // Years that have holidays. (sorted by year)
+};
+
+//
+}}
+#endif
@@ -0,0 +1,19 @@
+/*!
+  @file gob_chrono.cpp
+  @brief Interconversion with std::chrono, and arithmetic with std::chrono durations.
+*/
+#include "gob_chrono.hpp"
+
+namespace goblib { namespace datetime {
+
+LocalDateTime toLocalDateTime(const sys_seconds_t& tp, const ZoneOffset& zo)
+{
+    return LocalDateTime::ofEpochSecond(static_cast<time_t>(tp.time_since_epoch().count()), zo);
+}
+
+LocalDateTime operator+(const LocalDateTime& ldt, const std::chrono::seconds& d)
+{
+    return LocalDateTime::ofEpochSecond(ldt.toEpochSecond(ZoneOffset::UTC) + static_cast<time_t>(d.count()), ZoneOffset::UTC);
+}
+//
+}}
@@ -0,0 +1,153 @@
+/*!
+  @file gob_chrono.hpp
+  @brief Interconversion with std::chrono, and arithmetic with std::chrono durations.
+
+  @code
+  auto tp = toTimePoint(odt);                   // sys_seconds_t (system_clock)
+  auto odt2 = toOffsetDateTime(std::chrono::system_clock::now(), ZoneOffset::of(9));
+  auto ldt2 = ldt + std::chrono::minutes(90);
+  // C++20
+  constexpr std::chrono::sys_days sd = toSysDays(LocalDate(2022, 12, 13));
+  @endcode
+  @note Computed by integer arithmetic without libc functions. Sub-second parts are floored when converted to this library types.
+*/
+#ifndef GOBLIB_CHRONO_HPP
+#define GOBLIB_CHRONO_HPP
+
+#include "gob_datetime.hpp"
+#include <chrono>
+#include <type_traits>
+#if __cplusplus >= 202002L
+# include <version>
+#endif
+
+// year_month_day, sys_days, hh_mm_ss (libstdc++ 11 or later has them before defining __cpp_lib_chrono 201907L)
+#if __cplusplus >= 202002L && ((defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L) || (defined(_GLIBCXX_RELEASE) && _GLIBCXX_RELEASE >= 11))
+# define GOBLIB_DATETIME_HAS_CHRONO_CALENDAR 1
+#endif
+
+namespace goblib { namespace datetime {
+
+/*!
+  @typedef days_t
+  @brief Duration of days. (Same period as C++20 std::chrono::days)
+*/
+using days_t = std::chrono::duration<int32_t, std::ratio<86400>>;
+/*!
+  @typedef sys_seconds_t
+  @brief Time point of the system clock in seconds. (Same type as C++20 std::chrono::sys_seconds)
+*/
+using sys_seconds_t = std::chrono::time_point<std::chrono::system_clock, std::chrono::seconds>;
+
+namespace detail
+{
+// Floor of the duration to T. (std::chrono::floor is C++17)
+template<class T, class Rep, class Period> constexpr T floorDuration(const std::chrono::duration<Rep, Period>& d)
+{
+    return (std::chrono::duration_cast<T>(d) > d) ? std::chrono::duration_cast<T>(d) - T(1) : std::chrono::duration_cast<T>(d);
+}
+}
+
+///@name Interconversion with time point of the system clock
+///@{
+/*! @brief Converts to the time point of the system clock. */
+inline sys_seconds_t toTimePoint(const OffsetDateTime& odt) { return sys_seconds_t(std::chrono::seconds(odt.toEpochSecond())); }
+/*! @brief Converts to the local date-time in the offset. */
+LocalDateTime toLocalDateTime(const sys_seconds_t& tp, const ZoneOffset& zo = ZoneOffset::UTC);
+/*! @brief Converts to the local date-time in the offset. */
+template<class Duration> LocalDateTime toLocalDateTime(const std::chrono::time_point<std::chrono::system_clock, Duration>& tp, const ZoneOffset& zo = ZoneOffset::UTC)
+{
+    return toLocalDateTime(sys_seconds_t(detail::floorDuration<std::chrono::seconds>(tp.time_since_epoch())), zo);
+}
+/*! @brief Converts to the date-time with the offset. */
+template<class Duration> OffsetDateTime toOffsetDateTime(const std::chrono::time_point<std::chrono::system_clock, Duration>& tp, const ZoneOffset& zo = ZoneOffset::UTC)
+{
+    return OffsetDateTime(toLocalDateTime(tp, zo), zo);
+}
+///@}
+
+///@name Interconversion of LocalTime and the duration since midnight
+///@{
+/*! @brief Converts to the duration since midnight. */
+constexpr std::chrono::seconds toDuration(const LocalTime& lt) { return std::chrono::seconds(lt.toSecondOfDay()); }
+/*! @brief Converts the duration since midnight to LocalTime. (Wraps around midnight) */
+template<class Rep, class Period> LocalTime toLocalTime(const std::chrono::duration<Rep, Period>& d)
+{
+    return LocalTime(0, 0, 0) + static_cast<int32_t>(detail::floorDuration<std::chrono::seconds>(d).count() % 86400);
+}
+///@}
+
+///@name Arithmetic with std::chrono durations
+///@{
+/*! @brief Adds the duration. (Sub-second part is floored) */
+LocalDateTime operator+(const LocalDateTime& ldt, const std::chrono::seconds& d);
+template<class Rep, class Period> LocalDateTime operator+(const LocalDateTime& ldt, const std::chrono::duration<Rep, Period>& d)
+{
+    return ldt + detail::floorDuration<std::chrono::seconds>(d);
+}
+template<class Rep, class Period> LocalDateTime operator-(const LocalDateTime& ldt, const std::chrono::duration<Rep, Period>& d) { return ldt + (-d); }
+template<class Rep, class Period> OffsetDateTime operator+(const OffsetDateTime& odt, const std::chrono::duration<Rep, Period>& d)
+{
+    return OffsetDateTime(odt.toLocalDateTime() + d, odt.offset());
+}
+template<class Rep, class Period> OffsetDateTime operator-(const OffsetDateTime& odt, const std::chrono::duration<Rep, Period>& d) { return odt + (-d); }
+/*! @brief Adds the duration. (Wraps around midnight) */
+template<class Rep, class Period> LocalTime operator+(const LocalTime& lt, const std::chrono::duration<Rep, Period>& d)
+{
+    return lt + static_cast<int32_t>(detail::floorDuration<std::chrono::seconds>(d).count() % 86400);
+}
+template<class Rep, class Period> LocalTime operator-(const LocalTime& lt, const std::chrono::duration<Rep, Period>& d) { return lt + (-d); }
+/*! @brief Adds the days. The period of the duration must be a multiple of a day. */
+template<class Rep, class Period> LocalDate operator+(const LocalDate& ld, const std::chrono::duration<Rep, Period>& d)
+{
+    static_assert(std::ratio_divide<Period, std::ratio<86400>>::den == 1, "The period must be a multiple of a day");
+    return LocalDate::ofEpochDay(ld.toEpochDay() + static_cast<int32_t>(std::chrono::duration_cast<days_t>(d).count()));
+}
+template<class Rep, class Period> LocalDate operator-(const LocalDate& ld, const std::chrono::duration<Rep, Period>& d) { return ld + (-d); }
+
+/*! @brief Duration between the date-times. */
+inline std::chrono::seconds operator-(const LocalDateTime& a, const LocalDateTime& b)
+{
+    return std::chrono::seconds(a.toEpochSecond(ZoneOffset::UTC) - b.toEpochSecond(ZoneOffset::UTC));
+}
+/*! @brief Duration between the date-times. */
+inline std::chrono::seconds operator-(const OffsetDateTime& a, const OffsetDateTime& b) { return std::chrono::seconds(a.toEpochSecond() - b.toEpochSecond()); }
+/*! @brief Days between the dates. */
+inline days_t operator-(const LocalDate& a, const LocalDate& b) { return days_t(a.toEpochDay() - b.toEpochDay()); }
+///@}
+
+#if defined(GOBLIB_DATETIME_HAS_CHRONO_CALENDAR)
+///@name Interconversion with C++20 calendar types
+///@{
+/*! @brief Converts to std::chrono::year_month_day. */
+constexpr std::chrono::year_month_day toYearMonthDay(const LocalDate& ld)
+{
+    return std::chrono::year_month_day(std::chrono::year(ld.year()), std::chrono::month(ld.month()), std::chrono::day(ld.day()));
+}
+/*! @brief Converts std::chrono::year_month_day to LocalDate. */
+constexpr LocalDate toLocalDate(const std::chrono::year_month_day& ymd)
+{
+    return LocalDate(static_cast<int16_t>(static_cast<int>(ymd.year())), static_cast<int8_t>(static_cast<unsigned>(ymd.month())), static_cast<int8_t>(static_cast<unsigned>(ymd.day())));
+}
+/*! @brief Converts to std::chrono::sys_days. */
+constexpr std::chrono::sys_days toSysDays(const LocalDate& ld) { return std::chrono::sys_days(toYearMonthDay(ld)); }
+/*! @brief Converts std::chrono::sys_days to LocalDate. */
+constexpr LocalDate toLocalDate(const std::chrono::sys_days& sd) { return toLocalDate(std::chrono::year_month_day(sd)); }
+/*! @brief Converts to std::chrono::hh_mm_ss. */
+constexpr std::chrono::hh_mm_ss<std::chrono::seconds> toHhMmSs(const LocalTime& lt) { return std::chrono::hh_mm_ss<std::chrono::seconds>(toDuration(lt)); }
+/*! @brief Converts std::chrono::hh_mm_ss to LocalTime. (Sub-second part is truncated) */
+template<class Duration> constexpr LocalTime toLocalTime(const std::chrono::hh_mm_ss<Duration>& hms)
+{
+    return LocalTime(static_cast<int8_t>(hms.hours().count()), static_cast<int8_t>(hms.minutes().count()), static_cast<int8_t>(hms.seconds().count()));
+}
+/*! @brief Converts to std::chrono::sys_seconds. (constexpr) */
+constexpr std::chrono::sys_seconds toSysSeconds(const OffsetDateTime& odt)
+{
+    return toSysDays(odt.toLocalDate()) + toDuration(odt.toLocalTime()) - std::chrono::seconds(odt.offset().totalSeconds());
+}
+///@}
+#endif
+
+//
+}}
+#endif
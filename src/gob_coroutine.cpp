@@ -0,0 +1,78 @@
+/*!
+  @file gob_coroutine.cpp
+  @brief C++20 coroutine awaitables for sleeping until wall-clock times. (Requires C++20 coroutines)
+*/
+#include "gob_coroutine.hpp"
+
+#if defined(GOBLIB_DATETIME_HAS_COROUTINE)
+
+#include <algorithm>
+#include <thread>
+#include <ctime>
+
+namespace goblib { namespace datetime {
+
+TimerScheduler::TimerScheduler() : TimerScheduler([]() { return std::time(nullptr); }) {}
+
+TimerScheduler::TimerScheduler(clock_function_t clock) : _clock(std::move(clock)) {}
+
+TimerScheduler::~TimerScheduler()
+{
+    for(auto& e : _heap) { e.handle.destroy(); }
+}
+
+TimerScheduler::Awaiter TimerScheduler::sleepUntil(const time_t epoch)
+{
+    return Awaiter(this, epoch, OffsetDateTime(LocalDateTime::ofEpochSecond(epoch, ZoneOffset::UTC), ZoneOffset::UTC));
+}
+
+TimerScheduler::Awaiter TimerScheduler::nextLocal(const LocalTime& lt, const ZoneRules& rules)
+{
+    const time_t t = now();
+    const int32_t today = LocalDateTime::ofEpochSecond(t, rules.offset(t)).toLocalDate().toEpochDay();
+    time_t epoch{};
+    // Tomorrow at the latest, and the day after if the time of tomorrow is shifted into today by a gap.
+    for(int32_t d = 0; d < 3; ++d)
+    {
+        epoch = rules.toEpochSecond(LocalDateTime(LocalDate::ofEpochDay(today + d), lt));
+        if(epoch > t) { break; }
+    }
+    const auto zo = rules.offset(epoch);
+    return Awaiter(this, epoch, OffsetDateTime(LocalDateTime::ofEpochSecond(epoch, zo), zo));
+}
+
+void TimerScheduler::push(const time_t epoch, std::coroutine_handle<> h)
+{
+    _heap.push_back({ epoch, _seq++, h });
+    std::push_heap(_heap.begin(), _heap.end(), Later());
+}
+
+size_t TimerScheduler::poll()
+{
+    const time_t t = now();
+    size_t resumed{};
+    while(!_heap.empty() && _heap.front().epoch <= t)
+    {
+        std::pop_heap(_heap.begin(), _heap.end(), Later());
+        auto h = _heap.back().handle;
+        _heap.pop_back();
+        h.resume(); // May push new waiters
+        ++resumed;
+    }
+    return resumed;
+}
+
+void TimerScheduler::run(const std::chrono::seconds& maxSleep)
+{
+    while(!_heap.empty())
+    {
+        poll();
+        if(_heap.empty()) { break; }
+        const time_t wait = nextDue() - now();
+        if(wait > 0) { std::this_thread::sleep_for(std::min(std::chrono::seconds(wait), maxSleep)); }
+    }
+}
+
+//
+}}
+#endif
@@ -0,0 +1,166 @@
+/*!
+  @file gob_coroutine.hpp
+  @brief C++20 coroutine awaitables for sleeping until wall-clock times. (Requires C++20 coroutines)
+
+  @code
+  TimerScheduler sched;
+  auto ny = ZoneRules::ofLocation("America/New_York");
+  auto alarm = [&]() -> DetachedTask
+  {
+      for(;;)
+      {
+          auto at = co_await sched.nextLocal(LocalTime(7, 0, 0), ny); // Every 07:00 in New York, DST aware
+          printf("%s\n", at.toString().c_str());
+      }
+  };
+  alarm();
+  auto report = [&]() -> DetachedTask
+  {
+      co_await sched.sleepUntil(OffsetDateTime::parse("2023-01-01T00:00:00+09:00"));
+      // ...
+  };
+  report();
+  sched.run(); // or call sched.poll() from your event loop
+  @endcode
+  @note Waiters are kept in a binary heap keyed on the wall-clock epoch, so suspending and resuming cost O(log n) each.
+  @note Waiters are due by the wall clock, not a monotonic clock. If the wall clock jumps forward, the passed waiters are resumed at the next poll. If it jumps backward, they wait until the wall clock reaches them again.
+*/
+#ifndef GOBLIB_COROUTINE_HPP
+#define GOBLIB_COROUTINE_HPP
+
+#include "gob_datetime.hpp"
+#include "gob_zone_rules.hpp"
+
+#if defined(__has_include)
+# if __cplusplus >= 202002L && defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#   define GOBLIB_DATETIME_HAS_COROUTINE
+# endif
+#endif
+
+#if defined(GOBLIB_DATETIME_HAS_COROUTINE)
+
+#include <coroutine>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class DetachedTask
+  @brief Fire-and-forget coroutine type. The coroutine starts immediately and frees itself on completion.
+  @note Exceptions thrown from the coroutine terminate the program.
+ */
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+/*!
+  @class TimerScheduler
+  @brief Resumes coroutines at wall-clock times.
+  @note Not thread-safe. Await, poll and run in the same thread.
+  @note Coroutines still waiting are destroyed with the scheduler.
+ */
+class TimerScheduler
+{
+  public:
+    using clock_function_t = std::function<time_t()>; //!< @brief Returns the current epoch.
+
+    /*!
+      @class Awaiter
+      @brief Awaitable that suspends until the epoch.
+      @note co_await returns the due date-time.
+     */
+    class Awaiter
+    {
+      public:
+        bool await_ready() const { return _sched->now() >= _epoch; }
+        void await_suspend(std::coroutine_handle<> h) { _sched->push(_epoch, h); }
+        OffsetDateTime await_resume() const { return _due; }
+
+      private:
+        friend class TimerScheduler;
+        Awaiter(TimerScheduler* sched, const time_t epoch, const OffsetDateTime& due) : _sched(sched), _epoch(epoch), _due(due) {}
+
+        TimerScheduler* _sched;
+        time_t _epoch;
+        OffsetDateTime _due;
+    };
+
+    ///@name Constructors
+    ///@{
+    TimerScheduler();
+    explicit TimerScheduler(clock_function_t clock);
+    ~TimerScheduler();
+    TimerScheduler(const TimerScheduler&) = delete;
+    TimerScheduler& operator=(const TimerScheduler&) = delete;
+    ///@}
+
+    ///@name Awaitables
+    ///@{
+    /*! @brief Suspends until the instant of the date-time. */
+    Awaiter sleepUntil(const OffsetDateTime& odt) { return Awaiter(this, odt.toEpochSecond(), odt); }
+    /*! @brief Suspends until the epoch. */
+    Awaiter sleepUntil(const time_t epoch);
+    /*! @brief Suspends for the duration. (Until the wall-clock epoch of now + d) */
+    Awaiter sleepFor(const std::chrono::seconds& d) { return sleepUntil(static_cast<time_t>(now() + d.count())); }
+    /*!
+      @brief Suspends until the next occurrence of the local time in the zone, after now.
+      @note A local time in a gap is shifted later by the length of the gap, and in an overlap the earlier is used. (Same as ZoneRules::toEpochSecond)
+      @note The date-time that co_await returns has the offset of the zone at that time.
+     */
+    Awaiter nextLocal(const LocalTime& lt, const ZoneRules& rules);
+    ///@}
+
+    /*! @brief Gets the current epoch from the clock. */
+    time_t now() const { return _clock(); }
+    /*! @brief Number of the waiting coroutines. */
+    size_t size() const { return _heap.size(); }
+    /*! @brief Is there no waiting coroutine? */
+    bool empty() const { return _heap.empty(); }
+    /*! @brief Gets the epoch of the earliest waiter, or -1 if empty. */
+    time_t nextDue() const { return _heap.empty() ? static_cast<time_t>(-1) : _heap.front().epoch; }
+
+    /*!
+      @brief Resumes all the waiters due at now, the earlier epoch first. (FIFO in the same epoch)
+      @return Number of resumed waiters.
+     */
+    size_t poll();
+    /*!
+      @brief Polls and sleeps the thread until no waiter remains.
+      @param maxSleep Maximum length of a sleep, to notice wall-clock jumps.
+     */
+    void run(const std::chrono::seconds& maxSleep = std::chrono::seconds(1));
+
+  private:
+    struct Entry
+    {
+        time_t epoch;
+        uint64_t seq;
+        std::coroutine_handle<> handle;
+    };
+    // For min heap
+    struct Later
+    {
+        bool operator()(const Entry& a, const Entry& b) const { return a.epoch != b.epoch ? a.epoch > b.epoch : a.seq > b.seq; }
+    };
+    void push(const time_t epoch, std::coroutine_handle<> h);
+
+    clock_function_t _clock;
+    std::vector<Entry> _heap{};
+    uint64_t _seq{};
+};
+
+//
+}}
+#endif
+#endif
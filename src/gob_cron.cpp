@@ -0,0 +1,274 @@
+/*!
+  @file gob_cron.cpp
+  @brief Cron expression that computes the next fire time in local date-time or zone.
+*/
+#include "gob_cron.hpp"
+#include "gob_datetime_internal.hpp"
+#include <cctype>
+#include <cstring>
+
+namespace
+{
+using goblib::datetime::LocalDate;
+using goblib::datetime::LocalDateTime;
+using goblib::datetime::OffsetDateTime;
+using goblib::datetime::ZoneOffset;
+using goblib::datetime::detail::ctz64;
+
+constexpr int32_t SEARCH_YEARS = 400; // The Gregorian calendar repeats every 400 years.
+
+const char* monthNames[] = { "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };
+const char* dayOfWeekNames[] = { "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT" };
+
+struct Macro { const char* name; const char* expr; };
+const Macro macros[] =
+{
+    { "@yearly",   "0 0 0 1 1 *" },
+    { "@annually", "0 0 0 1 1 *" },
+    { "@monthly",  "0 0 0 1 * *" },
+    { "@weekly",   "0 0 0 * * 0" },
+    { "@daily",    "0 0 0 * * *" },
+    { "@midnight", "0 0 0 * * *" },
+    { "@hourly",   "0 0 * * * *" },
+};
+
+struct Field
+{
+    int32_t min, max;
+    const char** names; // min based
+    size_t nameCount;
+};
+
+inline bool isTerminal(const char c)
+{
+    return c == '\0' || std::isspace(static_cast<unsigned char>(c));
+}
+
+const char* parseValue(const char* p, const Field& f, int32_t& v)
+{
+    if(std::isdigit(static_cast<unsigned char>(*p)))
+    {
+        v = 0;
+        while(std::isdigit(static_cast<unsigned char>(*p)) && v <= f.max) { v = v * 10 + (*p++ - '0'); }
+        return (v >= f.min && v <= f.max) ? p : nullptr;
+    }
+    for(size_t i = 0; i < f.nameCount; ++i)
+    {
+        auto nm = f.names[i];
+        if(std::toupper(static_cast<unsigned char>(p[0])) == nm[0] &&
+           std::toupper(static_cast<unsigned char>(p[1])) == nm[1] &&
+           std::toupper(static_cast<unsigned char>(p[2])) == nm[2])
+        {
+            v = f.min + static_cast<int32_t>(i);
+            return p + 3;
+        }
+    }
+    return nullptr;
+}
+
+// Parse a field into bits. Returns the pointer after the field or nullptr if failed.
+const char* parseField(const char* p, const Field& f, const bool allowQuestion, uint64_t& bits, bool& star)
+{
+    while(std::isspace(static_cast<unsigned char>(*p))) { ++p; }
+    bits = 0;
+    star = (*p == '*') || (allowQuestion && *p == '?');
+    for(;;)
+    {
+        int32_t lo{}, hi{}, step{1};
+        bool range{};
+        if(*p == '*' || (allowQuestion && *p == '?'))
+        {
+            lo = f.min; hi = f.max; ++p;
+        }
+        else
+        {
+            if(!(p = parseValue(p, f, lo))) { return nullptr; }
+            hi = lo;
+            range = (*p == '-');
+            if(range && !(p = parseValue(p + 1, f, hi))) { return nullptr; }
+        }
+        if(*p == '/')
+        {
+            ++p;
+            if(!std::isdigit(static_cast<unsigned char>(*p))) { return nullptr; }
+            step = 0;
+            while(std::isdigit(static_cast<unsigned char>(*p)) && step <= f.max) { step = step * 10 + (*p++ - '0'); }
+            if(step < 1 || step > f.max) { return nullptr; }
+            if(!range) { hi = f.max; } // "n/step" means "n-max/step", "*/step" is already so
+        }
+        if(lo > hi) { return nullptr; }
+        for(int32_t i = lo; i <= hi; i += step) { bits |= (1ULL << i); }
+
+        if(*p == ',') { ++p; continue; }
+        return isTerminal(*p) ? p : nullptr;
+    }
+}
+
+const LocalDateTime invalidLocalDateTime{ LocalDate(0, 0, 0), {} };
+//
+}
+
+namespace goblib { namespace datetime {
+
+bool CronExpression::matches(const LocalDateTime& ldt) const
+{
+    return valid()
+            && ((_seconds >> ldt.second()) & 1) && ((_minutes >> ldt.minute()) & 1) && ((_hours >> ldt.hour()) & 1)
+            && ((_months >> ldt.month()) & 1) && ((dayMask(ldt.year(), ldt.month()) >> ldt.day()) & 1);
+}
+
+// Bits of matched days (bit 1-31) in the month.
+uint64_t CronExpression::dayMask(const int16_t year, const int8_t month) const
+{
+    const LocalDate first(year, month, 1);
+    const uint64_t lomMask = ((1ULL << first.lengthOfMonth()) - 1) << 1;
+    if(_domStar && _dowStar) { return lomMask; }
+
+    const uint64_t domMask = _days & lomMask;
+    if(_dowStar) { return domMask; }
+
+    // Rotate day-of-week bits to the order from the first day of the month, and repeat it for 5 weeks.
+    const uint32_t f = static_cast<uint32_t>(first.dayOfWeek());
+    const uint64_t r = ((_daysOfWeek >> f) | (_daysOfWeek << (7 - f))) & 0x7F;
+    const uint64_t dowMask = ((r | (r << 7) | (r << 14) | (r << 21) | (r << 28)) << 1) & lomMask;
+    return _domStar ? dowMask : (domMask | dowMask);
+}
+
+LocalDateTime CronExpression::next(const LocalDateTime& after) const
+{
+    if(!valid() || !after.valid()) { return invalidLocalDateTime; }
+
+    auto start = LocalDateTime::ofEpochSecond(after.toEpochSecond(ZoneOffset::UTC) + 1, ZoneOffset::UTC);
+    int32_t y = start.year(), mo = start.month(), d = start.day(), h = start.hour(), mi = start.minute(), s = start.second();
+    const int32_t ylimit = (y + SEARCH_YEARS < LocalDate::MAX.year()) ? y + SEARCH_YEARS : LocalDate::MAX.year();
+
+    while(y <= ylimit)
+    {
+        const uint32_t mm = _months & (~0U << mo);
+        if(!mm) { ++y; mo = 1; d = 1; h = mi = s = 0; continue; }
+        const int32_t nmo = ctz64(mm);
+        if(nmo != mo) { mo = nmo; d = 1; h = mi = s = 0; }
+
+        const uint64_t dm = dayMask(y, mo) & (~0ULL << d);
+        if(!dm) { ++mo; d = 1; h = mi = s = 0; continue; }
+        const int32_t nd = ctz64(dm);
+        if(nd != d) { d = nd; h = mi = s = 0; }
+
+        const uint32_t hm = _hours & (~0U << h);
+        if(!hm) { ++d; h = mi = s = 0; continue; }
+        const int32_t nh = ctz64(hm);
+        if(nh != h) { h = nh; mi = s = 0; }
+
+        const uint64_t mim = _minutes & (~0ULL << mi);
+        if(!mim) { ++h; mi = s = 0; continue; }
+        const int32_t nmi = ctz64(mim);
+        if(nmi != mi) { mi = nmi; s = 0; }
+
+        const uint64_t sm = _seconds & (~0ULL << s);
+        if(!sm) { ++mi; s = 0; continue; }
+        s = ctz64(sm);
+
+        LocalDateTime ldt(y, mo, d, h, mi, s);
+        return ldt.valid() ? ldt : invalidLocalDateTime;
+    }
+    return invalidLocalDateTime;
+}
+
+OffsetDateTime CronExpression::next(const time_t after, const ZoneRules& zone) const
+{
+    auto local = LocalDateTime::ofEpochSecond(after, zone.offset(after));
+    for(;;)
+    {
+        auto c = next(local);
+        if(!c.valid()) { break; }
+
+        ZoneOffset zo[2];
+        time_t t{};
+        if(zone.validOffsets(c, zo))
+        {
+            t = c.toEpochSecond(zo[0]); // Normal or the earlier instant of the overlap.
+        }
+        else
+        {
+            // Gap: the transition instant is in (c - greater offset, c - lesser offset].
+            const time_t lo = c.toEpochSecond(zone.standardOffset() > zone.daylightOffset() ? zone.standardOffset() : zone.daylightOffset());
+            const time_t hi = c.toEpochSecond(zone.standardOffset() < zone.daylightOffset() ? zone.standardOffset() : zone.daylightOffset());
+            t = hi;
+            for(int32_t yy = c.year() - 1; yy <= c.year() + 1; ++yy)
+            {
+                auto s = zone.daylightStart(yy), e = zone.daylightEnd(yy);
+                if(s > lo && s <= hi) { t = s; }
+                if(e > lo && e <= hi) { t = e; }
+            }
+        }
+        if(t > after)
+        {
+            auto zo = zone.offset(t);
+            return OffsetDateTime(LocalDateTime::ofEpochSecond(t, zo), zo);
+        }
+        local = c; // Already passed. (The later instant of the overlap)
+    }
+    return OffsetDateTime(invalidLocalDateTime, ZoneOffset::UTC);
+}
+
+CronExpression CronExpression::parse(const char* s)
+{
+    if(!s) { return CronExpression(); }
+    while(std::isspace(static_cast<unsigned char>(*s))) { ++s; }
+    if(*s == '@')
+    {
+        for(auto& m : macros)
+        {
+            auto len = std::strlen(m.name);
+            if(std::strncmp(s, m.name, len) == 0 && isTerminal(s[len])) { return parse(m.expr); }
+        }
+        return CronExpression();
+    }
+
+    // Count fields.
+    int fields{};
+    for(const char* p = s; *p;)
+    {
+        while(std::isspace(static_cast<unsigned char>(*p))) { ++p; }
+        if(!*p) { break; }
+        ++fields;
+        while(*p && !std::isspace(static_cast<unsigned char>(*p))) { ++p; }
+    }
+    if(fields != 5 && fields != 6) { return CronExpression(); }
+
+    static const Field secF{ 0, 59, nullptr, 0 };
+    static const Field minF{ 0, 59, nullptr, 0 };
+    static const Field hourF{ 0, 23, nullptr, 0 };
+    static const Field domF{ 1, 31, nullptr, 0 };
+    static const Field monF{ 1, 12, monthNames, 12 };
+    static const Field dowF{ 0, 7, dayOfWeekNames, 7 };
+
+    CronExpression ce;
+    uint64_t bits{};
+    bool star{};
+    const char* p = s;
+    if(fields == 6)
+    {
+        if(!(p = parseField(p, secF, false, bits, star))) { return CronExpression(); }
+        ce._seconds = bits;
+    }
+    else
+    {
+        ce._seconds = 1; // 0 second
+    }
+    if(!(p = parseField(p, minF, false, bits, star)))  { return CronExpression(); }
+    ce._minutes = bits;
+    if(!(p = parseField(p, hourF, false, bits, star))) { return CronExpression(); }
+    ce._hours = static_cast<uint32_t>(bits);
+    if(!(p = parseField(p, domF, true, bits, star)))   { return CronExpression(); }
+    ce._days = static_cast<uint32_t>(bits);
+    ce._domStar = star;
+    if(!(p = parseField(p, monF, false, bits, star)))  { return CronExpression(); }
+    ce._months = static_cast<uint16_t>(bits);
+    if(!(p = parseField(p, dowF, true, bits, star)))   { return CronExpression(); }
+    ce._daysOfWeek = static_cast<uint8_t>((bits | (bits >> 7)) & 0x7F); // 7 is also Sunday
+    ce._dowStar = star;
+    return ce;
+}
+//
+}}
@@ -0,0 +1,83 @@
+/*!
+  @file gob_cron.hpp
+  @brief Cron expression that computes the next fire time in local date-time or zone.
+
+  @code
+  auto cron = CronExpression::parse("30 9 * * MON-FRI"); // 09:30 on weekdays
+  auto zone = ZoneRules::ofLocation("America/Los_Angeles");
+  auto next = cron.next(OffsetDateTime::now(), zone);
+  @endcode
+*/
+#ifndef GOBLIB_CRON_HPP
+#define GOBLIB_CRON_HPP
+
+#include "gob_datetime.hpp"
+#include "gob_zone_rules.hpp"
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class CronExpression
+  @brief Compiled cron expression.
+  @note Each field is compiled into a bitset, and the next fire time is found by scanning bits of the fields from month to second.
+
+  Format
+  - "minute hour day-of-month month day-of-week" (5 fields)
+  - "second minute hour day-of-month month day-of-week" (6 fields)
+  - "@yearly" "@annually" "@monthly" "@weekly" "@daily" "@midnight" "@hourly"
+
+  Each field accepts "*", "?" (day-of-month and day-of-week only), "n", "n-m", "x/step" (x is "*", "n" for n to the maximum, or "n-m") and lists separated by ",".
+  Month accepts JAN-DEC and day-of-week accepts SUN-SAT. (case-insensitive) 7 of day-of-week is also Sunday.
+  @note If both day-of-month and day-of-week are restricted (not start with "*" or "?"), matches either of them. (Same as Vixie cron)
+*/
+class CronExpression
+{
+  public:
+    ///@name Constructors
+    ///@{
+    constexpr CronExpression() {} //!< Invalid instance.
+    explicit CronExpression(const char* s) : CronExpression() { *this = parse(s); }
+    ///@}
+
+    /*! @brief Is valid instance? */
+    constexpr bool valid() const { return _seconds && _minutes && _hours && _days && _months && _daysOfWeek; }
+    /*! @brief Checks if the local date-time matches this expression. */
+    bool matches(const LocalDateTime& ldt) const;
+    /*!
+      @brief Gets the next fire time after the local date-time.
+      @return Invalid instance if there is no next fire time in 400 years or until LocalDate::MAX.
+     */
+    LocalDateTime next(const LocalDateTime& after) const;
+    /*!
+      @brief Gets the next fire time after the epoch in the zone.
+      @note A fire time in a gap fires at the end of the gap (the instant of the transition).
+      @note A fire time in an overlap fires once at the earlier instant.
+      @return Invalid instance if there is no next fire time.
+     */
+    OffsetDateTime next(const time_t after, const ZoneRules& zone) const;
+    /*! @brief Gets the next fire time after the date-time in the zone. */
+    OffsetDateTime next(const OffsetDateTime& after, const ZoneRules& zone) const { return next(after.toEpochSecond(), zone); }
+    /*! @brief Gets the next fire time after the date-time, using the offset of the date-time. */
+    OffsetDateTime next(const OffsetDateTime& after) const { return next(after.toEpochSecond(), ZoneRules(after.offset())); }
+
+    /*!
+      @brief Obtains an instance of CronExpression from a text string such as "0 12 * * MON-FRI".
+      @return Invalid instance if failed to parse.
+     */
+    static CronExpression parse(const char* s);
+
+  private:
+    uint64_t dayMask(const int16_t year, const int8_t month) const;
+
+    uint64_t _seconds{};    // bit 0-59
+    uint64_t _minutes{};    // bit 0-59
+    uint32_t _hours{};      // bit 0-23
+    uint32_t _days{};       // bit 1-31
+    uint16_t _months{};     // bit 1-12
+    uint8_t  _daysOfWeek{}; // bit 0-6 (Sunday is 0)
+    bool _domStar{}, _dowStar{};
+};
+
+//
+}}
+#endif
@@ -0,0 +1,111 @@
+/*!
+  @file gob_date_range.cpp
+  @brief Ranges of LocalDate and LocalDateTime with a step.
+*/
+#include "gob_date_range.hpp"
+#include "gob_datetime_internal.hpp"
+
+namespace
+{
+using goblib::datetime::LocalDate;
+using goblib::datetime::detail::SEC_PER_MIN;
+using goblib::datetime::detail::SEC_PER_HOUR;
+using goblib::datetime::detail::SEC_PER_DAY;
+
+// Number of k >= 0 that satisfies start + k * step < end, when the difference is diff.
+inline int32_t countOf(const int64_t diff, const int64_t step)
+{
+    return diff > 0 ? static_cast<int32_t>((diff + step - 1) / step) : 0;
+}
+
+// Number of k >= 0 that satisfies start plus (k * step) months < end.
+// tail is true if the date-time of the month of end (clamped day of month) is less than end.
+inline int32_t countOfMonths(const int32_t diff, const int32_t step, const bool tail)
+{
+    return countOf(diff, step) + (diff >= 0 && (diff % step) == 0 && tail);
+}
+
+// Step that is larger than the difference is clamped, since the range has at most one element then.
+// It keeps the step of the iterators in range of int32 days and months.
+inline int64_t clampedStep(const int64_t step, const int64_t diff)
+{
+    const int64_t limit = (diff > 0 ? diff : 0) + 1;
+    return step < limit ? step : limit;
+}
+
+inline int32_t monthsOf(const LocalDate& ld)
+{
+    return ld.year() * 12 + ld.month() - 1;
+}
+
+// Clamped day of month of the month of ld.
+inline int8_t clampedDay(const LocalDate& ld, const int8_t dayOfMonth)
+{
+    return dayOfMonth < ld.lengthOfMonth() ? dayOfMonth : ld.lengthOfMonth();
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+// ----------------------------------------------------------------------
+// class DateRange
+DateRange::DateRange(const LocalDate& start, const LocalDate& end, const int32_t amount, const ChronoUnit unit)
+        : _start(start)
+{
+    if(amount <= 0) { return; }
+    switch(unit)
+    {
+    case ChronoUnit::Weeks:
+    case ChronoUnit::Days:
+        {
+            const int64_t diff = (int64_t)end.toEpochDay() - start.toEpochDay();
+            _days = static_cast<int32_t>(clampedStep(static_cast<int64_t>(amount) * (unit == ChronoUnit::Weeks ? 7 : 1), diff));
+            _size = countOf(diff, _days);
+        }
+        break;
+    case ChronoUnit::Years:
+    case ChronoUnit::Months:
+        {
+            const int32_t diff = monthsOf(end) - monthsOf(start);
+            _months = static_cast<int32_t>(clampedStep(static_cast<int64_t>(amount) * (unit == ChronoUnit::Years ? 12 : 1), diff));
+            _size = countOfMonths(diff, _months, clampedDay(end, start.day()) < end.day());
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+// ----------------------------------------------------------------------
+// class DateTimeRange
+DateTimeRange::DateTimeRange(const LocalDateTime& start, const LocalDateTime& end, const int32_t amount, const ChronoUnit unit)
+        : _start(start)
+{
+    if(amount <= 0) { return; }
+    switch(unit)
+    {
+    case ChronoUnit::Years:
+    case ChronoUnit::Months:
+        {
+            auto ed = end.toLocalDate();
+            const int32_t diff = monthsOf(ed) - monthsOf(start.toLocalDate());
+            _months = static_cast<int32_t>(clampedStep(static_cast<int64_t>(amount) * (unit == ChronoUnit::Years ? 12 : 1), diff));
+            auto cd = clampedDay(ed, start.day());
+            bool tail = (cd < ed.day()) || (cd == ed.day() && start.toSecondOfDay() < end.toSecondOfDay());
+            _size = countOfMonths(diff, _months, tail);
+        }
+        return;
+    case ChronoUnit::Seconds:  _seconds = amount; break;
+    case ChronoUnit::Minutes:  _seconds = static_cast<int64_t>(amount) * SEC_PER_MIN; break;
+    case ChronoUnit::Hours:    _seconds = static_cast<int64_t>(amount) * SEC_PER_HOUR; break;
+    case ChronoUnit::HalfDays: _seconds = static_cast<int64_t>(amount) * SEC_PER_DAY / 2; break;
+    case ChronoUnit::Days:     _seconds = static_cast<int64_t>(amount) * SEC_PER_DAY; break;
+    case ChronoUnit::Weeks:    _seconds = static_cast<int64_t>(amount) * SEC_PER_DAY * 7; break;
+    }
+    const int64_t diff = (int64_t)end.toEpochSecond(ZoneOffset::UTC) - start.toEpochSecond(ZoneOffset::UTC);
+    _seconds = clampedStep(_seconds, diff);
+    _size = countOf(diff, _seconds);
+}
+//
+}}
@@ -0,0 +1,228 @@
+/*!
+  @file gob_date_range.hpp
+  @brief Ranges of LocalDate and LocalDateTime with a step, usable with range-based for.
+
+  @code
+  for(auto& ld : DateRange(LocalDate(2022, 1, 31), LocalDate(2023, 1, 1), 1, ChronoUnit::Months))
+  {
+      printf("%s\n", ld.toString().c_str()); // 2022-01-31, 2022-02-28, 2022-03-31 ...
+  }
+  @endcode
+*/
+#ifndef GOBLIB_DATE_RANGE_HPP
+#define GOBLIB_DATE_RANGE_HPP
+
+#include "gob_datetime.hpp"
+#include <iterator>
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class DateCursor
+  @brief Year, month and day that can be advanced without recomputing from the epoch day.
+  @note Used by the iterators of DateRange and DateTimeRange.
+ */
+class DateCursor
+{
+  public:
+    constexpr DateCursor() {}
+    constexpr explicit DateCursor(const LocalDate& ld) : _year(ld.year()), _month(ld.month()), _day(ld.day()) {}
+
+    constexpr LocalDate toLocalDate() const { return LocalDate(_year, _month, _day); } //!< @brief Gets the current date.
+
+    /*! @brief Advance days. */
+    inline void plusDays(int32_t days)
+    {
+        int32_t d = _day + days;
+        int8_t lom;
+        while(d > (lom = LocalDate(_year, _month, 1).lengthOfMonth()))
+        {
+            d -= lom;
+            if(++_month > 12) { _month = 1; ++_year; }
+        }
+        _day = d;
+    }
+    /*!
+      @brief Advance months.
+      @param months Months to advance.
+      @param dayOfMonth The day of month to be set. Clamped to the length of month.
+     */
+    inline void plusMonths(const int32_t months, const int8_t dayOfMonth)
+    {
+        int32_t m = _month - 1 + months;
+        _year += m / 12;
+        _month = m % 12 + 1;
+        int8_t lom = LocalDate(_year, _month, 1).lengthOfMonth();
+        _day = dayOfMonth < lom ? dayOfMonth : lom;
+    }
+
+  private:
+    int16_t _year{1970};
+    int8_t _month{1};
+    int8_t _day{1};
+};
+
+
+/*!
+  @class DateRange
+  @brief A range of LocalDate from start (inclusive) to end (exclusive) with a step.
+  @note Supported units are Days, Weeks, Months and Years. Other units make an empty range.
+  @note Stepping by month is based on the day of month of the start, and clamped to the length of month. (e.g. 01-31, 02-28, 03-31...)
+ */
+class DateRange
+{
+  public:
+    /*!
+      @class iterator
+      @brief Forward iterator of DateRange.
+     */
+    class iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = LocalDate;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const LocalDate*;
+        using reference = const LocalDate&;
+
+        iterator() {}
+
+        reference operator*() const { return _cur; }
+        pointer operator->() const { return &_cur; }
+        iterator& operator++()
+        {
+            ++_index;
+            if(_months) { _cursor.plusMonths(_months, _dayOfMonth); }
+            else        { _cursor.plusDays(_days); }
+            _cur = _cursor.toLocalDate();
+            return *this;
+        }
+        iterator operator++(int) { iterator tmp = *this; ++*this; return tmp; }
+
+        friend inline bool operator==(const iterator& a, const iterator& b) { return a._index == b._index; }
+        friend inline bool operator!=(const iterator& a, const iterator& b) { return a._index != b._index; }
+
+      private:
+        friend class DateRange;
+        iterator(const LocalDate& start, const int32_t index, const int32_t days, const int32_t months)
+                : _cur(start), _cursor(start), _index(index), _days(days), _months(months), _dayOfMonth(start.day()) {}
+
+        LocalDate _cur{};
+        DateCursor _cursor{};
+        int32_t _index{};
+        int32_t _days{}, _months{};
+        int8_t _dayOfMonth{1};
+    };
+    using const_iterator = iterator;
+
+    /*!
+      @param start The first date (inclusive)
+      @param end The end date (exclusive)
+      @param amount Amount of unit to step. (> 0)
+      @param unit Unit of step.
+     */
+    DateRange(const LocalDate& start, const LocalDate& end, const int32_t amount = 1, const ChronoUnit unit = ChronoUnit::Days);
+
+    iterator begin() const { return iterator(_start, 0, _days, _months); } //!< @brief Iterator to the first date.
+    iterator end()   const { return iterator(_start, _size, _days, _months); } //!< @brief Iterator to the end.
+    size_t size() const { return _size; } //!< @brief Number of dates in range.
+    bool empty() const { return _size == 0; } //!< @brief Is empty?
+
+  private:
+    LocalDate _start{};
+    int32_t _size{}, _days{}, _months{};
+};
+
+
+/*!
+  @class DateTimeRange
+  @brief A range of LocalDateTime from start (inclusive) to end (exclusive) with a step.
+  @note Stepping by month is based on the day of month of the start, and clamped to the length of month.
+ */
+class DateTimeRange
+{
+  public:
+    /*!
+      @class iterator
+      @brief Forward iterator of DateTimeRange.
+     */
+    class iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = LocalDateTime;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const LocalDateTime*;
+        using reference = const LocalDateTime&;
+
+        iterator() {}
+
+        reference operator*() const { return _cur; }
+        pointer operator->() const { return &_cur; }
+        iterator& operator++()
+        {
+            ++_index;
+            if(_months) { _cursor.plusMonths(_months, _dayOfMonth); }
+            else
+            {
+                int32_t ss = _second + _stepSecond;
+                int32_t mm = _minute + _stepMinute + (ss >= 60);
+                int32_t hh = _hour + _stepHour + (mm >= 60);
+                int32_t days = _days + (hh >= 24);
+                _second = (ss >= 60) ? ss - 60 : ss;
+                _minute = (mm >= 60) ? mm - 60 : mm;
+                _hour   = (hh >= 24) ? hh - 24 : hh;
+                if(days) { _cursor.plusDays(days); }
+            }
+            _cur = LocalDateTime(_cursor.toLocalDate(), LocalTime(_hour, _minute, _second));
+            return *this;
+        }
+        iterator operator++(int) { iterator tmp = *this; ++*this; return tmp; }
+
+        friend inline bool operator==(const iterator& a, const iterator& b) { return a._index == b._index; }
+        friend inline bool operator!=(const iterator& a, const iterator& b) { return a._index != b._index; }
+
+      private:
+        friend class DateTimeRange;
+        iterator(const LocalDateTime& start, const int32_t index, const int64_t seconds, const int32_t months)
+                : _cur(start), _cursor(start.toLocalDate()), _index(index),
+                  _days(static_cast<int32_t>(seconds / SEC_PER_DAY)), _months(months),
+                  _hour(start.hour()), _minute(start.minute()), _second(start.second()),
+                  _stepHour((seconds % SEC_PER_DAY) / 3600), _stepMinute((seconds % 3600) / 60), _stepSecond(seconds % 60),
+                  _dayOfMonth(start.day()) {}
+
+        LocalDateTime _cur{};
+        DateCursor _cursor{};
+        int32_t _index{};
+        int32_t _days{}, _months{};
+        int8_t _hour{}, _minute{}, _second{};
+        int8_t _stepHour{}, _stepMinute{}, _stepSecond{};
+        int8_t _dayOfMonth{1};
+    };
+    using const_iterator = iterator;
+
+    /*!
+      @param start The first date-time (inclusive)
+      @param end The end date-time (exclusive)
+      @param amount Amount of unit to step. (> 0)
+      @param unit Unit of step.
+     */
+    DateTimeRange(const LocalDateTime& start, const LocalDateTime& end, const int32_t amount = 1, const ChronoUnit unit = ChronoUnit::Hours);
+
+    iterator begin() const { return iterator(_start, 0, _seconds, _months); } //!< @brief Iterator to the first date-time.
+    iterator end()   const { return iterator(_start, _size, _seconds, _months); } //!< @brief Iterator to the end.
+    size_t size() const { return _size; } //!< @brief Number of date-times in range.
+    bool empty() const { return _size == 0; } //!< @brief Is empty?
+
+  private:
+    LocalDateTime _start{};
+    int32_t _size{};
+    int64_t _seconds{}; // Clamped to the span of the range
+    int32_t _months{};
+    static constexpr int32_t SEC_PER_DAY = 24 * 60 * 60;
+};
+
+//
+}}
+#endif
@@ -3,7 +3,11 @@
   @brief date-time classes like Java JSR 310
 */
 #include "gob_datetime.hpp"
-#include <cstdio> // sscanf
+#include "gob_datetime_internal.hpp"
+#include "gob_zone_context.hpp"
+#include "gob_instrumentation.hpp"
+#include <cstdio> // printf
+#include <cstring> // memcpy
 #include <cmath> // abs, remainder
 
 #ifndef NDEBUG
@@ -14,6 +18,9 @@
 
 namespace 
 {
+using goblib::datetime::detail::put2;
+using goblib::datetime::detail::get;
+
 template <typename T> constexpr typename std::underlying_type<T>::type to_underlying(T e) noexcept
 {
     return static_cast<typename std::underlying_type<T>::type>(e);
@@ -23,6 +30,7 @@ template <typename T> constexpr int sign(const T& v) noexcept { return (v > (T)0
 
 inline struct tm* toLocaltime(const time_t* t, struct tm* out)
 {
+    GOBLIB_DATETIME_PROBE(Localtime);
 #ifdef _MSC_VER
     localtime_s(out, t);
     return out;
@@ -31,22 +39,27 @@ inline struct tm* toLocaltime(const time_t* t, struct tm* out)
 #endif
 }
 
-inline struct tm* toGmtime(const time_t* t, struct tm* out)
+inline time_t fromLocaltime(struct tm* tm)
 {
-#ifdef _MSC_VER
-    gmtime_s(out, t);
-    return out;
+    GOBLIB_DATETIME_PROBE(Mktime);
+    return std::mktime(tm);
+}
 
-#else
-    return gmtime_r(t, out);
-#endif
+inline char* parseTm(const char* s, const char* fmt, struct tm* tm)
+{
+    GOBLIB_DATETIME_PROBE(Strptime);
+    return strptime(s, fmt, tm);
 }
 
 goblib::datetime::string_t tm2str(const struct tm& tm, const char* fmt = nullptr)
 {
     char buf[80];
-    std::strftime(buf, sizeof(buf), fmt ? fmt : "%FT%T", &tm);
+    {
+        GOBLIB_DATETIME_PROBE(Strftime);
+        std::strftime(buf, sizeof(buf), fmt ? fmt : "%FT%T", &tm);
+    }
     buf[sizeof(buf)-1] = '\0';
+    GOBLIB_DATETIME_PROBE(StringAlloc);
     return goblib::datetime::string_t(buf);
 }
 
@@ -80,6 +93,7 @@ goblib::datetime::MockClock _mockClock;
 
 time_t getNow()
 {
+    GOBLIB_DATETIME_PROBE(Now);
 #if !defined(NDEBUG) && defined(UNIT_TEST)
     time_t t = _mockClock.now();
 #else
@@ -87,6 +101,31 @@ time_t getNow()
 #endif
     return t;
 }
+
+// Texts of the quarter-hour offsets [-18:00 - +18:00]. Index is (seconds + 18 * 3600) / 900
+constexpr char quarterHourOffsets[145][7] =
+{
+    "-18:00", "-17:45", "-17:30", "-17:15", "-17:00", "-16:45", "-16:30", "-16:15",
+    "-16:00", "-15:45", "-15:30", "-15:15", "-15:00", "-14:45", "-14:30", "-14:15",
+    "-14:00", "-13:45", "-13:30", "-13:15", "-13:00", "-12:45", "-12:30", "-12:15",
+    "-12:00", "-11:45", "-11:30", "-11:15", "-11:00", "-10:45", "-10:30", "-10:15",
+    "-10:00", "-09:45", "-09:30", "-09:15", "-09:00", "-08:45", "-08:30", "-08:15",
+    "-08:00", "-07:45", "-07:30", "-07:15", "-07:00", "-06:45", "-06:30", "-06:15",
+    "-06:00", "-05:45", "-05:30", "-05:15", "-05:00", "-04:45", "-04:30", "-04:15",
+    "-04:00", "-03:45", "-03:30", "-03:15", "-03:00", "-02:45", "-02:30", "-02:15",
+    "-02:00", "-01:45", "-01:30", "-01:15", "-01:00", "-00:45", "-00:30", "-00:15",
+    "Z", "+00:15", "+00:30", "+00:45", "+01:00", "+01:15", "+01:30", "+01:45",
+    "+02:00", "+02:15", "+02:30", "+02:45", "+03:00", "+03:15", "+03:30", "+03:45",
+    "+04:00", "+04:15", "+04:30", "+04:45", "+05:00", "+05:15", "+05:30", "+05:45",
+    "+06:00", "+06:15", "+06:30", "+06:45", "+07:00", "+07:15", "+07:30", "+07:45",
+    "+08:00", "+08:15", "+08:30", "+08:45", "+09:00", "+09:15", "+09:30", "+09:45",
+    "+10:00", "+10:15", "+10:30", "+10:45", "+11:00", "+11:15", "+11:30", "+11:45",
+    "+12:00", "+12:15", "+12:30", "+12:45", "+13:00", "+13:15", "+13:30", "+13:45",
+    "+14:00", "+14:15", "+14:30", "+14:45", "+15:00", "+15:15", "+15:30", "+15:45",
+    "+16:00", "+16:15", "+16:30", "+16:45", "+17:00", "+17:15", "+17:30", "+17:45",
+    "+18:00",
+};
+
 //
 }
 
@@ -170,6 +209,7 @@ int32_t LocalDate::toEpochDay() const
 
 string_t LocalDate::toString(const char* fmt) const
 {
+    GOBLIB_DATETIME_PROBE(FormatLocalDate);
     struct tm tmp{};
     tmp.tm_year = year2tm(year());
     tmp.tm_mon = month2tm(month());
@@ -179,17 +219,28 @@ string_t LocalDate::toString(const char* fmt) const
     return tm2str(tmp, fmt ? fmt : "%F");
 }
 
-#if 0
-LocalDate LocalDate::ofEpochDay(int32_t eod)
+// See also http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+LocalDate LocalDate::ofEpochDay(const int32_t eod)
 {
-    return LocalDate();
+    const int32_t z = eod + 719468;
+    const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const uint32_t doe = static_cast<uint32_t>(z - era * 146097);          // [0, 146096]
+    const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+    const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);            // [0, 365]
+    const uint32_t mp = (5 * doy + 2) / 153;                                 // [0, 11]
+    const int32_t d = doy - (153 * mp + 2) / 5 + 1;                          // [1, 31]
+    const int32_t m = mp < 10 ? mp + 3 : mp - 9;                             // [1, 12]
+    return LocalDate(static_cast<int32_t>(yoe) + era * 400 + (m <= 2), m, d);
 }
 
-LocalDate LocalDate::ofYearDay(int16_t yy, int16_t doy)
+LocalDate LocalDate::ofYearDay(const int16_t yy, int16_t doy)
 {
-    return LocalDate();    
+    LocalDate ld(yy, 1, 1);
+    if(doy < 0 || doy >= ld.lengthOfYear()) { return LocalDate(yy, 0, 0); } // invalid
+    int8_t m = 1;
+    while(m < 12 && doy >= _daysOfMonthTable[ld.isLeapYear()][m]) { ++m; }
+    return LocalDate(yy, m, doy - _daysOfMonthTable[ld.isLeapYear()][m - 1] + 1);
 }
-#endif
 
 /*! @warning There are limitations and impacts due to standard time functions. */
 LocalDate LocalDate::now()
@@ -197,10 +248,16 @@ LocalDate LocalDate::now()
     return LocalDateTime::now().toLocalDate();
 }
 
+LocalDate LocalDate::now(const ZoneContext& ctx)
+{
+    return LocalDateTime::now(ctx).toLocalDate();
+}
+
 LocalDate LocalDate::parse(const char* s)
 {
+    GOBLIB_DATETIME_PROBE(ParseLocalDate);
     struct tm tmp{};
-    strptime(s, "%Y-%m-%d", &tmp);
+    parseTm(s, "%Y-%m-%d", &tmp);
     return LocalDate(tm2year(tmp.tm_year), tm2month(tmp.tm_mon), tmp.tm_mday);
     /*
     return (strptime(s, "%Y-%m-%d", &tmp) != nullptr) ?
@@ -221,6 +278,7 @@ LocalDateTime LocalTime::atDate(const LocalDate& ld)
 
 string_t LocalTime::toString(const char* fmt) const
 {
+    GOBLIB_DATETIME_PROBE(FormatLocalTime);
     struct tm tmp{};
     tmp.tm_hour = hour();
     tmp.tm_min = minute();
@@ -234,6 +292,11 @@ LocalTime LocalTime::now()
     return LocalDateTime::now().toLocalTime();
 }
 
+LocalTime LocalTime::now(const ZoneContext& ctx)
+{
+    return LocalDateTime::now(ctx).toLocalTime();
+}
+
 LocalTime LocalTime::ofSecondOfDay(const int32_t sod)
 {
     int32_t v = sod;
@@ -244,12 +307,26 @@ LocalTime LocalTime::ofSecondOfDay(const int32_t sod)
     return LocalTime(hh, mm, v);
 }
 
+LocalTime LocalTime::truncatedTo(const ChronoUnit unit) const
+{
+    switch(unit)
+    {
+    case ChronoUnit::Seconds:  return *this;
+    case ChronoUnit::Minutes:  return LocalTime(_hour, _minute, 0);
+    case ChronoUnit::Hours:    return LocalTime(_hour, 0, 0);
+    case ChronoUnit::HalfDays: return LocalTime(_hour / 12 * 12, 0, 0);
+    default: break;
+    }
+    return LocalTime(0, 0, 0);
+}
+
 LocalTime LocalTime::parse(const char* s)
 {
+    GOBLIB_DATETIME_PROBE(ParseLocalTime);
     struct tm tmp{};
     tmp.tm_hour = tmp.tm_min = tmp.tm_sec = -1;
 
-    strptime(s, "%H:%M:%S", &tmp);
+    parseTm(s, "%H:%M:%S", &tmp);
     return LocalTime(tmp.tm_hour, tmp.tm_min, tmp.tm_sec);
     /*
     return (strptime(s, "%H:%M:%S", &tmp) != nullptr) ? LocalTime(tmp.tm_hour, tmp.tm_min, tmp.tm_sec) : LocalTime();
@@ -273,39 +350,80 @@ const ZoneOffset ZoneOffset::INVALID { 0xBADBEAF }; // 195935919  "+54426:38:39"
 
 string_t ZoneOffset::toString() const
 {
-    if(_seconds == 0) { return string_t("Z"); }
-    
-    int sch = (sign(_seconds) >= 0) ? '+' : '-';
-    int hh = std::abs(hour());
-    int mm = std::abs(minute());
-    int ss = std::abs(second());
+    char buf[16];
+    const size_t len = toChars(buf, sizeof(buf));
+    GOBLIB_DATETIME_PROBE(StringAlloc);
+    return len ? string_t(buf) : string_t();
+}
+
+size_t ZoneOffset::toChars(char* buf, const size_t len) const
+{
+    GOBLIB_DATETIME_PROBE(FormatZoneOffset);
+    if(!buf) { return 0; }
+    // Most offsets are quarter-hours.
+    if(valid() && (_seconds % 900) == 0)
+    {
+        const char* s = quarterHourOffsets[(_seconds - MIN_SEC) / 900];
+        const size_t sz = _seconds ? 6 : 1;
+        if(len <= sz) { return 0; }
+        std::memcpy(buf, s, sz + 1);
+        return sz;
+    }
 
-    char buf[64];
-    if(!ss) { snprintf(buf, sizeof(buf), "%c%02d:%02d", sch, hh, mm);  }
-    else    { snprintf(buf, sizeof(buf), "%c%02d:%02d:%02d", sch, hh, mm, ss); }
-    buf[sizeof(buf) - 1] = '\0';
-    return string_t(buf);
+    // Invalid offsets are output as well. (e.g. "+54426:38:39")
+    const int32_t a = std::abs(_seconds);
+    const int32_t hh = a / SEC_PER_HOUR;
+    const int mm = (a / SEC_PER_MIN) % SEC_PER_MIN;
+    const int ss = a % SEC_PER_MIN;
+    size_t hd = 2;
+    for(int32_t h = hh; h >= 100; h /= 10) { ++hd; }
+    const size_t sz = 1 + hd + 3 + (ss ? 3 : 0);
+    if(len <= sz) { return 0; }
+
+    char* p = buf;
+    *p++ = (_seconds < 0) ? '-' : '+';
+    int32_t h = hh;
+    for(size_t i = hd; i > 0; --i) { p[i - 1] = '0' + h % 10; h /= 10; }
+    p += hd;
+    *p++ = ':';
+    p = put2(p, mm);
+    if(ss)
+    {
+        *p++ = ':';
+        p = put2(p, ss);
+    }
+    *p = '\0';
+    return p - buf;
 }
 
 ZoneOffset ZoneOffset::of(const char* s)
 {
-    if(!s || !s[0]) { return INVALID; }
-    if(s[0] == 'Z' && !s[1]) { return UTC; }
+    GOBLIB_DATETIME_PROBE(ParseZoneOffset);
+    if(!s) { return INVALID; }
+    const char* p = s;
+    if(*p == 'Z') { return p[1] ? INVALID : UTC; }
+    if(*p != '+' && *p != '-') { return INVALID; }
 
-    char sch = 0;
-    int hh,mm,ss;
-    hh = mm = ss = 0;
-    if(sscanf(s, "%c%02d:%02d:%02d", &sch, &hh, &mm, &ss) != 4)
+    const int32_t sign = (*p++ == '-') ? -1 : 1;
+    int hh{}, mm{}, ss{};
+    if(!get(p, 2, hh)) { return INVALID; }
+    if(*p == ':') // +hh:mm, +hh:mm:ss
     {
-        hh = mm = ss = 0;
-        if(sscanf(s, "%c%02d:%02d", &sch, &hh, &mm) != 3)
+        ++p;
+        if(!get(p, 2, mm)) { return INVALID; }
+        if(*p == ':')
         {
-            return INVALID;
+            ++p;
+            if(!get(p, 2, ss)) { return INVALID; }
         }
     }
-    if(sch != '+' && sch != '-') { return INVALID; }
-    int sign = (sch == '-') ? -1 : 1;
-    return of(sign * hh, sign * mm ,sign * ss);
+    else if(*p) // +hhmm
+    {
+        if(!get(p, 2, mm)) { return INVALID; }
+    }
+    if(*p || hh > 18 || mm > 59 || ss > 59) { return INVALID; }
+    ZoneOffset zo(sign * (hh * SEC_PER_HOUR + mm * SEC_PER_MIN + ss));
+    return zo.valid() ? zo : INVALID;
 }
 
 ZoneOffset ZoneOffset::of(const int8_t hour, const int8_t minute, const int8_t second)
@@ -340,14 +458,23 @@ OffsetTime OffsetTime::withOffsetSameEpoch(const ZoneOffset& zo)
 /*! @warning There are limitations and impacts due to standard time functions. */
 OffsetTime OffsetTime::now()
 {
+    auto ctx = ZoneContext::current();
+    if(ctx) { return now(*ctx); }
+
     time_t t = getNow();
     struct tm tml{};
     toLocaltime(&t, &tml);
-    auto diff = std::difftime(mkgmtime(tml), std::mktime(&tml));
+    auto diff = std::difftime(mkgmtime(tml), fromLocaltime(&tml));
     //    DT_LOG("tml:%s t:%ld diff:%lf", tm2str(tml).c_str(), t, diff);
     return ofEpochSecond(t, ZoneOffset(diff));
 }
 
+OffsetTime OffsetTime::now(const ZoneContext& ctx)
+{
+    time_t t = getNow();
+    return ofEpochSecond(t, ctx.offset(t));
+}
+
 OffsetTime OffsetTime::ofEpochSecond(const time_t& t, const ZoneOffset& zo)
 {
     time_t sod = (t + zo.totalSeconds())  % SEC_PER_DAY;
@@ -356,11 +483,12 @@ OffsetTime OffsetTime::ofEpochSecond(const time_t& t, const ZoneOffset& zo)
 
 OffsetTime OffsetTime::parse(const char* s)
 {
+    GOBLIB_DATETIME_PROBE(ParseOffsetTime);
     ZoneOffset zo;
     struct tm tmp{};
     tmp.tm_hour = tmp.tm_min = tmp.tm_sec = -1;
 
-    auto p = strptime(s, "%H:%M:%S", &tmp);
+    auto p = parseTm(s, "%H:%M:%S", &tmp);
     zo = ZoneOffset::of(p);
     //    DT_LOG("[%s]", p ? p : "NULL");
     return OffsetTime(LocalTime(tmp), zo);
@@ -382,11 +510,29 @@ OffsetDateTime LocalDateTime::atOffset(const ZoneOffset& zo) const
 
 time_t LocalDateTime::toEpochSecond(const ZoneOffset& zo) const
 {
+    GOBLIB_DATETIME_PROBE(LocalToEpoch);
     return _date.toEpochDay() * 86400LL + _time.toSecondOfDay() - zo.totalSeconds();
 }
 
+LocalDateTime LocalDateTime::truncatedTo(const ChronoUnit unit) const
+{
+    switch(unit)
+    {
+    case ChronoUnit::Weeks:
+    {
+        int32_t ed = toEpochDay();
+        return LocalDateTime(LocalDate::ofEpochDay(ed - (static_cast<int32_t>(dayOfWeek()) + 6) % 7), LocalTime(0, 0, 0));
+    }
+    case ChronoUnit::Months: return LocalDateTime(LocalDate(year(), month(), 1), LocalTime(0, 0, 0));
+    case ChronoUnit::Years:  return LocalDateTime(LocalDate(year(), 1, 1), LocalTime(0, 0, 0));
+    default: break;
+    }
+    return LocalDateTime(_date, _time.truncatedTo(unit));
+}
+
 string_t LocalDateTime::toString(const char* fmt) const
 {
+    GOBLIB_DATETIME_PROBE(FormatLocalDateTime);
     struct tm tmp = toTm();
     return tm2str(tmp, fmt);
 }
@@ -408,25 +554,36 @@ struct tm LocalDateTime::toTm() const
 /*! @warning There are limitations and impacts due to standard time functions. */
 LocalDateTime LocalDateTime::now()
 {
+    auto ctx = ZoneContext::current();
+    if(ctx) { return now(*ctx); }
+
     time_t t = getNow();
     struct tm tmp{};
     toLocaltime(&t, &tmp);
     return LocalDateTime(tmp);
 }
 
+LocalDateTime LocalDateTime::now(const ZoneContext& ctx)
+{
+    return ctx.toLocalDateTime(getNow());
+}
+
 LocalDateTime LocalDateTime::ofEpochSecond(const time_t& epoch, const ZoneOffset& zo)
 {
-    struct tm tmp{};
-    time_t t = epoch + zo.totalSeconds();
-    return LocalDateTime(*toGmtime(&t, &tmp));
+    GOBLIB_DATETIME_PROBE(EpochToLocal);
+    const int64_t sec = static_cast<int64_t>(epoch) + zo.totalSeconds();
+    const int64_t days = detail::floorDiv(sec, detail::SEC_PER_DAY);
+    return LocalDateTime(LocalDate::ofEpochDay(static_cast<int32_t>(days)),
+                         LocalTime::ofSecondOfDay(static_cast<int32_t>(sec - days * detail::SEC_PER_DAY)));
 }
 
 LocalDateTime LocalDateTime::parse(const char* s)
 {
+    GOBLIB_DATETIME_PROBE(ParseLocalDateTime);
     struct tm tmp{};
     tmp.tm_hour = tmp.tm_min = tmp.tm_sec = -1;
 
-    strptime(s, "%Y-%m-%dT%H:%M:%S", &tmp);
+    parseTm(s, "%Y-%m-%dT%H:%M:%S", &tmp);
     return LocalDateTime(tmp);
     //    return (strptime(s, "%Y-%m-%dT%H:%M:%S", &tmp) != nullptr) ? LocalDateTime(tmp) : LocalDateTime();
 }
@@ -454,20 +611,29 @@ OffsetDateTime OffsetDateTime::withOffsetSameEpoch(const ZoneOffset& zo) const
 /*! @warning There are limitations and impacts due to standard time functions. */
 OffsetDateTime OffsetDateTime::now()
 {
+    auto ctx = ZoneContext::current();
+    if(ctx) { return now(*ctx); }
+
     time_t t = getNow();
     struct tm tml{};
     toLocaltime(&t, &tml);
-    auto diff = std::difftime(mkgmtime(tml), std::mktime(&tml));
+    auto diff = std::difftime(mkgmtime(tml), fromLocaltime(&tml));
     //    DT_LOG("tml:%s t:%ld diff:%lf", tm2str(tml).c_str(), t, diff);
     return OffsetDateTime(LocalDateTime(tml), ZoneOffset(diff));
 }
 
+OffsetDateTime OffsetDateTime::now(const ZoneContext& ctx)
+{
+    return ctx.toOffsetDateTime(getNow());
+}
+
 OffsetDateTime OffsetDateTime::parse(const char* s)
 {
+    GOBLIB_DATETIME_PROBE(ParseOffsetDateTime);
     ZoneOffset zo;
     struct tm tmp{};
     tmp.tm_hour = tmp.tm_min = tmp.tm_sec = -1;
-    auto p = strptime(s, "%Y-%m-%dT%H:%M:%S", &tmp);
+    auto p = parseTm(s, "%Y-%m-%dT%H:%M:%S", &tmp);
     zo = ZoneOffset::of(p);
     return OffsetDateTime(LocalDateTime(tmp), zo);
 }
@@ -88,6 +88,8 @@ using string_t = std::string;
 */
 using timediff_t = double; // Same as retuen value type of std::difftime.
 
+class ZoneContext; // gob_zone_context.hpp
+
 
 /*!
   @brief Convert location string to POSIX TZ string.
@@ -120,6 +122,15 @@ enum class DayOfWeek : uint8_t
     Sun, Mon, Tue, Wed, Thu, Fri, Sat
 };
 
+/*!
+  @enum ChronoUnit
+  @brief A standard set of date periods units, such as Days.
+*/
+enum class ChronoUnit : uint8_t
+{
+    Seconds, Minutes, Hours, HalfDays, Days, Weeks, Months, Years
+};
+
 
 /*!
   @class LocalDate
@@ -149,8 +160,25 @@ class LocalDate
     constexpr bool isLeapYear() const { return (year() % 4 == 0) && ((year() % 100) != 0 || (year() % 400) == 0); } //!< @brief Checks if the year is a leap year, according to the ISO proleptic calendar system rules.
     constexpr int8_t lengthOfMonth() const {  return _lengthOfMonthTable[ isLeapYear() ][month() - 1]; } //!< @brief Returns the length of the month represented by this date.
     constexpr int16_t lengthOfYear() const { return isLeapYear() ? 366 : 365; } //!<  @brief Returns the length of the year represented by this date.
+    constexpr int8_t isoDayOfWeek() const { return (static_cast<int8_t>(dayOfWeek()) + 6) % 7 + 1; } //!< @brief Gets the ISO-8601 day of week. [1(Mon) - 7(Sun)]
+    /*! @brief Gets the ISO-8601 week of week-based-year. [1 - 53] */
+    constexpr int8_t isoWeek() const
+    {
+        return _rawIsoWeek() < 1 ? weeksInWeekBasedYear(year() - 1) : (_rawIsoWeek() > weeksInWeekBasedYear(year()) ? 1 : _rawIsoWeek());
+    }
+    /*! @brief Gets the ISO-8601 week-based-year. (It differs from year() around the new year) */
+    constexpr int16_t weekBasedYear() const
+    {
+        return _rawIsoWeek() < 1 ? year() - 1 : (_rawIsoWeek() > weeksInWeekBasedYear(year()) ? year() + 1 : year());
+    }
     ///@}
 
+    /*! @brief Gets the number of ISO-8601 weeks in the week-based-year. (52 or 53) */
+    static constexpr int8_t weeksInWeekBasedYear(const int16_t wby)
+    {
+        return 52 + (_dec31DayOfWeek(wby) == 4 || _dec31DayOfWeek(wby - 1) == 3);
+    }
+
     /*! @brief Is valid instance? */
     constexpr bool valid() const
     {
@@ -174,16 +202,20 @@ class LocalDate
      */
     string_t toString(const char* fmt = nullptr) const;
 
-    /*! @brief Obtains the current date from the system clock in the default time-zone.*/
+    /*! @brief Obtains the current date from the system clock in the default time-zone. (The context of the current thread if set)*/
     static LocalDate now();
+    /*! @brief Obtains the current date from the system clock in the specified context. */
+    static LocalDate now(const ZoneContext& ctx);
     /*! @brief Obtains an instance of LocalDate from a year, month and day. */
     static constexpr LocalDate of(const int16_t y, const int8_t m = 1, const int8_t d = 1) { return LocalDate(y, m, d); }
-#if 0
     /*! @brief Obtains an instance of LocalDate from the epoch day count. */
     static LocalDate ofEpochDay(const int32_t eod);
-    /*! @brief Obtains an instance of LocalDate from a year and day-of-year. */
+    /*!
+      @brief Obtains an instance of LocalDate from a year and day-of-year.
+      @param yy Year
+      @param doy Day of year, from 0 to 365. (same as struct tm.tm_yday and dayOfYear())
+    */
     static LocalDate ofYearDay(const int16_t yy, int16_t doy);
-#endif
     /*! @brief Obtains an instance of LocalDate from a text string such as 2009-08-07. */
     static LocalDate parse(const char* s);
 
@@ -203,6 +235,11 @@ class LocalDate
     static const LocalDate MAX; //!< @brief The maximum supported date.
 
   private:
+    // Week number by the ordinal day and ISO day of week. 0 is the last week of the previous year, and over the weeks of the year is week 1 of the next year.
+    constexpr int8_t _rawIsoWeek() const { return (dayOfYear() + 1 - isoDayOfWeek() + 10) / 7; }
+    // Day of week of December 31 of the year. (0 : Sunday) 53 weeks if it is Thursday, or Wednesday in the previous year.
+    static constexpr int8_t _dec31DayOfWeek(const int16_t y) { return (y + y / 4 - y / 100 + y / 400) % 7; }
+
     int16_t _year  { MIN_YEAR };
     int8_t  _month { MIN_MONTH };
     int8_t  _day   { MIN_DAY };
@@ -262,14 +299,21 @@ class LocalTime
     LocalDateTime atDate(const LocalDate& ld);
     /*! @brief Extracts the time as seconds of day, from 0 to 24 * 60 * 60 - 1. */
     constexpr int32_t toSecondOfDay() const { return SEC_PER_HOUR * _hour + SEC_PER_MIN * _minute + _second; }
+    /*!
+      @brief Returns a copy of this time with the time truncated.
+      @note Units greater than ChronoUnit::Days are treated as ChronoUnit::Days.
+     */
+    LocalTime truncatedTo(const ChronoUnit unit) const;
     /*!
       @brief Outputs this time as a String, such as 12:03.
       @param fmt Format specifier similar to std::strftime.
     */
     string_t toString(const char* fmt = nullptr) const;
 
-    /*! @brief Obtains the current time from the system clock in the default time-zone. */
+    /*! @brief Obtains the current time from the system clock in the default time-zone. (The context of the current thread if set) */
     static LocalTime now();
+    /*! @brief Obtains the current time from the system clock in the specified context. */
+    static LocalTime now(const ZoneContext& ctx);
     /*! @brief Obtains an instance of LocalTime from an hour, minute and second. */
     static constexpr LocalTime of(const int8_t hour, const int8_t minute = 0, const int8_t second = 0) { return LocalTime(hour, minute, second); }
     /*! @brief Obtains an instance of LocalTime from a second-of-day value. */
@@ -340,8 +384,20 @@ class ZoneOffset
     constexpr bool valid() const { return _seconds >= MIN_SEC && _seconds <= MAX_SEC; }
     /*!  @brief Outputs normalized offset as a String, such as +09:00 */
     string_t toString() const;
+    /*!
+      @brief Outputs normalized offset to the buffer without memory allocation.
+      @param[out] buf Output buffer (10 or more is enough for valid offsets)
+      @param len Size of the buffer
+      @return Length of the string without the terminator, or 0 if failed.
+      @note Quarter-hour offsets are copied from the precomputed table.
+     */
+    size_t toChars(char* buf, const size_t len) const;
 
-    /*! @brief Obtains an instance of ZoneOffset from a text string such as +09:00 or Z (means UTC). */
+    /*!
+      @brief Obtains an instance of ZoneOffset from a text string.
+      @param s "Z" (means UTC), "+hh", "+hhmm", "+hh:mm" or "+hh:mm:ss" (The sign applies to all components)
+      @return INVALID if failed. (e.g. trailing characters)
+     */
     static ZoneOffset of(const char* s);
     /*!
       @brief Obtains an instance of ZoneOffset using an offset in hours, minutes and seconds.
@@ -414,8 +470,10 @@ class OffsetTime
     /*! @brief Returns a copy of this OffsetTime with the specified offset ensuring that the result has the same local time. */
     OffsetTime withOffsetSameLocal(const ZoneOffset& zo) { return (zo != _zoff) ? OffsetTime(_lt, zo) : *this; }
 
-    /*! @brief Obtains the current time from the system clock in the default time-zone. */
+    /*! @brief Obtains the current time from the system clock in the default time-zone. (The context of the current thread if set) */
     static OffsetTime now();
+    /*! @brief Obtains the current time from the system clock in the specified context. */
+    static OffsetTime now(const ZoneContext& ctx);
     /*! @brief Obtains an instance of OffsetTime from an hour, minute, and second. */
     static constexpr OffsetTime of(const int8_t hour, const int8_t minute, const int8_t second, const ZoneOffset& zoff) { return OffsetTime(LocalTime(hour, minute, second), zoff); }
     /*! @brief Obtains an instance of OffsetTime from a local time and an offset. */
@@ -482,6 +540,8 @@ class LocalDateTime
     constexpr int8_t    month()      const { return _date.month();  } //!< @brief Gets the month.
     constexpr int8_t    day()        const { return _date.day(); } //!< @brief Gets the day.
     constexpr DayOfWeek dayOfWeek()  const { return _date.dayOfWeek(); } //!< @brief Gets the day of week, which is an enum DayOfWeek.
+    constexpr int8_t    isoWeek()    const { return _date.isoWeek(); } //!< @brief Gets the ISO-8601 week of week-based-year.
+    constexpr int16_t   weekBasedYear() const { return _date.weekBasedYear(); } //!< @brief Gets the ISO-8601 week-based-year.
     constexpr bool      isLeapYear() const { return _date.isLeapYear(); } //!< @brief Is leap year?
     constexpr int8_t    hour()       const { return _time.hour(); } //!< @brief Gets the hour.
     constexpr int8_t    hour12()     const { return _time.hour12(); } //!< @brief Gets the 12 hour clock [1-12]
@@ -505,6 +565,11 @@ class LocalDateTime
     constexpr LocalTime toLocalTime() const { return _time; }
     /*! @brief Extracts the time as seconds of day, from 0 to 24 * 60 * 60 - 1. */
     constexpr int32_t toSecondOfDay() const { return _time.toSecondOfDay(); }
+    /*!
+      @brief Returns a copy of this date-time with the date-time truncated.
+      @note ChronoUnit::Weeks truncates to Monday, ChronoUnit::Months to the first day of the month and ChronoUnit::Years to the first day of the year.
+     */
+    LocalDateTime truncatedTo(const ChronoUnit unit) const;
     /*!
       @brief Outputs this date-time as a String, such as 2009-08-07T12:34:56
       @param fmt Format specifier similar to std::strftime.
@@ -513,8 +578,10 @@ class LocalDateTime
     /*! @brief Converts this date-time to the struct tm. */
     struct tm toTm() const;
 
-    /*! @brief Obtains the current date-time from the system clock in the default time-zone. */
+    /*! @brief Obtains the current date-time from the system clock in the default time-zone. (The context of the current thread if set) */
     static LocalDateTime now();
+    /*! @brief Obtains the current date-time from the system clock in the specified context. */
+    static LocalDateTime now(const ZoneContext& ctx);
     /*! @brief Obtains an instance of LocalDateTime from year, month, day, hour, minute and second. */
     static constexpr LocalDateTime of(const int16_t year, const int8_t month, const int8_t day, const int8_t hour = 0, const int8_t minute = 0, const int8_t second = 0) { return LocalDateTime{{year, month, day}, {hour, minute, second}}; }
     /*! @brief Obtains an instance of LocalDateTime from a date and time. */
@@ -590,6 +657,8 @@ class OffsetDateTime
     constexpr LocalTime toLocalTime() const { return _datetime.toLocalTime(); }
     /*! @brief Converts this date-time to an {@code OffsetTime}. */
     OffsetTime toOffsetTime() const { return OffsetTime::of(_datetime.toLocalTime(), _zoff); }
+    /*! @brief Returns a copy of this OffsetDateTime with the local date-time truncated. The offset is not changed. */
+    OffsetDateTime truncatedTo(const ChronoUnit unit) const { return OffsetDateTime(_datetime.truncatedTo(unit), _zoff); }
     /*!
       @brief Outputs this date-time as a String, such as 2010-09-08T12:34:56+07:00
       @param fmt Format specifier similar to std::strftime.
@@ -600,8 +669,10 @@ class OffsetDateTime
     /*! @brief Returns a copy of this OffsetDateTime with the specified offset ensuring that the result has the same local date-time.*/
     constexpr OffsetDateTime withOffsetSameLocal(const ZoneOffset& zo) const { return OffsetDateTime(_datetime, zo); }
 
-    /*! @brief Obtains the current date-time from the system clock in the default time-zone. */
+    /*! @brief Obtains the current date-time from the system clock in the default time-zone. (The context of the current thread if set) */
     static OffsetDateTime now();
+    /*! @brief Obtains the current date-time from the system clock in the specified context. */
+    static OffsetDateTime now(const ZoneContext& ctx);
     /*! @brief Obtains an instance of OffsetDateTime from a date, time and offset. */
     static constexpr OffsetDateTime of(const LocalDate& ld, const LocalTime& lt, const ZoneOffset& zo) { return OffsetDateTime(ld, lt, zo); }
     /*! @brief Obtains an instance of OffsetDateTime from a date-time and offset. */
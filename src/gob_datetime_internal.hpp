@@ -0,0 +1,74 @@
+/*!
+  @file gob_datetime_internal.hpp
+  @brief Helpers shared by the translation units of the library.
+  @warning Internal use only. Not a part of the public API.
+*/
+#ifndef GOBLIB_DATETIME_INTERNAL_HPP
+#define GOBLIB_DATETIME_INTERNAL_HPP
+
+#include <cstdint>
+
+namespace goblib { namespace datetime { namespace detail {
+
+constexpr int64_t SEC_PER_MIN = 60;
+constexpr int64_t SEC_PER_HOUR = 60 * SEC_PER_MIN;
+constexpr int64_t SEC_PER_DAY = 24 * SEC_PER_HOUR;
+
+// Division rounded toward negative infinity. (b > 0)
+inline int64_t floorDiv(const int64_t a, const int64_t b)
+{
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+// Number of trailing zero bits. (v must not be 0)
+inline int ctz64(uint64_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(v);
+#else
+    int n = 0;
+    while(!(v & 1)) { v >>= 1; ++n; }
+    return n;
+#endif
+}
+
+// Writes 2 digits of v [0, 99].
+inline char* put2(char* p, const int v)
+{
+    static const char digits2[] =
+            "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839" "40414243444546474849"
+            "50515253545556575859" "60616263646566676869" "70717273747576777879" "80818283848586878889" "90919293949596979899";
+    p[0] = digits2[v * 2];
+    p[1] = digits2[v * 2 + 1];
+    return p + 2;
+}
+
+// Parses fixed digits, and advances p if succeeded.
+inline bool get(const char*& p, const int digits, int& v)
+{
+    v = 0;
+    for(int i = 0; i < digits; ++i)
+    {
+        const unsigned d = static_cast<unsigned char>(p[i]) - '0';
+        if(d > 9) { return false; }
+        v = v * 10 + static_cast<int>(d);
+    }
+    p += digits;
+    return true;
+}
+
+// Number of set bits.
+inline int popcount64(uint64_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(v);
+#else
+    int n = 0;
+    while(v) { v &= v - 1; ++n; }
+    return n;
+#endif
+}
+
+//
+}}}
+#endif
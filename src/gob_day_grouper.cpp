@@ -0,0 +1,45 @@
+/*!
+  @file gob_day_grouper.cpp
+  @brief Streaming group-by-local-day over epochs in a zone.
+*/
+#include "gob_day_grouper.hpp"
+
+namespace goblib { namespace datetime {
+
+time_t LocalDayGrouper::startOfDay(const LocalDate& ld, const ZoneRules& rules)
+{
+    // The end of the gap if the midnight is skipped, and the earlier if repeated.
+    return rules.resolve(LocalDateTime(ld, LocalTime(0, 0, 0)), ResolvePolicy::ShiftForward).epochSecond();
+}
+
+bool LocalDayGrouper::startGroup(const time_t epoch)
+{
+    const LocalDate ld = LocalDateTime::ofEpochSecond(epoch, _rules.offset(epoch)).toLocalDate();
+    const int32_t eod = ld.toEpochDay();
+    // The next day of the sorted stream starts at the precomputed midnight.
+    const time_t start = (_length && eod == _day.toEpochDay() + 1) ? nextMidnight() : startOfDay(ld, _rules);
+    const time_t end = startOfDay(LocalDate::ofEpochDay(eod + 1), _rules);
+    const bool started = !(_length && ld == _day);
+    _day = ld;
+    _start = start;
+    _length = static_cast<uint64_t>(static_cast<int64_t>(end) - static_cast<int64_t>(start));
+    _count = started ? 1 : _count + 1;
+    return started;
+}
+
+size_t localDayBoundaries(size_t* starts, LocalDate* days, const time_t* epochs, const size_t n, const ZoneRules& rules)
+{
+    LocalDayGrouper grouper(rules);
+    size_t groups{};
+    for(size_t i = 0; i < n; ++i)
+    {
+        if(!grouper.push(epochs[i])) { continue; }
+        starts[groups] = i;
+        if(days) { days[groups] = grouper.day(); }
+        ++groups;
+    }
+    return groups;
+}
+
+//
+}}
@@ -0,0 +1,99 @@
+/*!
+  @file gob_day_grouper.hpp
+  @brief Streaming group-by-local-day over epochs in a zone.
+
+  @code
+  LocalDayGrouper grouper(ZoneRules::ofLocation("America/New_York"));
+  for(auto& ev : events)
+  {
+      if(grouper.push(ev.epoch) && !report.empty()) { flush(report); } // ev starts a new local day
+      report.day = grouper.day();
+      report.add(ev);
+  }
+
+  // Or bulk
+  std::vector<size_t> starts(epochs.size());
+  std::vector<LocalDate> days(epochs.size());
+  auto groups = localDayBoundaries(starts.data(), days.data(), epochs.data(), epochs.size(), rules);
+  @endcode
+  @note The start and the next midnight of the current day are precomputed, so an epoch in the same day costs one compare.
+  @note The day is from its start to the start of the next day, which may be 23 or 25 hours long on the DST transitions. The start of a day is the first instant of its midnight, or the end of the gap if the midnight is skipped.
+*/
+#ifndef GOBLIB_DAY_GROUPER_HPP
+#define GOBLIB_DAY_GROUPER_HPP
+
+#include "gob_datetime.hpp"
+#include "gob_zone_rules.hpp"
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class LocalDayGrouper
+  @brief Splits a stream of epochs into runs of the same local day.
+  @note Groups are consecutive runs. Unsorted epochs that come back to a previous day start a new group.
+ */
+class LocalDayGrouper
+{
+  public:
+    ///@name Constructors
+    ///@{
+    LocalDayGrouper() {} // UTC
+    explicit LocalDayGrouper(const ZoneRules& rules) : _rules(rules) {}
+    ///@}
+
+    ///@name Properties
+    ///@{
+    const ZoneRules& rules() const { return _rules; } //!< @brief Gets the zone rules.
+    LocalDate day()     const { return _day; } //!< @brief Gets the local day of the current group. (Invalid before the first push)
+    time_t dayStart()     const { return _start; } //!< @brief Gets the epoch of the start of the current day.
+    time_t nextMidnight() const { return static_cast<time_t>(_start + static_cast<int64_t>(_length)); } //!< @brief Gets the epoch of the start of the next day.
+    int32_t lengthOfDaySeconds() const { return static_cast<int32_t>(_length); } //!< @brief Gets the length of the current day in seconds. (86400, or 82800 and 90000 on the DST transitions)
+    size_t count() const { return _count; } //!< @brief Gets the number of the epochs in the current group.
+    ///@}
+
+    /*!
+      @brief Feeds the epoch.
+      @retval true The epoch starts a new group. (The first epoch or another local day)
+      @retval false The epoch is in the current group.
+     */
+    bool push(const time_t epoch)
+    {
+        // Unsigned, so an epoch before the start is out of range too.
+        if(static_cast<uint64_t>(static_cast<int64_t>(epoch) - static_cast<int64_t>(_start)) < _length)
+        {
+            ++_count;
+            return false;
+        }
+        return startGroup(epoch);
+    }
+    /*! @brief Clears the current group. The next push starts a new group. */
+    void reset() { *this = LocalDayGrouper(_rules); }
+
+    /*! @brief Gets the epoch of the start of the local day in the zone. */
+    static time_t startOfDay(const LocalDate& ld, const ZoneRules& rules);
+
+  private:
+    bool startGroup(const time_t epoch);
+
+    ZoneRules _rules{};
+    LocalDate _day{0, 0, 0};
+    time_t _start{};
+    uint64_t _length{}; // Empty until the first push
+    size_t _count{};
+};
+
+/*!
+  @brief Splits the epochs into runs of the same local day. (Bulk version of LocalDayGrouper)
+  @param[out] starts Indexes of the first epoch of each group. (n at most)
+  @param[out] days Local day of each group if not nullptr. (n at most)
+  @param epochs Epochs
+  @param n Number of the epochs
+  @param rules Zone rules
+  @return Number of the groups. The group k is [starts[k], starts[k + 1]) and the last ends at n.
+ */
+size_t localDayBoundaries(size_t* starts, LocalDate* days, const time_t* epochs, const size_t n, const ZoneRules& rules);
+
+//
+}}
+#endif
@@ -0,0 +1,20 @@
+/*!
+  @file gob_epoch_date.cpp
+  @brief A date stored as the epoch day, for code where date arithmetic dominates field access.
+*/
+#include "gob_epoch_date.hpp"
+
+namespace goblib { namespace datetime {
+
+// for GCC C++11,C++14
+#if !defined(__clang__) && defined(__GNUG__) && __cplusplus < 201703L
+constexpr int32_t EpochDate::MIN_EPOCH_DAY;
+constexpr int32_t EpochDate::MAX_EPOCH_DAY;
+constexpr int32_t EpochDate::INVALID_EPOCH_DAY;
+#endif
+
+const EpochDate EpochDate::MIN(MIN_EPOCH_DAY);
+const EpochDate EpochDate::MAX(MAX_EPOCH_DAY);
+
+//
+}}
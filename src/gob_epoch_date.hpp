@@ -0,0 +1,122 @@
+/*!
+  @file gob_epoch_date.hpp
+  @brief A date stored as the epoch day, for code where date arithmetic dominates field access.
+
+  @code
+  EpochDate ed(LocalDate(2022, 12, 13));
+  ed.toEpochDay(); // 19339
+  (ed + 30).toString(); // "2023-01-12"
+  ed.daysUntil(EpochDate(2023, 1, 1)); // 19
+  ed.dayOfWeek(); // DayOfWeek::Tue
+  @endcode
+  @note Comparison, arithmetic and day of week are computed from the epoch day only.
+  Year, month and day are derived on demand, so use toLocalDate() to get them at once.
+*/
+#ifndef GOBLIB_EPOCH_DATE_HPP
+#define GOBLIB_EPOCH_DATE_HPP
+
+#include "gob_datetime.hpp"
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class EpochDate
+  @brief A date without a time-zone, stored as the epoch day. (Interconvertible with LocalDate)
+  @note Same range as LocalDate.
+ */
+class EpochDate
+{
+  public:
+    ///@name Constructors
+    ///@{
+    constexpr EpochDate() {}
+    constexpr explicit EpochDate(const int32_t epochDay) : _epochDay(epochDay) {}
+    explicit EpochDate(const LocalDate& ld) : _epochDay(ld.valid() ? ld.toEpochDay() : INVALID_EPOCH_DAY) {}
+    EpochDate(const int16_t y, const int8_t m, const int8_t d) : EpochDate(LocalDate(y, m, d)) {}
+    ///@}
+
+    ///@name Properties
+    ///@{
+    int16_t year()  const { return toLocalDate().year();  } //!< @brief Gets the year.
+    int8_t  month() const { return toLocalDate().month(); } //!< @brief Gets the month.
+    int8_t  day()   const { return toLocalDate().day();   } //!< @brief Gets the day of month.
+    constexpr DayOfWeek dayOfWeek() const { return static_cast<DayOfWeek>((_epochDay % 7 + 11) % 7); } //!< @brief Gets the day of week, which is an enum DayOfWeek.
+    ///@}
+
+    /*! @brief Is valid instance? */
+    constexpr bool valid() const { return _epochDay >= MIN_EPOCH_DAY && _epochDay <= MAX_EPOCH_DAY; }
+    /*! @brief Gets the epoch day. */
+    constexpr int32_t toEpochDay() const { return _epochDay; }
+    /*! @brief Gets the epoch second of the start of this date at the offset. */
+    constexpr time_t toEpochSecond(const ZoneOffset& zo = ZoneOffset::UTC) const { return static_cast<time_t>(_epochDay) * 86400 - zo.totalSeconds(); }
+    /*! @brief Converts to LocalDate. */
+    LocalDate toLocalDate() const { return valid() ? LocalDate::ofEpochDay(_epochDay) : LocalDate(0, 0, 0); }
+    /*! @brief Combines this date with the time of midnight to create a LocalDateTime at the start of this date. */
+    LocalDateTime atStartOfDay() const { return toLocalDate().atStartOfDay(); }
+    /*! @brief Combines this date with a time to create a LocalDateTime. */
+    LocalDateTime atTime(const LocalTime& lt) const { return toLocalDate().atTime(lt); }
+    /*!
+      @brief Outputs this date as a String, such as 2009-08-07
+      @param fmt Format specifier similar to std::strftime.
+     */
+    string_t toString(const char* fmt = nullptr) const { return toLocalDate().toString(fmt); }
+
+    ///@name Arithmetic
+    ///@{
+    constexpr EpochDate plusDays(const int32_t days)   const { return EpochDate(_epochDay + days); } //!< @brief Returns a copy of this date with the specified number of days added.
+    constexpr EpochDate minusDays(const int32_t days)  const { return EpochDate(_epochDay - days); } //!< @brief Returns a copy of this date with the specified number of days subtracted.
+    constexpr EpochDate plusWeeks(const int32_t weeks) const { return EpochDate(_epochDay + weeks * 7); } //!< @brief Returns a copy of this date with the specified number of weeks added.
+    constexpr int32_t daysUntil(const EpochDate& end)  const { return end._epochDay - _epochDay; } //!< @brief Calculates the number of days until the end date. (Negative if end is before)
+    /*! @brief Gets the date of the day of week on or before this date. (e.g. the start of the week) */
+    constexpr EpochDate previousOrSame(const DayOfWeek dow) const { return EpochDate(_epochDay - (static_cast<int32_t>(dayOfWeek()) - static_cast<int32_t>(dow) + 7) % 7); }
+    /*! @brief Gets the date of the day of week on or after this date. */
+    constexpr EpochDate nextOrSame(const DayOfWeek dow) const { return EpochDate(_epochDay + (static_cast<int32_t>(dow) - static_cast<int32_t>(dayOfWeek()) + 7) % 7); }
+    ///@}
+
+    EpochDate& operator+=(const int32_t days) { _epochDay += days; return *this; }
+    EpochDate& operator-=(const int32_t days) { _epochDay -= days; return *this; }
+    EpochDate& operator++() { ++_epochDay; return *this; }
+    EpochDate& operator--() { --_epochDay; return *this; }
+    friend constexpr EpochDate operator+(const EpochDate& a, const int32_t days) { return a.plusDays(days); }
+    friend constexpr EpochDate operator-(const EpochDate& a, const int32_t days) { return a.minusDays(days); }
+    friend constexpr int32_t operator-(const EpochDate& a, const EpochDate& b) { return b.daysUntil(a); }
+
+    /*! @brief Obtains the current date from the system clock in the default time-zone. (The context of the current thread if set)*/
+    static EpochDate now() { return EpochDate(LocalDate::now()); }
+    /*! @brief Obtains an instance of EpochDate from the epoch day count. */
+    static constexpr EpochDate ofEpochDay(const int32_t eod) { return EpochDate(eod); }
+    /*! @brief Obtains an instance of EpochDate from a year, month and day. */
+    static EpochDate of(const int16_t y, const int8_t m = 1, const int8_t d = 1) { return EpochDate(y, m, d); }
+    /*! @brief Obtains an instance of EpochDate from a text string such as 2009-08-07. */
+    static EpochDate parse(const char* s) { return EpochDate(LocalDate::parse(s)); }
+
+#if __cplusplus < 202002L
+    friend inline bool operator==(const EpochDate& a, const EpochDate& b) { return a._epochDay == b._epochDay; }
+    friend inline bool operator< (const EpochDate& a, const EpochDate& b) { return a._epochDay <  b._epochDay; }
+    friend inline bool operator!=(const EpochDate& a, const EpochDate& b) { return std::rel_ops::operator!=(a,b); }
+    friend inline bool operator> (const EpochDate& a, const EpochDate& b) { return std::rel_ops::operator> (a,b); }
+    friend inline bool operator<=(const EpochDate& a, const EpochDate& b) { return std::rel_ops::operator<=(a,b); }
+    friend inline bool operator>=(const EpochDate& a, const EpochDate& b) { return std::rel_ops::operator>=(a,b); }
+#else
+    auto operator <=>(const EpochDate&) const = default;
+#endif
+
+  public:
+    static const EpochDate MIN; //!< @brief The minimum supported date. (Same as LocalDate::MIN)
+    static const EpochDate MAX; //!< @brief The maximum supported date. (Same as LocalDate::MAX)
+
+  private:
+    int32_t _epochDay{};
+
+    static constexpr int32_t MIN_EPOCH_DAY = 0; // 1970-01-01
+#ifdef GOBLIB_DATETIME_USE_TIME_T_32BIT
+    static constexpr int32_t MAX_EPOCH_DAY = 24855; // 2038-01-19
+#else
+    static constexpr int32_t MAX_EPOCH_DAY = 11248737; // 32767-12-31
+#endif
+    static constexpr int32_t INVALID_EPOCH_DAY = INT32_MIN;
+};
+
+//
+}}
+#endif
@@ -0,0 +1,165 @@
+/*!
+  @file gob_http_date.cpp
+  @brief HTTP-date (IMF-fixdate) format and parse, and the cache for the Date header.
+*/
+#include "gob_http_date.hpp"
+#include "gob_datetime_internal.hpp"
+#include "gob_instrumentation.hpp"
+#include <cstring>
+
+namespace
+{
+using goblib::datetime::LocalDate;
+using goblib::datetime::LocalDateTime;
+using goblib::datetime::OffsetDateTime;
+using goblib::datetime::ZoneOffset;
+using goblib::datetime::detail::SEC_PER_DAY;
+using goblib::datetime::detail::floorDiv;
+using goblib::datetime::detail::put2;
+using goblib::datetime::detail::get;
+
+const char dayNames[7][4] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+const char* const longDayNames[7] = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
+const char monthNames[12][4] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+inline bool match(const char*& p, const char* s)
+{
+    const size_t len = std::strlen(s);
+    if(std::strncmp(p, s, len)) { return false; }
+    p += len;
+    return true;
+}
+
+bool getDayName(const char*& p)
+{
+    for(auto& n : dayNames) { if(match(p, n)) { return true; } }
+    return false;
+}
+
+bool getLongDayName(const char*& p)
+{
+    for(auto& n : longDayNames) { if(match(p, n)) { return true; } }
+    return false;
+}
+
+bool getMonth(const char*& p, int& month)
+{
+    for(int i = 0; i < 12; ++i)
+    {
+        if(match(p, monthNames[i])) { month = i + 1; return true; }
+    }
+    return false;
+}
+
+// hh:mm:ss
+bool getTime(const char*& p, int& h, int& m, int& s)
+{
+    return get(p, 2, h) && *p++ == ':' && get(p, 2, m) && *p++ == ':' && get(p, 2, s);
+}
+
+OffsetDateTime makeUTC(const int y, const int mo, const int d, const int h, const int mi, const int s)
+{
+    OffsetDateTime odt(LocalDateTime(y, mo, d, h, mi, s), ZoneOffset::UTC);
+    return (odt.valid() && mi < 60) ? odt : OffsetDateTime(LocalDateTime(LocalDate(0, 0, 0), {}), ZoneOffset::UTC);
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+size_t formatHttpDate(char* buf, const size_t len, const time_t epoch)
+{
+    GOBLIB_DATETIME_PROBE(FormatHttpDate);
+    if(!buf || len < HTTP_DATE_BUFFER_SIZE) { return 0; }
+    const int64_t days = floorDiv(epoch, SEC_PER_DAY);
+    const int32_t sod = static_cast<int32_t>(epoch - days * SEC_PER_DAY);
+    const LocalDate ld = LocalDate::ofEpochDay(static_cast<int32_t>(days));
+    if(ld.year() < 0 || ld.year() > 9999) { return 0; }
+
+    // "Sun, 06 Nov 1994 08:49:37 GMT"
+    char* p = buf;
+    std::memcpy(p, dayNames[(days % 7 + 11) % 7], 3); // 1970-01-01 is Thursday.
+    p += 3;
+    *p++ = ',';
+    *p++ = ' ';
+    p = put2(p, ld.day());
+    *p++ = ' ';
+    std::memcpy(p, monthNames[ld.month() - 1], 3);
+    p += 3;
+    *p++ = ' ';
+    p = put2(p, ld.year() / 100);
+    p = put2(p, ld.year() % 100);
+    *p++ = ' ';
+    p = put2(p, sod / 3600);
+    *p++ = ':';
+    p = put2(p, sod / 60 % 60);
+    *p++ = ':';
+    p = put2(p, sod % 60);
+    std::memcpy(p, " GMT", 5);
+    return p + 4 - buf;
+}
+
+OffsetDateTime parseHttpDate(const char* s)
+{
+    GOBLIB_DATETIME_PROBE(ParseHttpDate);
+    const OffsetDateTime invalid(LocalDateTime(LocalDate(0, 0, 0), {}), ZoneOffset::UTC);
+    if(!s) { return invalid; }
+    int y, mo, d, h, mi, sec;
+    const char* p = s;
+
+    // IMF-fixdate
+    if(getDayName(p) && *p == ',')
+    {
+        ++p;
+        if(*p++ == ' ' && get(p, 2, d) && *p++ == ' ' && getMonth(p, mo) && *p++ == ' ' && get(p, 4, y) && *p++ == ' '
+           && getTime(p, h, mi, sec) && match(p, " GMT"))
+        {
+            return makeUTC(y, mo, d, h, mi, sec);
+        }
+        return invalid;
+    }
+    // asctime
+    p = s;
+    if(getDayName(p) && *p == ' ')
+    {
+        ++p;
+        if(getMonth(p, mo) && *p++ == ' ')
+        {
+            if(*p == ' ') { ++p; if(!get(p, 1, d)) { return invalid; } }
+            else if(!get(p, 2, d)) { return invalid; }
+            if(*p++ == ' ' && getTime(p, h, mi, sec) && *p++ == ' ' && get(p, 4, y))
+            {
+                return makeUTC(y, mo, d, h, mi, sec);
+            }
+        }
+        return invalid;
+    }
+    // RFC 850
+    p = s;
+    if(getLongDayName(p) && match(p, ", ") && get(p, 2, d) && *p++ == '-' && getMonth(p, mo) && *p++ == '-' && get(p, 2, y) && *p++ == ' '
+       && getTime(p, h, mi, sec) && match(p, " GMT"))
+    {
+        return makeUTC(y + (y < 70 ? 2000 : 1900), mo, d, h, mi, sec);
+    }
+    return invalid;
+}
+
+// ----------------------------------------------------------------------
+// class HttpDateCache
+const char* HttpDateCache::get(const time_t epoch)
+{
+    if(_valid && epoch == _epoch) { return _buf; }
+    if(_valid && floorDiv(epoch, 60) == floorDiv(_epoch, 60))
+    {
+        put2(_buf + 23, static_cast<int>(epoch - floorDiv(epoch, 60) * 60)); // Rewrite second only. "Sun, 06 Nov 1994 08:49:[37] GMT"
+    }
+    else
+    {
+        _valid = formatHttpDate(_buf, sizeof(_buf), epoch) != 0;
+        if(!_valid) { _buf[0] = '\0'; }
+    }
+    _epoch = epoch;
+    return _buf;
+}
+//
+}}
@@ -0,0 +1,69 @@
+/*!
+  @file gob_http_date.hpp
+  @brief HTTP-date (IMF-fixdate) format and parse, and the cache for the Date header.
+
+  @code
+  static HttpDateCache dateCache;
+  client.printf("Date: %s\r\n", dateCache.now()); // "Sun, 06 Nov 1994 08:49:37 GMT"
+
+  auto ims = parseHttpDate(request.header("If-Modified-Since").c_str());
+  if(ims.valid() && lastModified <= ims.toEpochSecond()) { ... } // 304 Not Modified
+  @endcode
+*/
+#ifndef GOBLIB_HTTP_DATE_HPP
+#define GOBLIB_HTTP_DATE_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+constexpr size_t HTTP_DATE_BUFFER_SIZE = 30; //!< @brief Buffer size of IMF-fixdate including the terminator.
+
+/*!
+  @brief Outputs IMF-fixdate such as "Sun, 06 Nov 1994 08:49:37 GMT".
+  @param[out] buf Output buffer (HTTP_DATE_BUFFER_SIZE or more)
+  @param len Size of the buffer
+  @param epoch Epoch
+  @return Length of the string without the terminator, or 0 if failed.
+  @note Uses fixed English name tables, not strftime and the locale.
+  @sa RFC 9110 5.6.7 Date/Time Formats
+ */
+size_t formatHttpDate(char* buf, const size_t len, const time_t epoch);
+/*! @brief Outputs IMF-fixdate of the date-time. (Converted to GMT) */
+inline size_t formatHttpDate(char* buf, const size_t len, const OffsetDateTime& odt) { return formatHttpDate(buf, len, odt.toEpochSecond()); }
+
+/*!
+  @brief Parses HTTP-date.
+  @param s IMF-fixdate "Sun, 06 Nov 1994 08:49:37 GMT", obsolete RFC 850 "Sunday, 06-Nov-94 08:49:37 GMT" or asctime "Sun Nov  6 08:49:37 1994"
+  @return OffsetDateTime in UTC, or invalid instance if failed.
+  @note Two digit year of RFC 850 is interpreted as 1970-2069.
+  @note Names are case-sensitive. The day name is checked but not compared with the date.
+ */
+OffsetDateTime parseHttpDate(const char* s);
+
+/*!
+  @class HttpDateCache
+  @brief Caches IMF-fixdate of the current second for the Date header.
+  @note The string is rebuilt only when the second changes, and only the second digits are rewritten within the same minute.
+  @warning Not thread-safe. Use an instance for each thread (or task).
+ */
+class HttpDateCache
+{
+  public:
+    HttpDateCache() { _buf[0] = '\0'; }
+
+    /*! @brief Gets IMF-fixdate of the epoch. The pointer is valid until the next call. */
+    const char* get(const time_t epoch);
+    /*! @brief Gets IMF-fixdate of the current time. (std::time) */
+    const char* now() { return get(std::time(nullptr)); }
+
+  private:
+    time_t _epoch{};
+    bool _valid{};
+    char _buf[HTTP_DATE_BUFFER_SIZE];
+};
+
+//
+}}
+#endif
@@ -0,0 +1,87 @@
+/*!
+  @file gob_instrumentation.cpp
+  @brief Optional counters and time histograms of libc fallbacks and hot operations.
+*/
+#include "gob_instrumentation.hpp"
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+#include <atomic>
+#endif
+
+namespace
+{
+using goblib::datetime::PROBE_COUNT;
+using goblib::datetime::PROBE_HISTOGRAM_SIZE;
+
+const char* const probeNames[PROBE_COUNT] =
+{
+    "strptime", "strftime", "mktime", "localtime", "string alloc",
+    "now",
+    "LocalDate::parse", "LocalTime::parse", "LocalDateTime::parse", "OffsetTime::parse", "OffsetDateTime::parse", "ZoneOffset::of",
+    "LocalDate::toString", "LocalTime::toString", "LocalDateTime::toString", "ZoneOffset::toChars",
+    "LocalDateTime::ofEpochSecond", "LocalDateTime::toEpochSecond", "ZoneRules::offset", "ZoneRules::toEpochSecond",
+    "parseRFC3339", "formatRFC3339", "parseHttpDate", "formatHttpDate",
+};
+
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+// Zero-initialized as static storage.
+std::atomic<uint64_t> counts[PROBE_COUNT];
+std::atomic<uint64_t> nanos[PROBE_COUNT];
+std::atomic<uint64_t> histograms[PROBE_COUNT][PROBE_HISTOGRAM_SIZE];
+
+// < 64ns : 0, < 256ns : 1, < 1us : 2 ... >= 256us : 7
+inline uint8_t bucket(uint64_t ns)
+{
+    uint8_t b = 0;
+    for(ns >>= 6; ns && b < PROBE_HISTOGRAM_SIZE - 1; ns >>= 2) { ++b; }
+    return b;
+}
+#endif
+//
+}
+
+namespace goblib { namespace datetime {
+
+const char* probeName(const Probe p)
+{
+    const uint8_t i = static_cast<uint8_t>(p);
+    return (i < PROBE_COUNT) ? probeNames[i] : "";
+}
+
+ProbeSnapshot probeSnapshot()
+{
+    ProbeSnapshot snap{};
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+    for(uint8_t i = 0; i < PROBE_COUNT; ++i)
+    {
+        auto& s = snap.stats[i];
+        s.count = counts[i].load(std::memory_order_relaxed);
+        s.nanos = nanos[i].load(std::memory_order_relaxed);
+        for(uint8_t b = 0; b < PROBE_HISTOGRAM_SIZE; ++b) { s.histogram[b] = histograms[i][b].load(std::memory_order_relaxed); }
+    }
+#endif
+    return snap;
+}
+
+void resetProbes()
+{
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+    for(uint8_t i = 0; i < PROBE_COUNT; ++i)
+    {
+        counts[i].store(0, std::memory_order_relaxed);
+        nanos[i].store(0, std::memory_order_relaxed);
+        for(auto& h : histograms[i]) { h.store(0, std::memory_order_relaxed); }
+    }
+#endif
+}
+
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+void recordProbe(const Probe p, const uint64_t ns)
+{
+    const uint8_t i = static_cast<uint8_t>(p);
+    counts[i].fetch_add(1, std::memory_order_relaxed);
+    nanos[i].fetch_add(ns, std::memory_order_relaxed);
+    histograms[i][bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+}
+#endif
+//
+}}
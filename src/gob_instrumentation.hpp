@@ -0,0 +1,138 @@
+/*!
+  @file gob_instrumentation.hpp
+  @brief Optional counters and time histograms of libc fallbacks and hot operations.
+
+  Define GOBLIB_DATETIME_ENABLE_INSTRUMENTATION to enable. Otherwise the probes compile to nothing and the snapshot is always zero.
+  @code
+  auto snap = probeSnapshot();
+  for(uint8_t i = 0; i < PROBE_COUNT; ++i)
+  {
+      auto& s = snap.stats[i];
+      printf("%s: %llu calls %llu ns\n", probeName(static_cast<Probe>(i)), (unsigned long long)s.count, (unsigned long long)s.nanos);
+  }
+  @endcode
+*/
+#ifndef GOBLIB_INSTRUMENTATION_HPP
+#define GOBLIB_INSTRUMENTATION_HPP
+
+#include <cstdint>
+#include <cstddef>
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+#include <chrono>
+#endif
+
+namespace goblib { namespace datetime {
+
+/*!
+  @enum Probe
+  @brief Instrumented call sites.
+*/
+enum class Probe : uint8_t
+{
+    // libc fallbacks
+    Strptime,    //!< @brief strptime in parse
+    Strftime,    //!< @brief strftime in toString
+    Mktime,      //!< @brief mktime in now() (process TZ)
+    Localtime,   //!< @brief localtime_r in now() (process TZ)
+    StringAlloc, //!< @brief Construction of string_t by toString
+    // Public APIs
+    Now,                 //!< @brief Reading the system clock by now() of each class
+    ParseLocalDate,      //!< @brief LocalDate::parse
+    ParseLocalTime,      //!< @brief LocalTime::parse
+    ParseLocalDateTime,  //!< @brief LocalDateTime::parse
+    ParseOffsetTime,     //!< @brief OffsetTime::parse (includes ParseZoneOffset)
+    ParseOffsetDateTime, //!< @brief OffsetDateTime::parse (includes ParseZoneOffset)
+    ParseZoneOffset,     //!< @brief ZoneOffset::of(const char*)
+    FormatLocalDate,     //!< @brief LocalDate::toString
+    FormatLocalTime,     //!< @brief LocalTime::toString (OffsetTime::toString also counts FormatZoneOffset)
+    FormatLocalDateTime, //!< @brief LocalDateTime::toString (OffsetDateTime::toString also counts FormatZoneOffset)
+    FormatZoneOffset,    //!< @brief ZoneOffset::toChars (ZoneOffset::toString calls it)
+    EpochToLocal,        //!< @brief LocalDateTime::ofEpochSecond
+    LocalToEpoch,        //!< @brief LocalDateTime::toEpochSecond
+    ZoneRulesOffset,     //!< @brief ZoneRules::offset
+    ZoneRulesToEpoch,    //!< @brief ZoneRules::toEpochSecond
+    ParseRFC3339,        //!< @brief parseRFC3339
+    FormatRFC3339,       //!< @brief formatRFC3339
+    ParseHttpDate,       //!< @brief parseHttpDate
+    FormatHttpDate,      //!< @brief formatHttpDate
+};
+constexpr uint8_t PROBE_COUNT = static_cast<uint8_t>(Probe::FormatHttpDate) + 1; //!< @brief Number of the probes.
+
+/*!
+  @brief Number of the histogram buckets.
+  @note Bucket i counts the calls shorter than 64 * 4^i ns. (64ns, 256ns, 1us, 4us, 16us, 64us, 256us) The last is the rest.
+ */
+constexpr uint8_t PROBE_HISTOGRAM_SIZE = 8;
+
+/*!
+  @struct ProbeStats
+  @brief Statistics of a probe.
+ */
+struct ProbeStats
+{
+    uint64_t count;  //!< @brief Number of calls
+    uint64_t nanos;  //!< @brief Cumulative time in nanoseconds
+    uint64_t histogram[PROBE_HISTOGRAM_SIZE]; //!< @brief Number of calls by time
+};
+
+/*!
+  @struct ProbeSnapshot
+  @brief Statistics of all the probes.
+ */
+struct ProbeSnapshot
+{
+    ProbeStats stats[PROBE_COUNT];
+    const ProbeStats& operator[](const Probe p) const { return stats[static_cast<uint8_t>(p)]; }
+};
+
+/*! @brief Is the instrumentation compiled in? */
+constexpr bool instrumentationEnabled()
+{
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/*! @brief Gets the name of the probe. */
+const char* probeName(const Probe p);
+/*!
+  @brief Gets the statistics of all the probes.
+  @note Each value is read atomically, but the snapshot as a whole is not. (Relaxed ordering)
+ */
+ProbeSnapshot probeSnapshot();
+/*! @brief Resets the statistics. */
+void resetProbes();
+
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+/*! @brief Records a call. */
+void recordProbe(const Probe p, const uint64_t nanos);
+
+/*!
+  @class ScopedProbe
+  @brief Records the call and the elapsed time of the scope.
+ */
+class ScopedProbe
+{
+  public:
+    explicit ScopedProbe(const Probe p) : _probe(p), _start(std::chrono::steady_clock::now()) {}
+    ~ScopedProbe()
+    {
+        recordProbe(_probe, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count());
+    }
+    ScopedProbe(const ScopedProbe&) = delete;
+    ScopedProbe& operator=(const ScopedProbe&) = delete;
+
+  private:
+    Probe _probe;
+    std::chrono::steady_clock::time_point _start;
+};
+# define GOBLIB_DATETIME_PROBE(p) ::goblib::datetime::ScopedProbe _gobProbe(::goblib::datetime::Probe::p)
+#else
+# define GOBLIB_DATETIME_PROBE(p) do {} while(0)
+#endif
+
+//
+}}
+#endif
@@ -0,0 +1,106 @@
+/*!
+  @file gob_iso_week.cpp
+  @brief ISO-8601 week date ("YYYY-Www-D") format, parse and bulk week numbers, without strftime.
+*/
+#include "gob_iso_week.hpp"
+#include "gob_datetime_internal.hpp"
+
+namespace
+{
+using goblib::datetime::LocalDate;
+using goblib::datetime::detail::SEC_PER_DAY;
+using goblib::datetime::detail::floorDiv;
+using goblib::datetime::detail::get;
+
+// ISO day of week of the epoch day [0(Mon) - 6(Sun)] (1970-01-01 is Thursday)
+inline int32_t isoDow0(const int32_t ed)
+{
+    const int32_t r = (ed + 3) % 7;
+    return r < 0 ? r + 7 : r;
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+LocalDate ofIsoWeekDate(const int16_t wby, const int8_t week, const int8_t dow)
+{
+    if(week < 1 || week > LocalDate::weeksInWeekBasedYear(wby) || dow < 1 || dow > 7) { return LocalDate(0, 0, 0); }
+    // January 4 is always in week 1.
+    const int32_t jan4 = LocalDate(wby, 1, 4).toEpochDay();
+    const int32_t ed = jan4 - isoDow0(jan4) + (week - 1) * 7 + (dow - 1);
+    auto ld = LocalDate::ofEpochDay(ed);
+    return (ld.valid() && !(LocalDate::MAX < ld)) ? ld : LocalDate(0, 0, 0);
+}
+
+size_t formatIsoWeekDate(char* buf, const size_t len, const LocalDate& ld)
+{
+    if(!buf || len < ISO_WEEK_DATE_BUFFER_SIZE || !ld.valid()) { return 0; }
+    const int16_t y = ld.weekBasedYear();
+    if(y < 0 || y > 9999) { return 0; }
+    const int8_t w = ld.isoWeek();
+    buf[0] = '0' + y / 1000;
+    buf[1] = '0' + y / 100 % 10;
+    buf[2] = '0' + y / 10 % 10;
+    buf[3] = '0' + y % 10;
+    buf[4] = '-';
+    buf[5] = 'W';
+    buf[6] = '0' + w / 10;
+    buf[7] = '0' + w % 10;
+    buf[8] = '-';
+    buf[9] = '0' + ld.isoDayOfWeek();
+    buf[10] = '\0';
+    return 10;
+}
+
+LocalDate parseIsoWeekDate(const char* s, const char** end)
+{
+    if(!s) { return LocalDate(0, 0, 0); }
+    const char* p = s;
+    int y, w, d = 1;
+    if(!get(p, 4, y)) { return LocalDate(0, 0, 0); }
+    const bool extended = (*p == '-');
+    p += extended;
+    if(*p++ != 'W' || !get(p, 2, w)) { return LocalDate(0, 0, 0); }
+    // Optional day
+    if(extended ? (p[0] == '-' && static_cast<unsigned>(p[1] - '0') <= 9) : (static_cast<unsigned>(p[0] - '0') <= 9))
+    {
+        p += extended;
+        d = *p++ - '0';
+    }
+    auto ld = ofIsoWeekDate(y, w, d);
+    if(ld.valid() && end) { *end = p; }
+    return ld;
+}
+
+void isoWeeks(int8_t* weeks, int16_t* years, const LocalDate* dates, const size_t n)
+{
+    for(size_t i = 0; i < n; ++i) { weeks[i] = dates[i].isoWeek(); }
+    if(years)
+    {
+        for(size_t i = 0; i < n; ++i) { years[i] = dates[i].weekBasedYear(); }
+    }
+}
+
+void isoWeekKeys(int32_t* out, const time_t* epochs, const size_t n, const ZoneOffset& zo)
+{
+    const int64_t offset = zo.totalSeconds();
+    // Reuse the year of the previous epoch while in the same week.
+    int32_t prevMonday = INT32_MIN, prevKey = 0;
+    for(size_t i = 0; i < n; ++i)
+    {
+        const int32_t ed = static_cast<int32_t>(floorDiv(static_cast<int64_t>(epochs[i]) + offset, SEC_PER_DAY));
+        const int32_t monday = ed - isoDow0(ed);
+        if(monday != prevMonday)
+        {
+            // The week belongs to the year of its Thursday.
+            const auto thu = LocalDate::ofEpochDay(monday + 3);
+            prevKey = thu.year() * 100 + thu.dayOfYear() / 7 + 1;
+            prevMonday = monday;
+        }
+        out[i] = prevKey;
+    }
+}
+
+//
+}}
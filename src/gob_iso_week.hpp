@@ -0,0 +1,71 @@
+/*!
+  @file gob_iso_week.hpp
+  @brief ISO-8601 week date ("YYYY-Www-D") format, parse and bulk week numbers, without strftime.
+
+  @code
+  LocalDate ld(2021, 1, 3);
+  ld.isoWeek(); // 53
+  ld.weekBasedYear(); // 2020
+  char buf[ISO_WEEK_DATE_BUFFER_SIZE];
+  formatIsoWeekDate(buf, sizeof(buf), ld); // "2020-W53-7"
+  parseIsoWeekDate("2020-W53-7"); // 2021-01-03
+  @endcode
+  @note Week numbers are also available as constexpr LocalDate::isoWeek() and LocalDate::weekBasedYear().
+*/
+#ifndef GOBLIB_ISO_WEEK_HPP
+#define GOBLIB_ISO_WEEK_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+constexpr size_t ISO_WEEK_DATE_BUFFER_SIZE = 11; //!< @brief Enough buffer size including the terminator. ("YYYY-Www-D")
+
+/*!
+  @brief Obtains a date from the ISO-8601 week date.
+  @param wby Week-based-year
+  @param week Week of the week-based-year [1 - 52 or 53]
+  @param dow ISO day of week [1(Mon) - 7(Sun)]
+  @return Invalid instance if failed.
+ */
+LocalDate ofIsoWeekDate(const int16_t wby, const int8_t week, const int8_t dow = 1);
+
+/*!
+  @brief Outputs the ISO-8601 week date, such as "2020-W53-7".
+  @return Length of the string without the terminator, or 0 if failed.
+  @note Fails if the week-based-year is not in [0 - 9999] or the buffer is too small.
+ */
+size_t formatIsoWeekDate(char* buf, const size_t len, const LocalDate& ld);
+
+/*!
+  @brief Parses the ISO-8601 week date.
+  @param s String such as "2020-W53-7". "YYYY-Www" (Monday) and basic formats "YYYYWwwD", "YYYYWww" are also accepted.
+  @param[out] end Pointer after the parsed string if not nullptr.
+  @return Invalid instance if failed.
+  @note Trailing characters are not errors, so check end if needed.
+ */
+LocalDate parseIsoWeekDate(const char* s, const char** end = nullptr);
+
+/*!
+  @brief Gets the ISO-8601 week numbers of the dates. (Bulk version of LocalDate::isoWeek)
+  @param[out] weeks Weeks of week-based-year
+  @param[out] years Week-based-years if not nullptr
+  @param dates Dates
+  @param n Number of the dates
+ */
+void isoWeeks(int8_t* weeks, int16_t* years, const LocalDate* dates, const size_t n);
+
+/*!
+  @brief Gets the keys of the ISO-8601 weeks of the epochs in the offset, such as 202053 (week-based-year * 100 + week).
+  @param[out] out Keys for weekly aggregates. They are ordered as the weeks.
+  @param epochs Epochs
+  @param n Number of the epochs
+  @param zo Offset
+  @note Computed by integer arithmetic only.
+ */
+void isoWeekKeys(int32_t* out, const time_t* epochs, const size_t n, const ZoneOffset& zo = ZoneOffset::UTC);
+
+//
+}}
+#endif
@@ -0,0 +1,228 @@
+/*!
+  @file gob_leap_second.cpp
+  @brief Leap-second table and conversions between UTC, TAI and GPS time.
+*/
+#include "gob_leap_second.hpp"
+
+namespace
+{
+using goblib::datetime::LeapSecondEntry;
+
+// Last update: IERS Bulletin C (No leap second will be introduced at the end of June 2025)
+constexpr LeapSecondEntry leapTable[] =
+{
+    {   63072000, 10 }, // 1972-01-01
+    {   78796800, 11 }, // 1972-07-01
+    {   94694400, 12 }, // 1973-01-01
+    {  126230400, 13 }, // 1974-01-01
+    {  157766400, 14 }, // 1975-01-01
+    {  189302400, 15 }, // 1976-01-01
+    {  220924800, 16 }, // 1977-01-01
+    {  252460800, 17 }, // 1978-01-01
+    {  283996800, 18 }, // 1979-01-01
+    {  315532800, 19 }, // 1980-01-01
+    {  362793600, 20 }, // 1981-07-01
+    {  394329600, 21 }, // 1982-07-01
+    {  425865600, 22 }, // 1983-07-01
+    {  489024000, 23 }, // 1985-07-01
+    {  567993600, 24 }, // 1988-01-01
+    {  631152000, 25 }, // 1990-01-01
+    {  662688000, 26 }, // 1991-01-01
+    {  709948800, 27 }, // 1992-07-01
+    {  741484800, 28 }, // 1993-07-01
+    {  773020800, 29 }, // 1994-07-01
+    {  820454400, 30 }, // 1996-01-01
+    {  867715200, 31 }, // 1997-07-01
+    {  915148800, 32 }, // 1999-01-01
+    { 1136073600, 33 }, // 2006-01-01
+    { 1230768000, 34 }, // 2009-01-01
+    { 1341100800, 35 }, // 2012-07-01
+    { 1435708800, 36 }, // 2015-07-01
+    { 1483228800, 37 }, // 2017-01-01
+};
+constexpr size_t LAST = sizeof(leapTable) / sizeof(leapTable[0]) - 1;
+constexpr int64_t SMEAR_HALF_WINDOW = 12 * 60 * 60; // noon to noon
+constexpr int64_t MILLIS = 1000;
+
+// TAI at the beginning of the leap second of entry i. (i > 0)
+inline int64_t taiOfLeap(const size_t i)
+{
+    return (int64_t)leapTable[i].utc + leapTable[i - 1].taiMinusUtc;
+}
+
+// Index of the entry which is applied to utc. Search from the hint.
+size_t indexOfUtc(const time_t utc, size_t i)
+{
+    while(i < LAST && leapTable[i + 1].utc <= utc) { ++i; }
+    while(i > 0 && leapTable[i].utc > utc) { --i; }
+    return i;
+}
+
+// Index of the last entry whose leap second begins at or before tai. Search from the hint.
+size_t indexOfTai(const int64_t tai, size_t i)
+{
+    while(i < LAST && taiOfLeap(i + 1) <= tai) { ++i; }
+    while(i > 0 && taiOfLeap(i) > tai) { --i; }
+    return i;
+}
+
+time_t taiToUtc(const int64_t tai, const size_t i, bool* leap)
+{
+    auto& e = leapTable[i];
+    bool inLeap = i > 0 && tai < (int64_t)e.utc + e.taiMinusUtc;
+    if(leap) { *leap = inLeap; }
+    return inLeap ? e.utc : (time_t)(tai - e.taiMinusUtc);
+}
+
+// Index of the last entry whose smearing window begins at or before taiMillis. Search from the hint.
+size_t indexOfSmearTai(const int64_t taiMillis, size_t i)
+{
+    auto start = [](const size_t idx) { return ((int64_t)leapTable[idx].utc - SMEAR_HALF_WINDOW + leapTable[idx - 1].taiMinusUtc) * MILLIS; };
+    while(i < LAST && start(i + 1) <= taiMillis) { ++i; }
+    while(i > 0 && start(i) > taiMillis) { --i; }
+    return i;
+}
+
+int64_t taiToSmearedUtcMillis(const int64_t taiMillis, const size_t i)
+{
+    auto& e = leapTable[i];
+    if(i > 0)
+    {
+        const int64_t prev = leapTable[i - 1].taiMinusUtc;
+        const int64_t taiStart = ((int64_t)e.utc - SMEAR_HALF_WINDOW + prev) * MILLIS;
+        const int64_t taiLength = (SMEAR_HALF_WINDOW * 2 + (e.taiMinusUtc - prev)) * MILLIS;
+        if(taiMillis < taiStart + taiLength)
+        {
+            return ((int64_t)e.utc - SMEAR_HALF_WINDOW) * MILLIS + (taiMillis - taiStart) * (SMEAR_HALF_WINDOW * 2 * MILLIS) / taiLength;
+        }
+    }
+    return taiMillis - (int64_t)e.taiMinusUtc * MILLIS;
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+const LeapSecondEntry* leapSecondTable()
+{
+    return leapTable;
+}
+
+size_t leapSecondTableSize()
+{
+    return LAST + 1;
+}
+
+int32_t taiMinusUtc(const time_t utc)
+{
+    return leapTable[indexOfUtc(utc, LAST)].taiMinusUtc;
+}
+
+bool isLeapSecond(const OffsetDateTime& odt)
+{
+    if(odt.second() != 60) { return false; }
+    auto utc = odt.toEpochSecond(); // 00:00:00 of the next day (UTC)
+    auto i = indexOfUtc(utc, LAST);
+    return i > 0 && leapTable[i].utc == utc;
+}
+
+int64_t utcToTai(const time_t utc)
+{
+    return (int64_t)utc + taiMinusUtc(utc);
+}
+
+int64_t toTai(const OffsetDateTime& odt)
+{
+    auto utc = odt.toEpochSecond();
+    // 23:59:60 is one second after 23:59:59 on TAI.
+    return (odt.second() == 60) ? utcToTai(utc - 1) + 1 : utcToTai(utc);
+}
+
+time_t taiToUtc(const int64_t tai, bool* leap)
+{
+    return ::taiToUtc(tai, indexOfTai(tai, LAST), leap);
+}
+
+OffsetDateTime ofTai(const int64_t tai, const ZoneOffset& zo)
+{
+    bool leap{};
+    auto utc = taiToUtc(tai, &leap);
+    if(!leap) { return OffsetDateTime(LocalDateTime::ofEpochSecond(utc, zo), zo); }
+
+    auto ldt = LocalDateTime::ofEpochSecond(utc - 1, zo);
+    return OffsetDateTime(ldt.toLocalDate(), LocalTime(ldt.hour(), ldt.minute(), 60), zo);
+}
+
+int64_t taiToSmearedUtcMillis(const int64_t taiMillis)
+{
+    return ::taiToSmearedUtcMillis(taiMillis, indexOfSmearTai(taiMillis, LAST));
+}
+
+int64_t smearedUtcMillisToTai(const int64_t smearedMillis)
+{
+    size_t i = LAST;
+    while(i > 0 && ((int64_t)leapTable[i].utc - SMEAR_HALF_WINDOW) * MILLIS > smearedMillis) { --i; }
+
+    auto& e = leapTable[i];
+    if(i > 0)
+    {
+        const int64_t prev = leapTable[i - 1].taiMinusUtc;
+        const int64_t utcStart = ((int64_t)e.utc - SMEAR_HALF_WINDOW) * MILLIS;
+        const int64_t utcLength = SMEAR_HALF_WINDOW * 2 * MILLIS;
+        if(smearedMillis < utcStart + utcLength)
+        {
+            const int64_t taiLength = utcLength + (e.taiMinusUtc - prev) * MILLIS;
+            return utcStart + prev * MILLIS + (smearedMillis - utcStart) * taiLength / utcLength;
+        }
+    }
+    return smearedMillis + (int64_t)e.taiMinusUtc * MILLIS;
+}
+
+void utcToTai(const time_t* src, int64_t* dst, const size_t n)
+{
+    size_t idx = LAST;
+    for(size_t i = 0; i < n; ++i)
+    {
+        idx = indexOfUtc(src[i], idx);
+        dst[i] = (int64_t)src[i] + leapTable[idx].taiMinusUtc;
+    }
+}
+
+void taiToUtc(const int64_t* src, time_t* dst, const size_t n)
+{
+    size_t idx = LAST;
+    for(size_t i = 0; i < n; ++i)
+    {
+        idx = indexOfTai(src[i], idx);
+        dst[i] = ::taiToUtc(src[i], idx, nullptr);
+    }
+}
+
+void utcToGps(const time_t* src, int64_t* dst, const size_t n)
+{
+    utcToTai(src, dst, n);
+    for(size_t i = 0; i < n; ++i) { dst[i] = taiToGps(dst[i]); }
+}
+
+void gpsToUtc(const int64_t* src, time_t* dst, const size_t n)
+{
+    size_t idx = LAST;
+    for(size_t i = 0; i < n; ++i)
+    {
+        auto tai = gpsToTai(src[i]);
+        idx = indexOfTai(tai, idx);
+        dst[i] = ::taiToUtc(tai, idx, nullptr);
+    }
+}
+
+void taiToSmearedUtcMillis(const int64_t* src, int64_t* dst, const size_t n)
+{
+    size_t idx = LAST;
+    for(size_t i = 0; i < n; ++i)
+    {
+        idx = indexOfSmearTai(src[i], idx);
+        dst[i] = ::taiToSmearedUtcMillis(src[i], idx);
+    }
+}
+//
+}}
@@ -0,0 +1,103 @@
+/*!
+  @file gob_leap_second.hpp
+  @brief Leap-second table and conversions between UTC, TAI and GPS time.
+
+  Epoch values used in this file.
+  - UTC : time_t (POSIX time, leap seconds are not counted). 23:59:60 has the same value as 00:00:00 of the next day.
+  - TAI : Seconds from 1970-01-01T00:00:00 TAI. (TAI = UTC + taiMinusUtc)
+  - GPS : Seconds from the GPS epoch 1980-01-06T00:00:00 UTC. (GPS = TAI - 19 - 315964800)
+
+  @note UTC before 1972-01-01 is treated as TAI - 10 seconds.
+  @warning The table must be updated when IERS announces a new leap second.
+  @sa https://www.iers.org/IERS/EN/Publications/Bulletins/bulletins.html
+*/
+#ifndef GOBLIB_LEAP_SECOND_HPP
+#define GOBLIB_LEAP_SECOND_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef> // size_t
+
+namespace goblib { namespace datetime {
+
+/*!
+  @struct LeapSecondEntry
+  @brief An element of the leap-second table.
+ */
+struct LeapSecondEntry
+{
+    time_t  utc;         //!< @brief UTC epoch from which taiMinusUtc is applied (00:00:00 just after the leap second).
+    int32_t taiMinusUtc; //!< @brief TAI - UTC seconds.
+};
+
+constexpr int32_t GPS_MINUS_TAI = -19; //!< @brief GPS - TAI seconds (constant).
+constexpr int64_t GPS_EPOCH_UTC = 315964800; //!< @brief GPS epoch (1980-01-06T00:00:00Z) as UTC epoch.
+
+///@name Leap-second table
+///@{
+/*! @brief Gets the leap-second table in ascending order. */
+const LeapSecondEntry* leapSecondTable();
+/*! @brief Gets the number of the entries of the leap-second table. */
+size_t leapSecondTableSize();
+/*!
+  @brief Gets TAI - UTC at the UTC epoch.
+  @note O(1) for the instants after the last leap second.
+ */
+int32_t taiMinusUtc(const time_t utc);
+/*! @brief Is the date-time 23:59:60 UTC of an inserted leap second? */
+bool isLeapSecond(const OffsetDateTime& odt);
+///@}
+
+///@name Conversions UTC <-> TAI <-> GPS
+///@{
+/*! @brief Converts UTC epoch to TAI seconds. */
+int64_t utcToTai(const time_t utc);
+/*! @brief Converts the date-time to TAI seconds. (23:59:60 is supported) */
+int64_t toTai(const OffsetDateTime& odt);
+/*!
+  @brief Converts TAI seconds to UTC epoch.
+  @param tai TAI seconds
+  @param[out] leap Set true if tai is in a leap second (23:59:60) if not nullptr.
+  @note The leap second is converted to the UTC epoch of 00:00:00 of the next day.
+ */
+time_t taiToUtc(const int64_t tai, bool* leap = nullptr);
+/*! @brief Obtains an instance of OffsetDateTime from TAI seconds. (The leap second is represented as 23:59:60 UTC) */
+OffsetDateTime ofTai(const int64_t tai, const ZoneOffset& zo = ZoneOffset::UTC);
+/*! @brief Converts TAI seconds to GPS seconds. */
+constexpr int64_t taiToGps(const int64_t tai) { return tai + GPS_MINUS_TAI - GPS_EPOCH_UTC; }
+/*! @brief Converts GPS seconds to TAI seconds. */
+constexpr int64_t gpsToTai(const int64_t gps) { return gps - GPS_MINUS_TAI + GPS_EPOCH_UTC; }
+/*! @brief Converts UTC epoch to GPS seconds. */
+inline int64_t utcToGps(const time_t utc) { return taiToGps(utcToTai(utc)); }
+/*! @brief Converts GPS seconds to UTC epoch. */
+inline time_t gpsToUtc(const int64_t gps, bool* leap = nullptr) { return taiToUtc(gpsToTai(gps), leap); }
+///@}
+
+///@name Smeared UTC
+/*!
+  The leap second is spread linearly over 24 hours from noon to noon (UTC) around it,
+  so the smeared clock never repeats or skips a second.
+ */
+///@{
+/*! @brief Converts TAI milliseconds to smeared UTC milliseconds. */
+int64_t taiToSmearedUtcMillis(const int64_t taiMillis);
+/*! @brief Converts smeared UTC milliseconds to TAI milliseconds. */
+int64_t smearedUtcMillisToTai(const int64_t smearedMillis);
+///@}
+
+///@name Bulk conversions
+/*!
+  Searching the table continues from the previous element,
+  so that sorted arrays are converted in O(1) per element.
+  @note src and dst may not overlap.
+ */
+///@{
+void utcToTai(const time_t* src, int64_t* dst, const size_t n); //!< @brief UTC epoch to TAI seconds.
+void taiToUtc(const int64_t* src, time_t* dst, const size_t n); //!< @brief TAI seconds to UTC epoch.
+void utcToGps(const time_t* src, int64_t* dst, const size_t n); //!< @brief UTC epoch to GPS seconds.
+void gpsToUtc(const int64_t* src, time_t* dst, const size_t n); //!< @brief GPS seconds to UTC epoch.
+void taiToSmearedUtcMillis(const int64_t* src, int64_t* dst, const size_t n); //!< @brief TAI milliseconds to smeared UTC milliseconds.
+///@}
+
+//
+}}
+#endif
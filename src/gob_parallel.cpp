@@ -0,0 +1,203 @@
+/*!
+  @file gob_parallel.cpp
+  @brief Bulk conversion, format and parse split across a thread pool.
+*/
+#include "gob_parallel.hpp"
+#include "gob_rfc3339.hpp"
+#include <atomic>
+#include <cstdint>
+
+namespace
+{
+constexpr size_t MIN_CHUNK_ELEMENTS = 2048; // Smaller chunks cost more in dispatch than in work.
+constexpr size_t CHUNKS_PER_THREAD = 4;     // For load balancing.
+
+inline size_t gcd(size_t a, size_t b)
+{
+    while(b) { const size_t t = a % b; a = b; b = t; }
+    return a;
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+#if !defined(GOBLIB_DATETIME_DISABLE_THREADS)
+ThreadPool::ThreadPool(const size_t threads)
+{
+    size_t sz = threads ? threads : std::thread::hardware_concurrency();
+    sz = sz ? sz : 1;
+    _workers.reserve(sz - 1);
+    for(size_t i = 1; i < sz; ++i) { _workers.emplace_back(&ThreadPool::work, this); }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wake.notify_all();
+    for(auto& th : _workers) { th.join(); }
+}
+
+size_t ThreadPool::size() const
+{
+    return _workers.size() + 1;
+}
+
+void ThreadPool::run(const size_t tasks, const std::function<void(size_t)>& task)
+{
+    if(_workers.empty() || tasks <= 1)
+    {
+        for(size_t i = 0; i < tasks; ++i) { task(i); }
+        return;
+    }
+    std::lock_guard<std::mutex> running(_runMutex);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _task = &task;
+        _tasks = tasks;
+        _next.store(0, std::memory_order_relaxed);
+        _active = _workers.size();
+        ++_generation;
+    }
+    _wake.notify_all();
+    drain(task, tasks);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done.wait(lock, [this]() { return _active == 0; });
+    _task = nullptr;
+}
+
+void ThreadPool::work()
+{
+    uint64_t seen{};
+    std::unique_lock<std::mutex> lock(_mutex);
+    for(;;)
+    {
+        _wake.wait(lock, [this, &seen]() { return _stop || _generation != seen; });
+        if(_stop) { return; }
+        seen = _generation;
+        auto task = _task;
+        auto tasks = _tasks;
+        lock.unlock();
+        drain(*task, tasks);
+        lock.lock();
+        if(--_active == 0) { _done.notify_one(); }
+    }
+}
+
+void ThreadPool::drain(const std::function<void(size_t)>& task, const size_t tasks)
+{
+    size_t i;
+    while((i = _next.fetch_add(1, std::memory_order_relaxed)) < tasks) { task(i); }
+}
+
+#else
+
+ThreadPool::ThreadPool(const size_t) {}
+ThreadPool::~ThreadPool() {}
+size_t ThreadPool::size() const { return 1; }
+
+void ThreadPool::run(const size_t tasks, const std::function<void(size_t)>& task)
+{
+    for(size_t i = 0; i < tasks; ++i) { task(i); }
+}
+#endif
+
+ThreadPool& ThreadPool::shared()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+namespace detail
+{
+size_t chunkElements(const size_t n, const size_t threads, const size_t elementSize)
+{
+    const size_t line = CACHE_LINE_SIZE / gcd(CACHE_LINE_SIZE, elementSize);
+    const size_t div = threads * CHUNKS_PER_THREAD;
+    size_t sz = (n + div - 1) / div;
+    sz = sz < MIN_CHUNK_ELEMENTS ? MIN_CHUNK_ELEMENTS : sz;
+    return (sz + line - 1) / line * line;
+}
+
+size_t headElements(const void* out, const size_t elementSize)
+{
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(out);
+    const size_t line = CACHE_LINE_SIZE / gcd(CACHE_LINE_SIZE, elementSize);
+    for(size_t i = 0; i < line; ++i)
+    {
+        if((addr + i * elementSize) % CACHE_LINE_SIZE == 0) { return i; }
+    }
+    return 0; // Never aligned
+}
+//
+}
+
+void parallelOfEpochSeconds(LocalDateTime* out, const time_t* epochs, const size_t n, const ZoneOffset& zo, ThreadPool& pool)
+{
+    parallelChunks(out, n, [&](const size_t b, const size_t e)
+    {
+        for(size_t i = b; i < e; ++i) { out[i] = LocalDateTime::ofEpochSecond(epochs[i], zo); }
+    }, pool);
+}
+
+void parallelToEpochSeconds(time_t* out, const OffsetDateTime* odts, const size_t n, ThreadPool& pool)
+{
+    parallelChunks(out, n, [&](const size_t b, const size_t e)
+    {
+        for(size_t i = b; i < e; ++i) { out[i] = odts[i].toEpochSecond(); }
+    }, pool);
+}
+
+void parallelWithOffsetSameEpoch(OffsetDateTime* out, const OffsetDateTime* odts, const size_t n, const ZoneOffset& zo, ThreadPool& pool)
+{
+    parallelChunks(out, n, [&](const size_t b, const size_t e)
+    {
+        for(size_t i = b; i < e; ++i)
+        {
+            const auto& odt = odts[i];
+            out[i] = (odt.offset() == zo) ? odt
+                    : OffsetDateTime(LocalDateTime::ofEpochSecond(odt.toEpochSecond(), zo), zo);
+        }
+    }, pool);
+}
+
+size_t parallelFormatRFC3339(char* out, const size_t stride, const OffsetDateTime* odts, const size_t n, ThreadPool& pool)
+{
+    if(!out || !stride || n > SIZE_MAX / stride) { return 0; }
+    std::atomic<size_t> formatted{};
+    parallelRecords(out, stride, n, [&](const size_t b, const size_t e)
+    {
+        size_t cnt{};
+        for(size_t i = b; i < e; ++i)
+        {
+            char* p = out + i * stride;
+            if(formatRFC3339(p, stride, odts[i])) { ++cnt; }
+            else { *p = '\0'; }
+        }
+        formatted.fetch_add(cnt, std::memory_order_relaxed);
+    }, pool);
+    return formatted.load();
+}
+
+size_t parallelParseRFC3339(OffsetDateTime* out, const char* const* strs, const size_t n, ThreadPool& pool)
+{
+    std::atomic<size_t> parsed{};
+    parallelChunks(out, n, [&](const size_t b, const size_t e)
+    {
+        size_t cnt{};
+        for(size_t i = b; i < e; ++i)
+        {
+            out[i] = parseRFC3339(strs[i]);
+            cnt += out[i].valid();
+        }
+        parsed.fetch_add(cnt, std::memory_order_relaxed);
+    }, pool);
+    return parsed.load();
+}
+
+//
+}}
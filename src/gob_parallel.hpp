@@ -0,0 +1,179 @@
+/*!
+  @file gob_parallel.hpp
+  @brief Bulk conversion, format and parse split across a thread pool.
+
+  @code
+  std::vector<OffsetDateTime> column = ...;
+  // Rezone all in place with the shared pool (hardware concurrency)
+  parallelWithOffsetSameEpoch(column.data(), column.data(), column.size(), ZoneOffset::of(-5));
+
+  ThreadPool pool(8);
+  std::vector<LocalDateTime> fields(epochs.size());
+  parallelOfEpochSeconds(fields.data(), epochs.data(), epochs.size(), ZoneOffset::of(9), pool);
+  @endcode
+  @note The output order is the same as the input. Each chunk writes its own range of the output, and the chunk boundaries are aligned to the cache line of the output so that threads do not share a line.
+  @note Define GOBLIB_DATETIME_DISABLE_THREADS if the platform does not support std::thread. (All run on the calling thread)
+*/
+#ifndef GOBLIB_PARALLEL_HPP
+#define GOBLIB_PARALLEL_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+#include <functional>
+#if !defined(GOBLIB_DATETIME_DISABLE_THREADS)
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#endif
+
+namespace goblib { namespace datetime {
+
+constexpr size_t CACHE_LINE_SIZE = 64; //!< @brief Assumed size of the cache line.
+
+/*!
+  @class ThreadPool
+  @brief Fixed number of worker threads that run indexed tasks.
+  @note The calling thread of run() also works, so size() includes it.
+  @note Tasks must not throw and must not call run() of the same pool.
+ */
+class ThreadPool
+{
+  public:
+    /*! @param threads Number of threads including the caller. 0 means std::thread::hardware_concurrency(). */
+    explicit ThreadPool(const size_t threads = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /*! @brief Number of threads including the caller of run(). */
+    size_t size() const;
+    /*!
+      @brief Calls task(i) for each i in [0, tasks) in parallel, and waits for all.
+      @note Calls from multiple threads are serialized.
+     */
+    void run(const size_t tasks, const std::function<void(size_t)>& task);
+
+    /*! @brief Gets the pool shared by the process. (hardware concurrency, created on first use) */
+    static ThreadPool& shared();
+
+  private:
+#if !defined(GOBLIB_DATETIME_DISABLE_THREADS)
+    void work();
+    void drain(const std::function<void(size_t)>& task, const size_t tasks);
+
+    std::vector<std::thread> _workers{};
+    std::mutex _runMutex{};
+    std::mutex _mutex{};
+    std::condition_variable _wake{}, _done{};
+    const std::function<void(size_t)>* _task{};
+    size_t _tasks{};
+    std::atomic<size_t> _next{};
+    size_t _active{};
+    uint64_t _generation{};
+    bool _stop{};
+#endif
+};
+
+namespace detail
+{
+// Elements per chunk, a multiple of the elements in a cache line.
+size_t chunkElements(const size_t n, const size_t threads, const size_t elementSize);
+// Elements before the first cache line boundary of the output.
+size_t headElements(const void* out, const size_t elementSize);
+}
+
+/*!
+  @brief Splits the records [0, n) into chunks that start on the cache line of the output, and calls f(begin, end) for each chunk in the pool.
+  @param out Output records, used for the alignment only.
+  @param stride Size of a record
+  @param n Number of the records
+  @param f Function such as void(size_t begin, size_t end)
+  @param pool Thread pool
+  @note Small n runs on the calling thread only.
+ */
+template<typename F> void parallelRecords(const void* out, const size_t stride, const size_t n, F f, ThreadPool& pool = ThreadPool::shared())
+{
+    if(!n) { return; }
+    const size_t chunk = detail::chunkElements(n, pool.size(), stride);
+    if(pool.size() <= 1 || n <= chunk) { f(size_t{0}, n); return; }
+
+    const size_t head = detail::headElements(out, stride); // First chunk also covers the unaligned head.
+    const size_t chunks = (n > head) ? (n - head + chunk - 1) / chunk : 1;
+    pool.run(chunks, [&](const size_t c)
+    {
+        const size_t b = c ? head + c * chunk : 0;
+        const size_t e = head + (c + 1) * chunk;
+        f(b, e < n ? e : n);
+    });
+}
+
+/*!
+  @brief Splits [0, n) into chunks aligned to the cache line of the output, and calls f(begin, end) for each chunk in the pool.
+  @tparam T Type of the output element
+  @param out Output array, used for the alignment only.
+  @param n Number of the elements
+  @param f Function such as void(size_t begin, size_t end)
+  @param pool Thread pool
+  @note Small n runs on the calling thread only.
+ */
+template<typename T, typename F> void parallelChunks(const T* out, const size_t n, F f, ThreadPool& pool = ThreadPool::shared())
+{
+    parallelRecords(out, sizeof(T), n, f, pool);
+}
+
+/*!
+  @brief Converts the epochs to LocalDateTime in the offset. (Parallel version of LocalDateTime::ofEpochSecond)
+  @param[out] out LocalDateTimes
+  @param epochs Epochs
+  @param n Number of the epochs
+  @param zo Offset
+  @param pool Thread pool
+ */
+void parallelOfEpochSeconds(LocalDateTime* out, const time_t* epochs, const size_t n, const ZoneOffset& zo, ThreadPool& pool = ThreadPool::shared());
+
+/*!
+  @brief Converts the date-times to the epochs. (Parallel version of OffsetDateTime::toEpochSecond)
+  @param[out] out Epochs
+  @param odts OffsetDateTimes
+  @param n Number of the date-times
+  @param pool Thread pool
+ */
+void parallelToEpochSeconds(time_t* out, const OffsetDateTime* odts, const size_t n, ThreadPool& pool = ThreadPool::shared());
+
+/*!
+  @brief Rezones the date-times to the offset with the same instant. (Parallel version of OffsetDateTime::withOffsetSameEpoch)
+  @param[out] out Rezoned date-times. It may be the same as odts.
+  @param odts OffsetDateTimes
+  @param n Number of the date-times
+  @param zo Offset
+  @param pool Thread pool
+ */
+void parallelWithOffsetSameEpoch(OffsetDateTime* out, const OffsetDateTime* odts, const size_t n, const ZoneOffset& zo, ThreadPool& pool = ThreadPool::shared());
+
+/*!
+  @brief Outputs RFC 3339 strings of the date-times to fixed length records. (Parallel version of formatRFC3339)
+  @param[out] out Buffer of n * stride bytes. The string of odts[i] is at out + i * stride with the terminator.
+  @param stride Size of a record (RFC3339_BUFFER_SIZE is enough)
+  @param odts OffsetDateTimes
+  @param n Number of the date-times
+  @param pool Thread pool
+  @return Number of the formatted date-times. Failed records are empty strings.
+  @retval 0 No output if out is null, stride is zero or n * stride overflows.
+ */
+size_t parallelFormatRFC3339(char* out, const size_t stride, const OffsetDateTime* odts, const size_t n, ThreadPool& pool = ThreadPool::shared());
+
+/*!
+  @brief Parses RFC 3339 strings. (Parallel version of parseRFC3339)
+  @param[out] out OffsetDateTimes. Invalid instance if failed.
+  @param strs Strings
+  @param n Number of the strings
+  @param pool Thread pool
+  @return Number of the parsed strings.
+ */
+size_t parallelParseRFC3339(OffsetDateTime* out, const char* const* strs, const size_t n, ThreadPool& pool = ThreadPool::shared());
+
+//
+}}
+#endif
@@ -0,0 +1,106 @@
+/*!
+  @file gob_precise_time.cpp
+  @brief LocalTime and LocalDateTime with sub-second precision.
+*/
+#include "gob_precise_time.hpp"
+#include "gob_datetime_internal.hpp"
+
+namespace
+{
+using goblib::datetime::detail::put2;
+using goblib::datetime::detail::get;
+
+// "hh:mm:ss[.fff...]" without terminator
+char* putTimeOfDay(char* p, const uint64_t ticks, const uint32_t perSecond, const uint8_t digits)
+{
+    const uint32_t sod = static_cast<uint32_t>(ticks / perSecond);
+    p = put2(p, sod / 3600);
+    *p++ = ':';
+    p = put2(p, sod / 60 % 60);
+    *p++ = ':';
+    p = put2(p, sod % 60);
+    if(digits)
+    {
+        *p++ = '.';
+        uint32_t f = static_cast<uint32_t>(ticks % perSecond);
+        for(int i = digits - 1; i >= 0; --i) { p[i] = '0' + (f % 10); f /= 10; }
+        p += digits;
+    }
+    return p;
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+// for GCC C++11,C++14
+#if !defined(__clang__) && defined(__GNUG__) && __cplusplus < 201703L
+constexpr uint32_t SecondPrecision::PER_SECOND;
+constexpr uint8_t  SecondPrecision::DIGITS;
+constexpr uint32_t MilliPrecision::PER_SECOND;
+constexpr uint8_t  MilliPrecision::DIGITS;
+constexpr uint32_t MicroPrecision::PER_SECOND;
+constexpr uint8_t  MicroPrecision::DIGITS;
+constexpr uint32_t NanoPrecision::PER_SECOND;
+constexpr uint8_t  NanoPrecision::DIGITS;
+#endif
+
+namespace detail
+{
+size_t formatTimeOfDay(char* buf, const size_t len, const uint64_t ticks, const uint32_t perSecond, const uint8_t digits)
+{
+    const size_t sz = 8 + (digits ? digits + 1 : 0);
+    if(!buf || len <= sz) { return 0; }
+    char* p = putTimeOfDay(buf, ticks, perSecond, digits);
+    *p = '\0';
+    return p - buf;
+}
+
+size_t formatDateTime(char* buf, const size_t len, const LocalDate& ld, const uint64_t ticks, const uint32_t perSecond, const uint8_t digits)
+{
+    const size_t sz = 11 + 8 + (digits ? digits + 1 : 0);
+    if(!buf || len <= sz || ld.year() < 0 || ld.year() > 9999) { return 0; }
+    char* p = buf;
+    p = put2(p, ld.year() / 100);
+    p = put2(p, ld.year() % 100);
+    *p++ = '-';
+    p = put2(p, ld.month());
+    *p++ = '-';
+    p = put2(p, ld.day());
+    *p++ = 'T';
+    p = putTimeOfDay(p, ticks, perSecond, digits);
+    *p = '\0';
+    return p - buf;
+}
+
+const char* parseTimeOfDay(const char* s, int& hh, int& mm, int& ss, uint32_t& nanos)
+{
+    if(!s) { return nullptr; }
+    const char* p = s;
+    if(!get(p, 2, hh) || *p++ != ':' || !get(p, 2, mm) || *p++ != ':' || !get(p, 2, ss)) { return nullptr; }
+    nanos = 0;
+    if(*p == '.' || *p == ',')
+    {
+        ++p;
+        if(static_cast<unsigned>(*p - '0') > 9) { return nullptr; }
+        int n = 0;
+        for(; static_cast<unsigned>(*p - '0') <= 9; ++p, ++n)
+        {
+            if(n < 9) { nanos = nanos * 10 + (*p - '0'); }
+        }
+        for(; n < 9; ++n) { nanos *= 10; }
+    }
+    return p;
+}
+
+const char* parseDate(const char* s, int& y, int& m, int& d)
+{
+    if(!s) { return nullptr; }
+    const char* p = s;
+    return (get(p, 4, y) && *p++ == '-' && get(p, 2, m) && *p++ == '-' && get(p, 2, d)) ? p : nullptr;
+}
+//
+}
+
+//
+}}
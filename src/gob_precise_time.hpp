@@ -0,0 +1,254 @@
+/*!
+  @file gob_precise_time.hpp
+  @brief LocalTime and LocalDateTime with sub-second precision.
+
+  @code
+  auto lt = LocalTimeMillis::parse("12:34:56.789");
+  lt.fraction(); // 789
+  lt.toNanoOfDay(); // 45296789000000
+  auto ldt = LocalDateTimeMicros(LocalDate(2022, 12, 13), LocalTimeMicros(12, 34, 56, 123456));
+  ldt.toString(); // "2022-12-13T12:34:56.123456"
+  @endcode
+  @note LocalTime and LocalDateTime are unchanged (seconds only, no size and speed penalty). Use these types only when sub-second is needed.
+*/
+#ifndef GOBLIB_PRECISE_TIME_HPP
+#define GOBLIB_PRECISE_TIME_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+///@name Precision of PreciseLocalTime
+///@{
+/*! @brief Seconds. Stored in 32 bits. */
+struct SecondPrecision { using rep_t = uint32_t; static constexpr uint32_t PER_SECOND = 1;          static constexpr uint8_t DIGITS = 0; };
+/*! @brief Milliseconds. Stored in 32 bits, same size as LocalTime. */
+struct MilliPrecision  { using rep_t = uint32_t; static constexpr uint32_t PER_SECOND = 1000;       static constexpr uint8_t DIGITS = 3; };
+/*! @brief Microseconds. Stored in 64 bits. */
+struct MicroPrecision  { using rep_t = uint64_t; static constexpr uint32_t PER_SECOND = 1000000;    static constexpr uint8_t DIGITS = 6; };
+/*! @brief Nanoseconds. Stored in 64 bits. */
+struct NanoPrecision   { using rep_t = uint64_t; static constexpr uint32_t PER_SECOND = 1000000000; static constexpr uint8_t DIGITS = 9; };
+///@}
+
+namespace detail
+{
+// Outputs "hh:mm:ss[.fff...]"
+size_t formatTimeOfDay(char* buf, const size_t len, const uint64_t ticks, const uint32_t perSecond, const uint8_t digits);
+// Outputs "YYYY-MM-DDThh:mm:ss[.fff...]"
+size_t formatDateTime(char* buf, const size_t len, const LocalDate& ld, const uint64_t ticks, const uint32_t perSecond, const uint8_t digits);
+// Parses "hh:mm:ss[.fff...]", returns the end of parsed or nullptr if failed.
+const char* parseTimeOfDay(const char* s, int& hh, int& mm, int& ss, uint32_t& nanos);
+// Parses "YYYY-MM-DD", returns the end of parsed or nullptr if failed.
+const char* parseDate(const char* s, int& y, int& m, int& d);
+}
+
+/*!
+  @class PreciseLocalTime
+  @brief A time without a time-zone with sub-second precision, such as 12:34:56.789
+  @tparam P Precision (SecondPrecision, MilliPrecision, MicroPrecision, NanoPrecision)
+  @note Stored as the ticks of the day, so comparisons and conversions are cheap and field access needs divisions.
+  @note Leap second (second 60) is not supported.
+*/
+template<class P> class PreciseLocalTime
+{
+  public:
+    using precision_t = P;
+    using rep_t = typename P::rep_t;
+    static constexpr rep_t TICKS_PER_DAY = static_cast<rep_t>(86400) * P::PER_SECOND; //!< @brief Ticks of a day.
+
+    ///@name Constructors
+    ///@{
+    constexpr PreciseLocalTime() {}
+    /*! @param fraction Fraction of the second in the precision. (e.g. milliseconds for MilliPrecision) */
+    constexpr PreciseLocalTime(const int8_t hour, const int8_t minute, const int8_t second, const uint32_t fraction = 0)
+            : _ticks((hour >= 0 && hour <= 23 && minute >= 0 && minute <= 59 && second >= 0 && second <= 59 && fraction < P::PER_SECOND)
+                     ? static_cast<rep_t>(hour * 3600 + minute * 60 + second) * P::PER_SECOND + fraction : INVALID_TICKS) {}
+    constexpr explicit PreciseLocalTime(const LocalTime& lt, const uint32_t fraction = 0) : PreciseLocalTime(lt.hour(), lt.minute(), lt.second(), fraction) {}
+    ///@}
+
+    ///@name Properties
+    ///@{
+    constexpr int8_t   hour()     const { return static_cast<int8_t>(_ticks / (static_cast<rep_t>(3600) * P::PER_SECOND)); } //!< @brief Gets the hour.
+    constexpr int8_t   minute()   const { return static_cast<int8_t>(_ticks / (static_cast<rep_t>(60) * P::PER_SECOND) % 60); } //!< @brief Gets the minute.
+    constexpr int8_t   second()   const { return static_cast<int8_t>(_ticks / P::PER_SECOND % 60); } //!< @brief Gets the second.
+    constexpr uint32_t fraction() const { return static_cast<uint32_t>(_ticks % P::PER_SECOND); } //!< @brief Gets the fraction of the second in the precision.
+    constexpr uint32_t nano()     const { return fraction() * (1000000000U / P::PER_SECOND); } //!< @brief Gets the nano of the second.
+    constexpr rep_t    ticks()    const { return _ticks; } //!< @brief Gets the ticks of the day.
+    ///@}
+
+    /*! @brief Is valid instance? */
+    constexpr bool valid() const { return _ticks < TICKS_PER_DAY; }
+    /*! @brief Extracts the time as seconds of day. */
+    constexpr int32_t toSecondOfDay() const { return static_cast<int32_t>(_ticks / P::PER_SECOND); }
+    /*! @brief Extracts the time as nanos of day. */
+    constexpr int64_t toNanoOfDay() const { return static_cast<int64_t>(_ticks) * (1000000000U / P::PER_SECOND); }
+    /*! @brief Gets LocalTime. (The fraction is truncated) */
+    constexpr LocalTime toLocalTime() const { return LocalTime(hour(), minute(), second()); }
+    /*!
+      @brief Outputs this time to the buffer without memory allocation, such as 12:34:56.789
+      @return Length of the string without the terminator, or 0 if failed.
+      @note The fraction is always output in the digits of the precision.
+     */
+    size_t toChars(char* buf, const size_t len) const { return valid() ? detail::formatTimeOfDay(buf, len, _ticks, P::PER_SECOND, P::DIGITS) : 0; }
+    /*! @brief Outputs this time as a String, such as 12:34:56.789 */
+    string_t toString() const
+    {
+        char buf[24];
+        return toChars(buf, sizeof(buf)) ? string_t(buf) : string_t();
+    }
+
+    /*! @brief Obtains an instance from the ticks of the day. */
+    static constexpr PreciseLocalTime ofTicks(const rep_t ticks) { return PreciseLocalTime(ticks, 0); }
+    /*! @brief Obtains an instance from the second of the day. */
+    static constexpr PreciseLocalTime ofSecondOfDay(const int32_t sod) { return ofTicks(sod >= 0 ? static_cast<rep_t>(sod) * P::PER_SECOND : INVALID_TICKS); }
+    /*! @brief Obtains an instance from the nano of the day. (Truncated to the precision) */
+    static constexpr PreciseLocalTime ofNanoOfDay(const int64_t nod) { return ofTicks(nod >= 0 ? static_cast<rep_t>(nod / (1000000000U / P::PER_SECOND)) : INVALID_TICKS); }
+    /*!
+      @brief Obtains an instance from a text string such as 12:34:56.789
+      @param s "hh:mm:ss" with optional fraction (. or ,) of any digits. Digits beyond the precision are truncated.
+      @param[out] end Pointer after the parsed string if not nullptr.
+      @return Invalid instance if failed.
+      @note Trailing characters are not errors, so check end if needed.
+     */
+    static PreciseLocalTime parse(const char* s, const char** end = nullptr)
+    {
+        int hh, mm, ss;
+        uint32_t ns;
+        auto p = detail::parseTimeOfDay(s, hh, mm, ss, ns);
+        if(!p) { return ofTicks(INVALID_TICKS); }
+        if(end) { *end = p; }
+        return PreciseLocalTime(hh, mm, ss, ns / (1000000000U / P::PER_SECOND));
+    }
+
+#if __cplusplus < 202002L
+    friend inline bool operator==(const PreciseLocalTime& a, const PreciseLocalTime& b) { return a._ticks == b._ticks; }
+    friend inline bool operator< (const PreciseLocalTime& a, const PreciseLocalTime& b) { return a._ticks <  b._ticks; }
+    friend inline bool operator!=(const PreciseLocalTime& a, const PreciseLocalTime& b) { return std::rel_ops::operator!=(a,b); }
+    friend inline bool operator> (const PreciseLocalTime& a, const PreciseLocalTime& b) { return std::rel_ops::operator> (a,b); }
+    friend inline bool operator<=(const PreciseLocalTime& a, const PreciseLocalTime& b) { return std::rel_ops::operator<=(a,b); }
+    friend inline bool operator>=(const PreciseLocalTime& a, const PreciseLocalTime& b) { return std::rel_ops::operator>=(a,b); }
+#else
+    auto operator <=>(const PreciseLocalTime&) const = default;
+#endif
+
+  private:
+    constexpr PreciseLocalTime(const rep_t ticks, int) : _ticks(ticks) {}
+
+    static constexpr rep_t INVALID_TICKS = static_cast<rep_t>(~static_cast<rep_t>(0));
+    rep_t _ticks{};
+};
+
+/*!
+  @class PreciseLocalDateTime
+  @brief A date-time without a time-zone with sub-second precision, such as 2009-08-07T12:34:56.789
+  @tparam P Precision (SecondPrecision, MilliPrecision, MicroPrecision, NanoPrecision)
+*/
+template<class P> class PreciseLocalDateTime
+{
+  public:
+    using precision_t = P;
+
+    ///@name Constructors
+    ///@{
+    constexpr PreciseLocalDateTime() {}
+    constexpr PreciseLocalDateTime(const LocalDate& ld, const PreciseLocalTime<P>& lt) : _date(ld), _time(lt) {}
+    constexpr PreciseLocalDateTime(const int16_t y, const int8_t m, const int8_t d, const int8_t hh, const int8_t mm, const int8_t ss, const uint32_t fraction = 0)
+            : _date(y, m, d), _time(hh, mm, ss, fraction) {}
+    constexpr explicit PreciseLocalDateTime(const LocalDateTime& ldt, const uint32_t fraction = 0)
+            : _date(ldt.toLocalDate()), _time(ldt.toLocalTime(), fraction) {}
+    ///@}
+
+    ///@name Properties
+    ///@{
+    constexpr int16_t   year()      const { return _date.year(); } //!< @brief Gets the year.
+    constexpr int8_t    month()     const { return _date.month(); } //!< @brief Gets the month.
+    constexpr int8_t    day()       const { return _date.day(); } //!< @brief Gets the day.
+    constexpr DayOfWeek dayOfWeek() const { return _date.dayOfWeek(); } //!< @brief Gets the day of week.
+    constexpr int8_t    hour()      const { return _time.hour(); } //!< @brief Gets the hour.
+    constexpr int8_t    minute()    const { return _time.minute(); } //!< @brief Gets the minute.
+    constexpr int8_t    second()    const { return _time.second(); } //!< @brief Gets the second.
+    constexpr uint32_t  fraction()  const { return _time.fraction(); } //!< @brief Gets the fraction of the second in the precision.
+    constexpr uint32_t  nano()      const { return _time.nano(); } //!< @brief Gets the nano of the second.
+    ///@}
+
+    /*! @brief Is valid instance? */
+    constexpr bool valid() const { return _date.valid() && _time.valid(); }
+    /*! @brief Gets the LocalDate part. */
+    constexpr LocalDate toLocalDate() const { return _date; }
+    /*! @brief Gets the PreciseLocalTime part. */
+    constexpr PreciseLocalTime<P> toLocalTime() const { return _time; }
+    /*! @brief Gets LocalDateTime. (The fraction is truncated) */
+    constexpr LocalDateTime toLocalDateTime() const { return LocalDateTime(_date, _time.toLocalTime()); }
+    /*! @brief Converts this date to the Epoch Day. */
+    int32_t toEpochDay() const { return _date.toEpochDay(); }
+    /*! @brief Converts to the number of seconds from the epoch. (The fraction is truncated) */
+    time_t toEpochSecond(const ZoneOffset& zo) const { return static_cast<time_t>(toEpochDay()) * 86400 + _time.toSecondOfDay() - zo.totalSeconds(); }
+    /*!
+      @brief Outputs this date-time to the buffer without memory allocation, such as 2009-08-07T12:34:56.789
+      @return Length of the string without the terminator, or 0 if failed.
+     */
+    size_t toChars(char* buf, const size_t len) const { return valid() ? detail::formatDateTime(buf, len, _date, _time.ticks(), P::PER_SECOND, P::DIGITS) : 0; }
+    /*! @brief Outputs this date-time as a String, such as 2009-08-07T12:34:56.789 */
+    string_t toString() const
+    {
+        char buf[40];
+        return toChars(buf, sizeof(buf)) ? string_t(buf) : string_t();
+    }
+
+    /*! @brief Obtains an instance from the epoch and the fraction. */
+    static PreciseLocalDateTime ofEpochSecond(const time_t epoch, const uint32_t fraction, const ZoneOffset& zo)
+    {
+        return PreciseLocalDateTime(LocalDateTime::ofEpochSecond(epoch, zo), fraction);
+    }
+    /*!
+      @brief Obtains an instance from a text string such as 2009-08-07T12:34:56.789
+      @param s "YYYY-MM-DDThh:mm:ss" with optional fraction (. or ,) of any digits. Digits beyond the precision are truncated.
+      @param[out] end Pointer after the parsed string if not nullptr.
+      @return Invalid instance if failed.
+      @note Trailing characters are not errors, so check end if needed.
+     */
+    static PreciseLocalDateTime parse(const char* s, const char** end = nullptr)
+    {
+        int y, m, d;
+        auto p = detail::parseDate(s, y, m, d);
+        if(!p || *p != 'T') { return PreciseLocalDateTime(LocalDate(0, 0, 0), PreciseLocalTime<P>()); }
+        auto lt = PreciseLocalTime<P>::parse(p + 1, end);
+        return PreciseLocalDateTime(LocalDate(y, m, d), lt);
+    }
+
+#if __cplusplus < 202002L
+    friend inline bool operator==(const PreciseLocalDateTime& a, const PreciseLocalDateTime& b) { return a._date == b._date && a._time == b._time; }
+    friend inline bool operator< (const PreciseLocalDateTime& a, const PreciseLocalDateTime& b) { return a._date < b._date || (a._date == b._date && a._time < b._time); }
+    friend inline bool operator!=(const PreciseLocalDateTime& a, const PreciseLocalDateTime& b) { return std::rel_ops::operator!=(a,b); }
+    friend inline bool operator> (const PreciseLocalDateTime& a, const PreciseLocalDateTime& b) { return std::rel_ops::operator> (a,b); }
+    friend inline bool operator<=(const PreciseLocalDateTime& a, const PreciseLocalDateTime& b) { return std::rel_ops::operator<=(a,b); }
+    friend inline bool operator>=(const PreciseLocalDateTime& a, const PreciseLocalDateTime& b) { return std::rel_ops::operator>=(a,b); }
+#else
+    auto operator <=>(const PreciseLocalDateTime&) const = default;
+#endif
+
+  private:
+    LocalDate _date{};
+    PreciseLocalTime<P> _time{};
+};
+
+// for GCC C++11,C++14
+#if !defined(__clang__) && defined(__GNUG__) && __cplusplus < 201703L
+template<class P> constexpr typename PreciseLocalTime<P>::rep_t PreciseLocalTime<P>::TICKS_PER_DAY;
+template<class P> constexpr typename PreciseLocalTime<P>::rep_t PreciseLocalTime<P>::INVALID_TICKS;
+#endif
+
+///@name Aliases
+///@{
+using LocalTimeMillis = PreciseLocalTime<MilliPrecision>;
+using LocalTimeMicros = PreciseLocalTime<MicroPrecision>;
+using LocalTimeNanos  = PreciseLocalTime<NanoPrecision>;
+using LocalDateTimeMillis = PreciseLocalDateTime<MilliPrecision>;
+using LocalDateTimeMicros = PreciseLocalDateTime<MicroPrecision>;
+using LocalDateTimeNanos  = PreciseLocalDateTime<NanoPrecision>;
+///@}
+
+//
+}}
+#endif
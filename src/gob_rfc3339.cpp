@@ -0,0 +1,117 @@
+/*!
+  @file gob_rfc3339.cpp
+  @brief RFC 3339 format and parse with fractional seconds, without memory allocation.
+*/
+#include "gob_rfc3339.hpp"
+#include "gob_datetime_internal.hpp"
+#include "gob_instrumentation.hpp"
+
+namespace
+{
+using goblib::datetime::LocalDate;
+using goblib::datetime::LocalDateTime;
+using goblib::datetime::OffsetDateTime;
+using goblib::datetime::ZoneOffset;
+using goblib::datetime::detail::put2;
+using goblib::datetime::detail::get;
+
+const OffsetDateTime invalidOffsetDateTime{ LocalDateTime(LocalDate(0, 0, 0), {}), ZoneOffset::UTC };
+//
+}
+
+namespace goblib { namespace datetime {
+
+size_t formatRFC3339(char* buf, const size_t len, const OffsetDateTime& odt, const uint32_t nanos, const int precision)
+{
+    GOBLIB_DATETIME_PROBE(FormatRFC3339);
+    const int32_t off = odt.offset().totalSeconds();
+    if(!buf || precision < 0 || precision > 9 || nanos > 999999999U || odt.year() < 0 || odt.year() > 9999 || (off % 60) != 0) { return 0; }
+    const size_t sz = 19 + (precision ? precision + 1 : 0) + (off ? 6 : 1);
+    if(len <= sz) { return 0; }
+
+    char* p = buf;
+    p = put2(p, odt.year() / 100);
+    p = put2(p, odt.year() % 100);
+    *p++ = '-';
+    p = put2(p, odt.month());
+    *p++ = '-';
+    p = put2(p, odt.day());
+    *p++ = 'T';
+    p = put2(p, odt.hour());
+    *p++ = ':';
+    p = put2(p, odt.minute());
+    *p++ = ':';
+    p = put2(p, odt.second());
+    if(precision)
+    {
+        *p++ = '.';
+        uint32_t f = nanos;
+        for(int i = 9; i > precision; --i) { f /= 10; }
+        for(int i = precision - 1; i >= 0; --i) { p[i] = '0' + (f % 10); f /= 10; }
+        p += precision;
+    }
+    if(!off)
+    {
+        *p++ = 'Z';
+    }
+    else
+    {
+        const int32_t a = (off < 0) ? -off : off;
+        *p++ = (off < 0) ? '-' : '+';
+        p = put2(p, a / 3600);
+        *p++ = ':';
+        p = put2(p, (a / 60) % 60);
+    }
+    *p = '\0';
+    return p - buf;
+}
+
+OffsetDateTime parseRFC3339(const char* s, uint32_t* nanos, const char** end)
+{
+    GOBLIB_DATETIME_PROBE(ParseRFC3339);
+    if(!s) { return invalidOffsetDateTime; }
+    const char* p = s;
+    int y, mo, d, h, mi, sec;
+    if(!get(p, 4, y) || *p++ != '-' || !get(p, 2, mo) || *p++ != '-' || !get(p, 2, d)) { return invalidOffsetDateTime; }
+    if(*p != 'T' && *p != 't' && *p != ' ') { return invalidOffsetDateTime; }
+    ++p;
+    if(!get(p, 2, h) || *p++ != ':' || !get(p, 2, mi) || *p++ != ':' || !get(p, 2, sec)) { return invalidOffsetDateTime; }
+
+    uint32_t ns{};
+    if(*p == '.')
+    {
+        ++p;
+        if(static_cast<unsigned>(*p - '0') > 9) { return invalidOffsetDateTime; }
+        int n = 0;
+        for(; static_cast<unsigned>(*p - '0') <= 9; ++p, ++n)
+        {
+            if(n < 9) { ns = ns * 10 + (*p - '0'); }
+        }
+        for(; n < 9; ++n) { ns *= 10; }
+    }
+
+    int32_t off{};
+    if(*p == 'Z' || *p == 'z')
+    {
+        ++p;
+    }
+    else if(*p == '+' || *p == '-')
+    {
+        const int sign = (*p++ == '-') ? -1 : 1;
+        int oh, om;
+        if(!get(p, 2, oh) || *p++ != ':' || !get(p, 2, om) || oh > 23 || om > 59) { return invalidOffsetDateTime; }
+        off = sign * (oh * 3600 + om * 60);
+    }
+    else
+    {
+        return invalidOffsetDateTime;
+    }
+
+    OffsetDateTime odt(LocalDateTime(y, mo, d, h, mi, sec), ZoneOffset(off));
+    if(!odt.valid() || mi > 59 || sec > 60) { return invalidOffsetDateTime; }
+    if(nanos) { *nanos = ns; }
+    if(end) { *end = p; }
+    return odt;
+}
+//
+}}
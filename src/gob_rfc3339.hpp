@@ -0,0 +1,48 @@
+/*!
+  @file gob_rfc3339.hpp
+  @brief RFC 3339 format and parse with fractional seconds, without memory allocation.
+
+  @code
+  char buf[RFC3339_BUFFER_SIZE];
+  formatRFC3339(buf, sizeof(buf), odt, 123456789, 3); // "2022-12-13T12:34:56.123+09:00"
+  uint32_t nanos{};
+  auto odt2 = parseRFC3339("2022-12-13T03:34:56.5Z", &nanos); // nanos is 500000000
+  @endcode
+*/
+#ifndef GOBLIB_RFC3339_HPP
+#define GOBLIB_RFC3339_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+constexpr size_t RFC3339_BUFFER_SIZE = 36; //!< @brief Enough buffer size including the terminator. ("YYYY-MM-DDThh:mm:ss.nnnnnnnnn+hh:mm")
+
+/*!
+  @brief Outputs RFC 3339 date-time string, such as "2022-12-13T12:34:56.123Z".
+  @param[out] buf Output buffer
+  @param len Size of the buffer
+  @param odt Date-time
+  @param nanos Nanoseconds of the second [0 - 999999999]
+  @param precision Digits of fractional seconds [0 - 9] (e.g. 3 : milli, 6 : micro, 9 : nano) Truncated, not rounded.
+  @return Length of the string without the terminator, or 0 if failed.
+  @note UTC is output as "Z".
+  @note Fails if the year is not in [0 - 9999], the offset has seconds, or the buffer is too small.
+ */
+size_t formatRFC3339(char* buf, const size_t len, const OffsetDateTime& odt, const uint32_t nanos = 0, const int precision = 0);
+
+/*!
+  @brief Parses RFC 3339 date-time string.
+  @param s String such as "2022-12-13T12:34:56.123456+09:00"
+  @param[out] nanos Nanoseconds of the fractional seconds if not nullptr. Digits after the ninth are ignored.
+  @param[out] end Pointer after the parsed string if not nullptr.
+  @return Invalid instance if failed.
+  @note Accepts lowercase "t" and "z", and a space instead of "T". (RFC 3339 5.6 NOTE)
+  @note Trailing characters are not errors, so check end if needed.
+ */
+OffsetDateTime parseRFC3339(const char* s, uint32_t* nanos = nullptr, const char** end = nullptr);
+
+//
+}}
+#endif
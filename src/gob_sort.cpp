@@ -0,0 +1,116 @@
+/*!
+  @file gob_sort.cpp
+  @brief Sort and merge for arrays of LocalDate, LocalDateTime and OffsetDateTime.
+*/
+#include "gob_sort.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+using goblib::datetime::LocalDate;
+using goblib::datetime::LocalDateTime;
+using goblib::datetime::OffsetDateTime;
+using goblib::datetime::ZoneOffset;
+
+constexpr size_t RADIX_THRESHOLD = 256; // Comparison sort is faster for small arrays.
+
+// Signed value to unsigned key keeping the order.
+inline uint64_t toKey(const int64_t v) { return static_cast<uint64_t>(v) ^ (1ULL << 63); }
+
+inline uint64_t keyOf(const LocalDate& ld) { return toKey(ld.toEpochDay()); }
+inline uint64_t keyOf(const LocalDateTime& ldt) { return toKey(ldt.toEpochSecond(ZoneOffset::UTC)); }
+inline uint64_t keyOf(const OffsetDateTime& odt) { return toKey(odt.toEpochSecond()); }
+
+template<typename T> struct Item
+{
+    uint64_t key;
+    T value;
+};
+
+template<typename T> void radixSort(std::vector<Item<T>>& a)
+{
+    const size_t n = a.size();
+    std::vector<size_t> hist(8 * 256);
+    for(auto& e : a)
+    {
+        for(int b = 0; b < 8; ++b) { ++hist[b * 256 + ((e.key >> (b * 8)) & 0xFF)]; }
+    }
+
+    std::vector<Item<T>> tmp(n);
+    auto* src = &a;
+    auto* dst = &tmp;
+    for(int b = 0; b < 8; ++b)
+    {
+        size_t* h = &hist[b * 256];
+        const uint64_t firstByte = ((*src)[0].key >> (b * 8)) & 0xFF;
+        if(h[firstByte] == n) { continue; } // All keys have the same byte.
+
+        size_t sum{};
+        for(int i = 0; i < 256; ++i) { auto c = h[i]; h[i] = sum; sum += c; }
+        for(auto& e : *src) { (*dst)[h[(e.key >> (b * 8)) & 0xFF]++] = e; }
+        std::swap(src, dst);
+    }
+    if(src != &a) { a.swap(tmp); }
+}
+
+template<typename T> void sortImpl(T* first, T* last, const bool stable)
+{
+    if(!first || last - first < 2) { return; }
+    const size_t n = last - first;
+    std::vector<Item<T>> items(n);
+    for(size_t i = 0; i < n; ++i) { items[i].key = keyOf(first[i]); items[i].value = first[i]; }
+
+    if(n < RADIX_THRESHOLD)
+    {
+        auto cmp = [](const Item<T>& x, const Item<T>& y) { return x.key < y.key; };
+        if(stable) { std::stable_sort(items.begin(), items.end(), cmp); }
+        else       { std::sort(items.begin(), items.end(), cmp); }
+    }
+    else
+    {
+        radixSort(items);
+    }
+    for(size_t i = 0; i < n; ++i) { first[i] = items[i].value; }
+}
+
+template<typename T> void mergeImpl(const T* a, const size_t na, const T* b, const size_t nb, T* out)
+{
+    size_t i{}, j{};
+    uint64_t ka = na ? keyOf(a[0]) : 0, kb = nb ? keyOf(b[0]) : 0;
+    while(i < na && j < nb)
+    {
+        if(kb < ka) { *out++ = b[j++]; if(j < nb) { kb = keyOf(b[j]); } }
+        else        { *out++ = a[i++]; if(i < na) { ka = keyOf(a[i]); } }
+    }
+    while(i < na) { *out++ = a[i++]; }
+    while(j < nb) { *out++ = b[j++]; }
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+void sort(LocalDate* first, LocalDate* last) { sortImpl(first, last, false); }
+void sort(LocalDateTime* first, LocalDateTime* last) { sortImpl(first, last, false); }
+void sort(OffsetDateTime* first, OffsetDateTime* last) { sortImpl(first, last, false); }
+void stableSort(LocalDate* first, LocalDate* last) { sortImpl(first, last, true); }
+void stableSort(LocalDateTime* first, LocalDateTime* last) { sortImpl(first, last, true); }
+void stableSort(OffsetDateTime* first, OffsetDateTime* last) { sortImpl(first, last, true); }
+
+void mergeSorted(const LocalDate* a, const size_t na, const LocalDate* b, const size_t nb, LocalDate* out)
+{
+    mergeImpl(a, na, b, nb, out);
+}
+
+void mergeSorted(const LocalDateTime* a, const size_t na, const LocalDateTime* b, const size_t nb, LocalDateTime* out)
+{
+    mergeImpl(a, na, b, nb, out);
+}
+
+void mergeSorted(const OffsetDateTime* a, const size_t na, const OffsetDateTime* b, const size_t nb, OffsetDateTime* out)
+{
+    mergeImpl(a, na, b, nb, out);
+}
+//
+}}
@@ -0,0 +1,49 @@
+/*!
+  @file gob_sort.hpp
+  @brief Sort and merge for arrays of LocalDate, LocalDateTime and OffsetDateTime.
+
+  @code
+  std::vector<OffsetDateTime> v = ...;
+  sort(v.data(), v.data() + v.size()); // Same order as std::sort(v.begin(), v.end())
+  @endcode
+*/
+#ifndef GOBLIB_SORT_HPP
+#define GOBLIB_SORT_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @name Sort
+  @brief Sorts in ascending order of operator<.
+  @note The 64-bit key (epoch day or epoch second) is extracted only once per element, and then sorted by LSD radix sort.
+  Passes of the bytes that are the same for all keys are skipped.
+  @note Uses working memory of twice the array size with the keys.
+  @note sort() may use a comparison sort for small arrays, so the order of equal elements is not guaranteed.
+  stableSort() keeps the order of equal elements (e.g. OffsetDateTime of the same instant with different offsets).
+ */
+///@{
+void sort(LocalDate* first, LocalDate* last);
+void sort(LocalDateTime* first, LocalDateTime* last);
+void sort(OffsetDateTime* first, OffsetDateTime* last);
+void stableSort(LocalDate* first, LocalDate* last);
+void stableSort(LocalDateTime* first, LocalDateTime* last);
+void stableSort(OffsetDateTime* first, OffsetDateTime* last);
+///@}
+
+/*!
+  @name Merge
+  @brief Merges two sorted arrays into out, which must have the room for na + nb elements.
+  @note Equal elements of a precede those of b. The key of each element is extracted only once.
+ */
+///@{
+void mergeSorted(const LocalDate* a, const size_t na, const LocalDate* b, const size_t nb, LocalDate* out);
+void mergeSorted(const LocalDateTime* a, const size_t na, const LocalDateTime* b, const size_t nb, LocalDateTime* out);
+void mergeSorted(const OffsetDateTime* a, const size_t na, const OffsetDateTime* b, const size_t nb, OffsetDateTime* out);
+///@}
+
+//
+}}
+#endif
@@ -0,0 +1,46 @@
+/*!
+  @file gob_timer_wheel.cpp
+  @brief Hierarchical timer wheel of deadlines keyed by epoch seconds.
+*/
+#include "gob_timer_wheel.hpp"
+#include "gob_datetime_internal.hpp"
+
+namespace
+{
+using goblib::datetime::detail::ctz64;
+
+inline int clz64(uint64_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_clzll(v);
+#else
+    int n = 0;
+    while(!(v & (static_cast<uint64_t>(1) << 63))) { v <<= 1; ++n; }
+    return n;
+#endif
+}
+//
+}
+
+namespace goblib { namespace datetime { namespace detail {
+
+uint32_t highestByte(const uint64_t x)
+{
+    return static_cast<uint32_t>(63 - clz64(x)) / 8;
+}
+
+int32_t nextSetBit(const uint64_t bits[4], const uint32_t from)
+{
+    if(from >= 256) { return -1; }
+    uint32_t w = from / 64;
+    uint64_t v = bits[w] & (~static_cast<uint64_t>(0) << (from % 64));
+    for(;;)
+    {
+        if(v) { return static_cast<int32_t>(w * 64 + ctz64(v)); }
+        if(++w >= 4) { return -1; }
+        v = bits[w];
+    }
+}
+
+//
+}}}
@@ -0,0 +1,313 @@
+/*!
+  @file gob_timer_wheel.hpp
+  @brief Hierarchical timer wheel of deadlines keyed by epoch seconds.
+
+  @code
+  TimerWheel<Job> wheel(std::time(nullptr));
+  auto h = wheel.schedule(OffsetDateTime::parse("2023-01-01T00:00:00+09:00"), job);
+  wheel.schedule(LocalDateTime(2023, 3, 12, 2, 30, 0), ZoneRules::ofLocation("America/New_York"), job2);
+  wheel.cancel(h);
+  // In the loop
+  wheel.advance(std::time(nullptr), [](Job& job, const time_t due) { job.run(); });
+  @endcode
+  @note 8 levels of 256 slots cover the whole range of 64-bit epochs, so there is no overflow list.
+  @note Schedule and cancel are O(1), except that a deadline at or before now() is inserted in order among the expired timers. Advance is amortized O(1) for each timer (moved down at most 7 times), and skips empty slots by bitmaps.
+*/
+#ifndef GOBLIB_TIMER_WHEEL_HPP
+#define GOBLIB_TIMER_WHEEL_HPP
+
+#include "gob_datetime.hpp"
+#include "gob_zone_rules.hpp"
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+namespace detail
+{
+// Index of the highest non-zero byte of x. (x must not be 0)
+uint32_t highestByte(const uint64_t x);
+// Index of the first set bit at or after from in 256 bits, or -1 if none.
+int32_t nextSetBit(const uint64_t bits[4], const uint32_t from);
+}
+
+/*!
+  @class TimerWheel
+  @brief Deadlines with values, fired in the order of the epoch. (FIFO in the same epoch)
+  @tparam T Type of the value. (Default constructible and movable)
+  @note Not thread-safe.
+  @note The callback of advance() may schedule and cancel timers, but must not call advance().
+ */
+template<typename T> class TimerWheel
+{
+  public:
+    /*!
+      @class Handle
+      @brief Identifies a scheduled timer, to cancel it.
+      @note A handle of a fired or canceled timer never matches a new timer.
+     */
+    struct Handle
+    {
+        constexpr Handle() {}
+        constexpr Handle(const uint32_t i, const uint32_t g) : index(i), generation(g) {}
+        uint32_t index{0xFFFFFFFF};
+        uint32_t generation{};
+    };
+
+    ///@name Constructors
+    ///@{
+    /*! @param now Current epoch. Deadlines at or before it fire on the next advance, in the order of the epoch. */
+    explicit TimerWheel(const time_t now = 0) : _now(toKey(now))
+    {
+        for(auto& h : _heads) { h = NIL; }
+        for(auto& t : _tails) { t = NIL; }
+        for(auto& lv : _bits) { for(auto& b : lv) { b = 0; } }
+    }
+    ///@}
+
+    ///@name Properties
+    ///@{
+    time_t now()  const { return toEpoch(_now); } //!< @brief Gets the current epoch of the wheel.
+    size_t size() const { return _size; } //!< @brief Gets the number of the scheduled timers.
+    bool  empty() const { return _size == 0; } //!< @brief Is there no scheduled timer?
+    ///@}
+
+    ///@name Schedule
+    ///@{
+    /*! @brief Schedules the value at the epoch. */
+    Handle schedule(const time_t epoch, T value)
+    {
+        const uint32_t idx = allocate();
+        Node& n = _nodes[idx];
+        n.key = toKey(epoch);
+        n.value = std::move(value);
+        place(idx);
+        ++_size;
+        return Handle{ idx, n.generation };
+    }
+    /*! @brief Schedules the value at the instant of the date-time. */
+    Handle schedule(const OffsetDateTime& odt, T value) { return schedule(odt.toEpochSecond(), std::move(value)); }
+    /*!
+      @brief Schedules the value at the local date-time in the zone.
+      @note A local date-time in a gap is shifted later by the length of the gap, and in an overlap the earlier is used. (Same as ZoneRules::toEpochSecond)
+     */
+    Handle schedule(const LocalDateTime& ldt, const ZoneRules& rules, T value) { return schedule(rules.toEpochSecond(ldt), std::move(value)); }
+    /*!
+      @brief Cancels the timer.
+      @retval true Canceled
+      @retval false Already fired, canceled or invalid handle
+     */
+    bool cancel(const Handle& h)
+    {
+        if(!contains(h)) { return false; }
+        unlink(h.index);
+        release(h.index);
+        --_size;
+        return true;
+    }
+    /*! @brief Is the timer scheduled? */
+    bool contains(const Handle& h) const { return h.index < _nodes.size() && _nodes[h.index].generation == h.generation && _nodes[h.index].list != NIL; }
+    ///@}
+
+    /*!
+      @brief Gets the earliest deadline.
+      @return Epoch, or -1 if empty.
+     */
+    time_t nextDue() const
+    {
+        if(_heads[EXPIRED] != NIL) { return now(); }
+        uint32_t list;
+        uint64_t t;
+        if(!nextEvent(list, t)) { return static_cast<time_t>(-1); }
+        uint64_t mk = ~static_cast<uint64_t>(0);
+        for(uint32_t i = _heads[list]; i != NIL; i = _nodes[i].next) { mk = _nodes[i].key < mk ? _nodes[i].key : mk; }
+        return toEpoch(mk);
+    }
+
+    /*!
+      @brief Advances the wheel to the epoch, and fires the timers at or before it.
+      @param to Epoch. The wheel never goes back, so an epoch before now() fires only the expired timers.
+      @param f Callback such as void(T& value, const time_t due)
+      @return Number of the fired timers.
+      @note Timers that the callback schedules at or before now() fire on the next advance.
+     */
+    template<typename F> size_t advance(const time_t to, F f)
+    {
+        const uint64_t target = toKey(to);
+        size_t fired = fire(EXPIRED, f);
+        uint32_t list;
+        uint64_t t;
+        while(nextEvent(list, t) && t <= target)
+        {
+            _now = t;
+            if(list < SLOTS) { fired += fire(list, f); continue; }
+            // Cascade to the lower levels
+            uint32_t i = _heads[list];
+            _heads[list] = _tails[list] = NIL;
+            clearBit(list);
+            const uint32_t cur = static_cast<uint32_t>(t & (SLOTS - 1)); // Due just now
+            while(i != NIL)
+            {
+                const uint32_t next = _nodes[i].next;
+                if(_nodes[i].key == t) { link(i, cur); }
+                else                   { place(i); }
+                i = next;
+            }
+            fired += fire(cur, f);
+        }
+        if(target > _now) { _now = target; }
+        return fired;
+    }
+
+  private:
+    static constexpr uint32_t LEVELS = 8;
+    static constexpr uint32_t SLOTS = 256;
+    static constexpr uint32_t EXPIRED = LEVELS * SLOTS; // Deadlines at or before now
+    static constexpr uint32_t FIRING = EXPIRED + 1;     // Detached while firing
+    static constexpr uint32_t LISTS = FIRING + 1;
+    static constexpr uint32_t NIL = 0xFFFFFFFF;
+
+    struct Node
+    {
+        uint64_t key{};
+        uint32_t prev{NIL}, next{NIL};
+        uint32_t list{NIL}; // NIL if free
+        uint32_t generation{};
+        T value{};
+    };
+
+    // Ordered as unsigned
+    static uint64_t toKey(const time_t t) { return static_cast<uint64_t>(static_cast<int64_t>(t)) ^ (static_cast<uint64_t>(1) << 63); }
+    static time_t toEpoch(const uint64_t k) { return static_cast<time_t>(static_cast<int64_t>(k ^ (static_cast<uint64_t>(1) << 63))); }
+
+    uint32_t allocate()
+    {
+        if(_free != NIL)
+        {
+            const uint32_t idx = _free;
+            _free = _nodes[idx].next;
+            return idx;
+        }
+        _nodes.emplace_back();
+        return static_cast<uint32_t>(_nodes.size() - 1);
+    }
+    void release(const uint32_t idx)
+    {
+        Node& n = _nodes[idx];
+        n.list = NIL;
+        ++n.generation;
+        n.value = T{};
+        n.next = _free;
+        _free = idx;
+    }
+
+    void setBit(const uint32_t list)   { _bits[list / SLOTS][(list % SLOTS) / 64] |=  (static_cast<uint64_t>(1) << (list % 64)); }
+    void clearBit(const uint32_t list) { _bits[list / SLOTS][(list % SLOTS) / 64] &= ~(static_cast<uint64_t>(1) << (list % 64)); }
+
+    void link(const uint32_t idx, const uint32_t list)
+    {
+        Node& n = _nodes[idx];
+        n.list = list;
+        n.next = NIL;
+        n.prev = _tails[list];
+        if(n.prev != NIL) { _nodes[n.prev].next = idx; }
+        else              { _heads[list] = idx; if(list < EXPIRED) { setBit(list); } }
+        _tails[list] = idx;
+    }
+    // Links in the order of the key. (FIFO in the same key)
+    void linkOrdered(const uint32_t idx, const uint32_t list)
+    {
+        const uint64_t key = _nodes[idx].key;
+        uint32_t prev = _tails[list];
+        while(prev != NIL && _nodes[prev].key > key) { prev = _nodes[prev].prev; }
+        if(prev == _tails[list]) { link(idx, list); return; }
+        Node& n = _nodes[idx];
+        n.list = list;
+        n.prev = prev;
+        n.next = (prev != NIL) ? _nodes[prev].next : _heads[list];
+        _nodes[n.next].prev = idx;
+        if(prev != NIL) { _nodes[prev].next = idx; } else { _heads[list] = idx; }
+    }
+    void unlink(const uint32_t idx)
+    {
+        Node& n = _nodes[idx];
+        const uint32_t list = n.list;
+        if(n.prev != NIL) { _nodes[n.prev].next = n.next; } else { _heads[list] = n.next; }
+        if(n.next != NIL) { _nodes[n.next].prev = n.prev; } else { _tails[list] = n.prev; }
+        if(_heads[list] == NIL && list < EXPIRED) { clearBit(list); }
+    }
+    // Links to the slot by the highest byte that differs from now.
+    void place(const uint32_t idx)
+    {
+        const uint64_t key = _nodes[idx].key;
+        if(key <= _now) { linkOrdered(idx, EXPIRED); return; }
+        const uint32_t level = detail::highestByte(key ^ _now);
+        link(idx, level * SLOTS + static_cast<uint32_t>((key >> (level * 8)) & (SLOTS - 1)));
+    }
+
+    // The first slot after now. Lower levels are earlier, since the higher levels are after the end of the block of the lower.
+    bool nextEvent(uint32_t& list, uint64_t& t) const
+    {
+        for(uint32_t level = 0; level < LEVELS; ++level)
+        {
+            const uint32_t shift = level * 8;
+            const uint32_t cur = static_cast<uint32_t>((_now >> shift) & (SLOTS - 1));
+            if(cur == SLOTS - 1) { continue; }
+            const int32_t s = detail::nextSetBit(_bits[level], cur + 1);
+            if(s < 0) { continue; }
+            const uint64_t block = (shift + 8 < 64) ? (_now & ~((static_cast<uint64_t>(1) << (shift + 8)) - 1)) : 0;
+            list = level * SLOTS + static_cast<uint32_t>(s);
+            t = block | (static_cast<uint64_t>(s) << shift);
+            return true;
+        }
+        return false;
+    }
+
+    // Detaches the list and fires all of it. Timers scheduled by the callback are not fired in this call.
+    template<typename F> size_t fire(const uint32_t list, F& f)
+    {
+        if(_heads[list] == NIL) { return 0; }
+        _heads[FIRING] = _heads[list];
+        _tails[FIRING] = _tails[list];
+        _heads[list] = _tails[list] = NIL;
+        if(list < EXPIRED) { clearBit(list); }
+        for(uint32_t i = _heads[FIRING]; i != NIL; i = _nodes[i].next) { _nodes[i].list = FIRING; }
+
+        size_t fired{};
+        uint32_t idx;
+        while((idx = _heads[FIRING]) != NIL)
+        {
+            unlink(idx);
+            T value = std::move(_nodes[idx].value);
+            const time_t due = toEpoch(_nodes[idx].key);
+            release(idx);
+            --_size;
+            ++fired;
+            f(value, due);
+        }
+        return fired;
+    }
+
+    uint64_t _now{};
+    std::vector<Node> _nodes{};
+    uint32_t _free{NIL};
+    size_t _size{};
+    uint32_t _heads[LISTS];
+    uint32_t _tails[LISTS];
+    uint64_t _bits[LEVELS][SLOTS / 64];
+};
+
+// for GCC C++11,C++14
+#if !defined(__clang__) && defined(__GNUG__) && __cplusplus < 201703L
+template<typename T> constexpr uint32_t TimerWheel<T>::LEVELS;
+template<typename T> constexpr uint32_t TimerWheel<T>::SLOTS;
+template<typename T> constexpr uint32_t TimerWheel<T>::EXPIRED;
+template<typename T> constexpr uint32_t TimerWheel<T>::FIRING;
+template<typename T> constexpr uint32_t TimerWheel<T>::LISTS;
+template<typename T> constexpr uint32_t TimerWheel<T>::NIL;
+#endif
+
+//
+}}
+#endif
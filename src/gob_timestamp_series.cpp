@@ -0,0 +1,279 @@
+/*!
+  @file gob_timestamp_series.cpp
+  @brief Compressed series of timestamps by delta-of-delta encoding.
+*/
+#include "gob_timestamp_series.hpp"
+#include "gob_datetime_internal.hpp"
+#include <algorithm>
+
+namespace
+{
+using goblib::datetime::detail::ctz64;
+
+class BitReader
+{
+  public:
+    BitReader(const uint64_t* words, const size_t count, const size_t pos) : _words(words), _count(count), _pos(pos) {}
+
+    // Gets 64 bits from the current position (LSB first).
+    uint64_t peek() const
+    {
+        const size_t w = _pos >> 6;
+        const int sh = _pos & 63;
+        uint64_t v = (w < _count) ? (_words[w] >> sh) : 0;
+        if(sh && w + 1 < _count) { v |= _words[w + 1] << (64 - sh); }
+        return v;
+    }
+    void skip(const size_t n) { _pos += n; }
+
+  private:
+    const uint64_t* _words;
+    size_t _count;
+    size_t _pos;
+};
+
+// Little-endian serialization
+void put(std::vector<uint8_t>& out, uint64_t v, const int bytes)
+{
+    for(int i = 0; i < bytes; ++i) { out.push_back(static_cast<uint8_t>(v)); v >>= 8; }
+}
+
+bool get(const uint8_t*& p, const uint8_t* end, uint64_t& v, const int bytes)
+{
+    if(end - p < bytes) { return false; }
+    v = 0;
+    for(int i = 0; i < bytes; ++i) { v |= static_cast<uint64_t>(p[i]) << (i * 8); }
+    p += bytes;
+    return true;
+}
+//
+}
+
+namespace goblib { namespace datetime {
+
+// for GCC C++11,C++14
+#if !defined(__clang__) && defined(__GNUG__) && __cplusplus < 201703L
+constexpr size_t TimestampSeries::DEFAULT_BLOCK_SIZE;
+#endif
+
+void TimestampSeries::writeBits(uint64_t v, const int n)
+{
+    if(n < 64) { v &= (1ULL << n) - 1; }
+    const size_t w = _bits >> 6;
+    const int sh = _bits & 63;
+    if(w == _words.size()) { _words.push_back(0); }
+    _words[w] |= v << sh;
+    if(sh + n > 64) { _words.push_back(v >> (64 - sh)); }
+    _bits += n;
+}
+
+void TimestampSeries::append(const time_t epoch, const ZoneOffset& zo)
+{
+    const int64_t t = epoch;
+    if(_runs.empty() || _runs.back().offset != zo.totalSeconds()) { _runs.push_back({ _size, zo.totalSeconds() }); }
+
+    const size_t pos = _size % _blockSize;
+    if(pos == 0)
+    {
+        _blocks.push_back({ _bits, t, 0 });
+    }
+    else if(pos == 1)
+    {
+        _prevDelta = _blocks.back().delta = t - _prev;
+    }
+    else
+    {
+        const int64_t delta = t - _prev;
+        const int64_t dod = delta - _prevDelta;
+        // Control bits are written LSB first. ('10' is 0b01)
+        if(dod == 0)                        { writeBits(0, 1); }
+        else if(dod >=   -63 && dod <=   64) { writeBits((static_cast<uint64_t>(dod +   63) << 2) | 0x1, 2 + 7); }
+        else if(dod >=  -255 && dod <=  256) { writeBits((static_cast<uint64_t>(dod +  255) << 3) | 0x3, 3 + 9); }
+        else if(dod >= -2047 && dod <= 2048) { writeBits((static_cast<uint64_t>(dod + 2047) << 4) | 0x7, 4 + 12); }
+        else { writeBits(0xF, 4); writeBits(static_cast<uint64_t>(dod), 64); }
+        _prevDelta = delta;
+    }
+    _prev = t;
+    ++_size;
+}
+
+void TimestampSeries::clear()
+{
+    _size = _bits = 0;
+    _prev = _prevDelta = 0;
+    _words.clear();
+    _blocks.clear();
+    _runs.clear();
+}
+
+size_t TimestampSeries::decodeBlock(const size_t block, time_t* out, const size_t skip, const size_t n) const
+{
+    const Block& blk = _blocks[block];
+    const size_t count = std::min(_blockSize, _size - block * _blockSize);
+    const size_t last = std::min(count, skip + n); // exclusive
+    size_t i = 0, written = 0;
+    int64_t t = blk.first, delta = blk.delta;
+
+    if(i >= skip && i < last) { out[written++] = static_cast<time_t>(t); }
+    if(++i >= last) { return written; }
+    t += delta;
+    if(i >= skip) { out[written++] = static_cast<time_t>(t); }
+    ++i;
+
+    BitReader br(_words.data(), _words.size(), blk.bitOffset);
+    while(i < last)
+    {
+        const uint64_t x = br.peek();
+        if(!(x & 1))
+        {
+            // Consecutive zero delta-of-delta
+            size_t z = x ? ctz64(x) : 64;
+            z = std::min(z, last - i);
+            br.skip(z);
+            for(size_t k = 0; k < z; ++k, ++i)
+            {
+                t += delta;
+                if(i >= skip) { out[written++] = static_cast<time_t>(t); }
+            }
+            continue;
+        }
+        int64_t dod;
+        if(!(x & 2))      { dod = static_cast<int64_t>((x >> 2) & 0x7F)  -   63; br.skip(2 + 7); }
+        else if(!(x & 4)) { dod = static_cast<int64_t>((x >> 3) & 0x1FF) -  255; br.skip(3 + 9); }
+        else if(!(x & 8)) { dod = static_cast<int64_t>((x >> 4) & 0xFFF) - 2047; br.skip(4 + 12); }
+        else { br.skip(4); dod = static_cast<int64_t>(br.peek()); br.skip(64); }
+        delta += dod;
+        t += delta;
+        if(i >= skip) { out[written++] = static_cast<time_t>(t); }
+        ++i;
+    }
+    return written;
+}
+
+time_t TimestampSeries::epochAt(const size_t index) const
+{
+    time_t t{};
+    if(index < _size) { decodeBlock(index / _blockSize, &t, index % _blockSize, 1); }
+    return t;
+}
+
+ZoneOffset TimestampSeries::offsetAt(const size_t index) const
+{
+    auto it = std::upper_bound(_runs.begin(), _runs.end(), index, [](const size_t i, const Run& r) { return i < r.index; });
+    return (it != _runs.begin()) ? ZoneOffset((it - 1)->offset) : ZoneOffset::UTC;
+}
+
+OffsetDateTime TimestampSeries::at(const size_t index) const
+{
+    auto zo = offsetAt(index);
+    return OffsetDateTime(LocalDateTime::ofEpochSecond(epochAt(index), zo), zo);
+}
+
+size_t TimestampSeries::decode(time_t* out, const size_t first, const size_t n) const
+{
+    if(first >= _size) { return 0; }
+    const size_t end = std::min(_size, first + n);
+    size_t i = first;
+    while(i < end)
+    {
+        const size_t block = i / _blockSize;
+        const size_t skip = i % _blockSize;
+        i += decodeBlock(block, out + (i - first), skip, end - i);
+    }
+    return end - first;
+}
+
+size_t TimestampSeries::decode(OffsetDateTime* out, const size_t first, const size_t n) const
+{
+    if(first >= _size) { return 0; }
+    const size_t end = std::min(_size, first + n);
+    auto run = std::upper_bound(_runs.begin(), _runs.end(), first, [](const size_t i, const Run& r) { return i < r.index; }) - 1;
+
+    time_t epochs[64];
+    for(size_t i = first; i < end;)
+    {
+        const size_t cnt = decode(epochs, i, std::min<size_t>(64, end - i));
+        for(size_t k = 0; k < cnt; ++k, ++i)
+        {
+            while(run + 1 != _runs.end() && (run + 1)->index <= i) { ++run; }
+            const ZoneOffset zo(run->offset);
+            out[i - first] = OffsetDateTime(LocalDateTime::ofEpochSecond(epochs[k], zo), zo);
+        }
+    }
+    return end - first;
+}
+
+size_t TimestampSeries::serializedSize() const
+{
+    return 4 + 8 + 4 + _runs.size() * 12 + 8 + _blocks.size() * 24 + _words.size() * 8;
+}
+
+/*
+  Format (little-endian)
+  u32 blockSize, u64 size
+  u32 runCount, { u64 index, i32 offset } * runCount
+  u64 bits, { u64 bitOffset, i64 first, i64 delta } * ceil(size / blockSize), u64 words * ceil(bits / 64)
+*/
+void TimestampSeries::serialize(std::vector<uint8_t>& out) const
+{
+    out.reserve(out.size() + serializedSize());
+    put(out, _blockSize, 4);
+    put(out, _size, 8);
+    put(out, _runs.size(), 4);
+    for(auto& r : _runs) { put(out, r.index, 8); put(out, static_cast<uint32_t>(r.offset), 4); }
+    put(out, _bits, 8);
+    for(auto& b : _blocks) { put(out, b.bitOffset, 8); put(out, b.first, 8); put(out, b.delta, 8); }
+    for(auto& w : _words) { put(out, w, 8); }
+}
+
+TimestampSeries TimestampSeries::deserialize(const uint8_t* data, const size_t len)
+{
+    if(!data) { return TimestampSeries(); }
+    const uint8_t* p = data;
+    const uint8_t* end = data + len;
+    uint64_t bs{}, size{}, runs{}, bits{};
+    if(!get(p, end, bs, 4) || !bs || !get(p, end, size, 8) || !get(p, end, runs, 4)) { return TimestampSeries(); }
+    if(runs > size || (size && !runs)) { return TimestampSeries(); }
+
+    TimestampSeries ts(bs);
+    for(uint64_t i = 0; i < runs; ++i)
+    {
+        uint64_t idx{}, off{};
+        if(!get(p, end, idx, 8) || !get(p, end, off, 4) || idx >= size) { return TimestampSeries(); }
+        // The first run starts at 0, and the indices strictly increase.
+        if(i ? idx <= ts._runs.back().index : idx != 0) { return TimestampSeries(); }
+        ts._runs.push_back({ static_cast<size_t>(idx), static_cast<int32_t>(static_cast<uint32_t>(off)) });
+    }
+    if(!get(p, end, bits, 8)) { return TimestampSeries(); }
+    // Counts are checked against the rest before multiplying, so that they never wrap.
+    const uint64_t blocks = size / bs + (size % bs != 0);
+    const uint64_t words = bits / 64 + (bits % 64 != 0);
+    const uint64_t rest = static_cast<uint64_t>(end - p);
+    if(blocks > rest / 24 || words > (rest - blocks * 24) / 8 || rest != blocks * 24 + words * 8) { return TimestampSeries(); }
+    ts._blocks.reserve(blocks);
+    for(uint64_t i = 0; i < blocks; ++i)
+    {
+        uint64_t off{}, first{}, delta{};
+        if(!get(p, end, off, 8) || !get(p, end, first, 8) || !get(p, end, delta, 8) || off > bits) { return TimestampSeries(); }
+        ts._blocks.push_back({ static_cast<size_t>(off), static_cast<int64_t>(first), static_cast<int64_t>(delta) });
+    }
+    ts._words.reserve(words);
+    for(uint64_t i = 0; i < words; ++i)
+    {
+        uint64_t w{};
+        if(!get(p, end, w, 8)) { return TimestampSeries(); }
+        ts._words.push_back(w);
+    }
+    ts._size = size;
+    ts._bits = bits;
+
+    // Restore the state for appending.
+    if(size)
+    {
+        ts._prev = ts.epochAt(size - 1);
+        ts._prevDelta = ((size - 1) % bs) ? ts._prev - ts.epochAt(size - 2) : 0;
+    }
+    return ts;
+}
+//
+}}
@@ -0,0 +1,132 @@
+/*!
+  @file gob_timestamp_series.hpp
+  @brief Compressed series of timestamps by delta-of-delta encoding.
+
+  @code
+  TimestampSeries ts;
+  for(auto& odt : samples) { ts.append(odt); } // Streaming
+  std::vector<uint8_t> bytes;
+  ts.serialize(bytes); // to store or send
+  auto restored = TimestampSeries::deserialize(bytes.data(), bytes.size());
+  OffsetDateTime odt = restored.at(12345); // Random access
+  @endcode
+*/
+#ifndef GOBLIB_TIMESTAMP_SERIES_HPP
+#define GOBLIB_TIMESTAMP_SERIES_HPP
+
+#include "gob_datetime.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class TimestampSeries
+  @brief Series of epochs with offsets, compressed like Gorilla (Facebook's time series database).
+  @note Epochs are encoded by delta-of-delta with variable-length bit packing.
+  | Delta-of-delta     | Bits |
+  |--------------------|------|
+  | 0                  | '0' |
+  | [-63, 64]          | '10' + 7 |
+  | [-255, 256]        | '110' + 9 |
+  | [-2047, 2048]      | '1110' + 12 |
+  | otherwise          | '1111' + 64 |
+  @note Samples are divided into blocks. Each block has the first epoch and delta in the index, so a sample can be decoded from the start of its block.
+  @note Offsets are run-length encoded. A series with a constant offset has only one run.
+  @note A regular series (constant interval and offset) takes 1 bit per sample and the block index.
+ */
+class TimestampSeries
+{
+  public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 512; //!< @brief Default number of samples in a block.
+
+    ///@name Constructors
+    ///@{
+    /*! @param blockSize Number of samples in a block. Smaller value makes random access faster and compression worse. */
+    explicit TimestampSeries(const size_t blockSize = DEFAULT_BLOCK_SIZE) : _blockSize(blockSize ? blockSize : 1) {}
+    ///@}
+
+    ///@name Encode
+    ///@{
+    /*! @brief Appends an epoch with the offset. */
+    void append(const time_t epoch, const ZoneOffset& zo = ZoneOffset::UTC);
+    /*! @brief Appends OffsetDateTime. */
+    void append(const OffsetDateTime& odt) { append(odt.toEpochSecond(), odt.offset()); }
+    /*! @brief Removes all samples. */
+    void clear();
+    ///@}
+
+    ///@name Properties
+    ///@{
+    size_t size() const { return _size; } //!< @brief Gets the number of samples.
+    bool empty() const { return _size == 0; } //!< @brief Is empty?
+    size_t blockSize() const { return _blockSize; } //!< @brief Gets the number of samples in a block.
+    size_t bitsOfSamples() const { return _bits; } //!< @brief Gets the bits of encoded delta-of-delta.
+    size_t serializedSize() const; //!< @brief Gets the bytes of serialized data.
+    ///@}
+
+    ///@name Decode
+    ///@{
+    /*! @brief Gets the epoch at the index. */
+    time_t epochAt(const size_t index) const;
+    /*! @brief Gets the offset at the index. */
+    ZoneOffset offsetAt(const size_t index) const;
+    /*! @brief Gets the OffsetDateTime at the index. */
+    OffsetDateTime at(const size_t index) const;
+    /*!
+      @brief Decodes epochs.
+      @param[out] out Epochs
+      @param first First index
+      @param n Number of samples
+      @return Number of decoded samples
+     */
+    size_t decode(time_t* out, const size_t first, const size_t n) const;
+    /*!
+      @brief Decodes OffsetDateTime.
+      @param[out] out OffsetDateTimes
+      @param first First index
+      @param n Number of samples
+      @return Number of decoded samples
+     */
+    size_t decode(OffsetDateTime* out, const size_t first, const size_t n) const;
+    ///@}
+
+    ///@name Serialize
+    ///@{
+    /*! @brief Appends the serialized data (little-endian) to the buffer. */
+    void serialize(std::vector<uint8_t>& out) const;
+    /*!
+      @brief Restores the series from serialized data.
+      @return Empty series if failed.
+     */
+    static TimestampSeries deserialize(const uint8_t* data, const size_t len);
+    ///@}
+
+  private:
+    struct Block
+    {
+        size_t bitOffset;
+        int64_t first; // The first epoch
+        int64_t delta; // Delta between the first and the second epoch
+    };
+    struct Run
+    {
+        size_t index;   // The first index of the run
+        int32_t offset; // Offset seconds
+    };
+
+    void writeBits(const uint64_t v, const int n);
+    size_t decodeBlock(const size_t block, time_t* out, const size_t skip, const size_t n) const;
+
+    size_t _blockSize{DEFAULT_BLOCK_SIZE};
+    size_t _size{};
+    size_t _bits{};
+    int64_t _prev{}, _prevDelta{};
+    std::vector<uint64_t> _words;
+    std::vector<Block> _blocks;
+    std::vector<Run> _runs;
+};
+
+//
+}}
+#endif
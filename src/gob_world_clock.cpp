@@ -0,0 +1,174 @@
+/*!
+  @file gob_world_clock.cpp
+  @brief Converts an instant to the date-times of many zones at once.
+*/
+#include "gob_world_clock.hpp"
+#include "gob_datetime_internal.hpp"
+#include <limits>
+
+namespace
+{
+using goblib::datetime::LocalDate;
+using goblib::datetime::LocalTime;
+using goblib::datetime::LocalDateTime;
+using goblib::datetime::detail::SEC_PER_DAY;
+using goblib::datetime::detail::floorDiv;
+using goblib::datetime::detail::put2;
+
+// UTC date decomposed once, shared by all the zones.
+struct Decomposed
+{
+    explicit Decomposed(const time_t epoch)
+    {
+        const int64_t days = floorDiv(epoch, SEC_PER_DAY);
+        sod = static_cast<int32_t>(epoch - days * SEC_PER_DAY);
+        for(int i = 0; i < 3; ++i) { dates[i] = LocalDate::ofEpochDay(static_cast<int32_t>(days - 1 + i)); }
+    }
+    // Index of the date and the second of the day in the offset. (The offset is less than a day)
+    int dayIndex(const int32_t offset, int32_t& s) const
+    {
+        s = sod + offset;
+        if(s < 0) { s += SEC_PER_DAY; return 0; }
+        if(s >= SEC_PER_DAY) { s -= SEC_PER_DAY; return 2; }
+        return 1;
+    }
+    LocalDate dates[3]; // Previous day, the day and the next day
+    int32_t sod;
+};
+
+// "YYYY-MM-DD" of the dates, or empty if the year is out of the range.
+struct DatePrefixes
+{
+    explicit DatePrefixes(const Decomposed& d)
+    {
+        for(int i = 0; i < 3; ++i)
+        {
+            const LocalDate& ld = d.dates[i];
+            ok[i] = ld.year() >= 0 && ld.year() <= 9999;
+            if(!ok[i]) { continue; }
+            char* p = str[i];
+            p = put2(p, ld.year() / 100);
+            p = put2(p, ld.year() % 100);
+            *p++ = '-';
+            p = put2(p, ld.month());
+            *p++ = '-';
+            put2(p, ld.day());
+        }
+    }
+    char str[3][10];
+    bool ok[3];
+};
+//
+}
+
+namespace goblib { namespace datetime {
+
+WorldClock::WorldClock(const std::vector<ZoneRules>& zones)
+{
+    _zones.reserve(zones.size());
+    for(auto& zr : zones) { add(zr); }
+}
+
+bool WorldClock::add(const ZoneRules& zr)
+{
+    if(!zr.valid()) { return false; }
+    Zone z{};
+    z.rules = zr;
+    _zones.push_back(z);
+    return true;
+}
+
+void WorldClock::refresh(Zone& z, const time_t epoch)
+{
+    if(epoch >= z.from && epoch < z.until) { return; }
+
+    const int32_t off = z.rules.offset(epoch).totalSeconds();
+    if(z.rules.isFixedOffset())
+    {
+        z.from = std::numeric_limits<time_t>::min();
+        z.until = std::numeric_limits<time_t>::max();
+    }
+    else
+    {
+        // The last transition at or before the epoch, and the first after it.
+        const auto prev = z.rules.previousTransition(epoch < std::numeric_limits<time_t>::max() ? epoch + 1 : epoch);
+        const auto next = z.rules.nextTransition(epoch);
+        z.from = prev.valid() ? prev.epochSecond() : std::numeric_limits<time_t>::min();
+        z.until = next.valid() ? next.epochSecond() : std::numeric_limits<time_t>::max();
+    }
+    if(off == z.offset && z.suffixLength) { return; }
+
+    z.offset = off;
+    char* p = z.suffix;
+    if(off % 60) { z.suffixLength = 0; z.suffix[0] = '\0'; return; }
+    if(!off)
+    {
+        *p++ = 'Z';
+    }
+    else
+    {
+        const int32_t a = (off < 0) ? -off : off;
+        *p++ = (off < 0) ? '-' : '+';
+        p = put2(p, a / 3600);
+        *p++ = ':';
+        p = put2(p, (a / 60) % 60);
+    }
+    *p = '\0';
+    z.suffixLength = static_cast<uint8_t>(p - z.suffix);
+}
+
+void WorldClock::convert(OffsetDateTime* out, const time_t epoch)
+{
+    const Decomposed d(epoch);
+    for(auto& z : _zones)
+    {
+        refresh(z, epoch);
+        int32_t s;
+        const int idx = d.dayIndex(z.offset, s);
+        *out++ = OffsetDateTime(LocalDateTime(d.dates[idx], LocalTime::ofSecondOfDay(s)), ZoneOffset(z.offset));
+    }
+}
+
+void WorldClock::convert(OffsetDateTime* out, const time_t* epochs, const size_t n)
+{
+    for(size_t j = 0; j < n; ++j) { convert(out + j * _zones.size(), epochs[j]); }
+}
+
+size_t WorldClock::format(char* out, const size_t stride, const time_t epoch)
+{
+    if(!out || !stride) { return 0; }
+    const Decomposed d(epoch);
+    const DatePrefixes dp(d);
+    size_t formatted{};
+    for(auto& z : _zones)
+    {
+        char* p = out;
+        out += stride;
+        refresh(z, epoch);
+        int32_t s;
+        const int idx = d.dayIndex(z.offset, s);
+        if(!dp.ok[idx] || !z.suffixLength || stride <= 19U + z.suffixLength) { *p = '\0'; continue; }
+
+        for(int i = 0; i < 10; ++i) { p[i] = dp.str[idx][i]; }
+        p += 10;
+        *p++ = 'T';
+        p = put2(p, s / 3600);
+        *p++ = ':';
+        p = put2(p, (s / 60) % 60);
+        *p++ = ':';
+        p = put2(p, s % 60);
+        for(uint8_t i = 0; i <= z.suffixLength; ++i) { p[i] = z.suffix[i]; } // With the terminator
+        ++formatted;
+    }
+    return formatted;
+}
+
+size_t WorldClock::format(char* out, const size_t stride, const time_t* epochs, const size_t n)
+{
+    size_t formatted{};
+    for(size_t j = 0; j < n; ++j) { formatted += format(out + j * _zones.size() * stride, stride, epochs[j]); }
+    return formatted;
+}
+
+//
+}}
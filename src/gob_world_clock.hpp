@@ -0,0 +1,120 @@
+/*!
+  @file gob_world_clock.hpp
+  @brief Converts an instant to the date-times of many zones at once.
+
+  @code
+  WorldClock wc;
+  wc.add(ZoneRules::ofLocation("Asia/Tokyo"));
+  wc.add(ZoneRules::ofLocation("America/New_York"));
+  wc.add(ZoneRules::ofLocation("Europe/London"));
+
+  OffsetDateTime odts[3];
+  wc.convert(odts, std::time(nullptr)); // odts[i] is the date-time in the zone i
+
+  char strs[3][RFC3339_BUFFER_SIZE];
+  wc.format(strs[0], RFC3339_BUFFER_SIZE, std::time(nullptr)); // "2023-01-01T09:00:00+09:00", ...
+  @endcode
+  @note The UTC date is decomposed once for each epoch, and each zone applies only its offset and moves to the previous or next day at most.
+  @note The offset of each zone is cached until its next transition, so the refreshes of a clock cost no transition search.
+*/
+#ifndef GOBLIB_WORLD_CLOCK_HPP
+#define GOBLIB_WORLD_CLOCK_HPP
+
+#include "gob_datetime.hpp"
+#include "gob_zone_rules.hpp"
+#include <vector>
+#include <cstddef>
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class WorldClock
+  @brief Set of the zones to convert an instant to.
+  @note Not thread-safe, since the conversions update the cache of the offsets.
+ */
+class WorldClock
+{
+  public:
+    ///@name Constructors
+    ///@{
+    WorldClock() {}
+    /*! @param zones Zone rules. Invalid rules are ignored. */
+    explicit WorldClock(const std::vector<ZoneRules>& zones);
+    ///@}
+
+    ///@name Properties
+    ///@{
+    size_t size() const { return _zones.size(); } //!< @brief Gets the number of the zones.
+    bool  empty() const { return _zones.empty(); } //!< @brief Is there no zone?
+    const ZoneRules& rules(const size_t i) const { return _zones[i].rules; } //!< @brief Gets the rules of the zone i.
+    ///@}
+
+    ///@name Zones
+    ///@{
+    /*!
+      @brief Appends the zone. Its index is the size() before the call.
+      @return False if the rules are invalid. (Not appended)
+     */
+    bool add(const ZoneRules& zr);
+    /*! @brief Removes all the zones. */
+    void clear() { _zones.clear(); }
+    ///@}
+
+    ///@name Conversion
+    ///@{
+    /*!
+      @brief Converts the epoch to the date-times of all the zones.
+      @param[out] out size() date-times. out[i] is in the zone i.
+      @param epoch Epoch
+     */
+    void convert(OffsetDateTime* out, const time_t epoch);
+    /*!
+      @brief Converts the epochs to the date-times of all the zones.
+      @param[out] out n * size() date-times. out[j * size() + i] is epochs[j] in the zone i.
+      @param epochs Epochs
+      @param n Number of the epochs
+      @note Sorted epochs hit the cache of the offsets most.
+     */
+    void convert(OffsetDateTime* out, const time_t* epochs, const size_t n);
+    ///@}
+
+    ///@name Format
+    ///@{
+    /*!
+      @brief Outputs RFC 3339 strings of the epoch in all the zones to fixed length records.
+      @param[out] out Buffer of size() * stride bytes. The string of the zone i is at out + i * stride with the terminator.
+      @param stride Size of a record (RFC3339_BUFFER_SIZE is enough)
+      @param epoch Epoch
+      @return Number of the formatted strings. Failed records are empty strings. (Year out of [0, 9999], the offset with seconds or short stride)
+      @note Same strings as formatRFC3339 without the fraction.
+     */
+    size_t format(char* out, const size_t stride, const time_t epoch);
+    /*!
+      @brief Outputs RFC 3339 strings of the epochs in all the zones to fixed length records.
+      @param[out] out Buffer of n * size() * stride bytes. The string of epochs[j] in the zone i is at out + (j * size() + i) * stride.
+      @param stride Size of a record
+      @param epochs Epochs
+      @param n Number of the epochs
+      @return Number of the formatted strings.
+     */
+    size_t format(char* out, const size_t stride, const time_t* epochs, const size_t n);
+    ///@}
+
+  private:
+    struct Zone
+    {
+        ZoneRules rules{};
+        time_t from{1}, until{0}; // The offset is valid in [from, until). Empty at first.
+        int32_t offset{};
+        char suffix[7]{}; // "Z" or "+hh:mm", empty if the offset has seconds.
+        uint8_t suffixLength{};
+    };
+    // Updates the cache if the epoch is out of the range.
+    static void refresh(Zone& z, const time_t epoch);
+
+    std::vector<Zone> _zones{};
+};
+
+//
+}}
+#endif
@@ -0,0 +1,66 @@
+/*!
+  @file gob_zone_context.cpp
+  @brief Time-zone context for each thread, instead of the process TZ environment.
+*/
+#include "gob_zone_context.hpp"
+
+#if defined(GOBLIB_DATETIME_DISABLE_THREAD_LOCAL)
+# define GOBLIB_DATETIME_THREAD_LOCAL /**/
+#else
+# define GOBLIB_DATETIME_THREAD_LOCAL thread_local
+#endif
+
+namespace
+{
+using goblib::datetime::ZoneContext;
+
+// Constant-initialized, so no guard for dynamic initialization on each access.
+GOBLIB_DATETIME_THREAD_LOCAL ZoneContext currentContext{};
+GOBLIB_DATETIME_THREAD_LOCAL bool hasCurrentContext{};
+//
+}
+
+namespace goblib { namespace datetime {
+
+// ----------------------------------------------------------------------
+// class ZoneContext
+OffsetDateTime ZoneContext::toOffsetDateTime(const time_t epoch) const
+{
+    auto zo = offset(epoch);
+    return OffsetDateTime(LocalDateTime::ofEpochSecond(epoch, zo), zo);
+}
+
+const ZoneContext* ZoneContext::current()
+{
+    return hasCurrentContext ? &currentContext : nullptr;
+}
+
+bool ZoneContext::setCurrent(const ZoneContext& ctx)
+{
+    if(!ctx.valid()) { return false; }
+    currentContext = ctx;
+    hasCurrentContext = true;
+    return true;
+}
+
+void ZoneContext::resetCurrent()
+{
+    hasCurrentContext = false;
+}
+
+// ----------------------------------------------------------------------
+// class ScopedZoneContext
+ScopedZoneContext::ScopedZoneContext(const ZoneContext& ctx)
+{
+    auto prev = ZoneContext::current();
+    if(prev) { _prev = *prev; _hasPrev = true; }
+    ZoneContext::setCurrent(ctx);
+}
+
+ScopedZoneContext::~ScopedZoneContext()
+{
+    if(_hasPrev) { ZoneContext::setCurrent(_prev); }
+    else { ZoneContext::resetCurrent(); }
+}
+//
+}}
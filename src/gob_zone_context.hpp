@@ -0,0 +1,101 @@
+/*!
+  @file gob_zone_context.hpp
+  @brief Time-zone context for each thread, instead of the process TZ environment.
+
+  @code
+  // In each worker thread
+  ScopedZoneContext scope(ZoneContext::ofLocation(user.location));
+  auto ldt = LocalDateTime::now(); // Local date-time of the user's zone, without setenv("TZ") and tzset()
+
+  // Or pass it explicitly
+  auto ctx = ZoneContext::ofLocation("America/Los_Angeles");
+  auto odt = OffsetDateTime::now(ctx);
+  @endcode
+*/
+#ifndef GOBLIB_ZONE_CONTEXT_HPP
+#define GOBLIB_ZONE_CONTEXT_HPP
+
+#include "gob_datetime.hpp"
+#include "gob_zone_rules.hpp"
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class ZoneContext
+  @brief The time-zone used by now() and conversions, computed by ZoneRules without libc functions and the TZ environment.
+  @note now() of each class uses the context of the current thread if set, otherwise the process TZ environment as before.
+  @note Define GOBLIB_DATETIME_DISABLE_THREAD_LOCAL if the platform does not support thread_local. (The context is shared by all threads)
+*/
+class ZoneContext
+{
+  public:
+    ///@name Constructors
+    ///@{
+    constexpr ZoneContext() {} // UTC
+    constexpr explicit ZoneContext(const ZoneRules& zr) : _rules(zr) {}
+    ///@}
+
+    ///@name Properties
+    ///@{
+    constexpr const ZoneRules& rules() const { return _rules; } //!< @brief Gets the zone rules.
+    ///@}
+
+    /*! @brief Is valid instance? */
+    constexpr bool valid() const { return _rules.valid(); }
+    /*! @brief Gets the offset applicable at the specified epoch. */
+    ZoneOffset offset(const time_t epoch) const { return _rules.offset(epoch); }
+    /*! @brief Converts the epoch to the local date-time. */
+    LocalDateTime toLocalDateTime(const time_t epoch) const { return LocalDateTime::ofEpochSecond(epoch, offset(epoch)); }
+    /*! @brief Converts the epoch to the date-time with the offset. */
+    OffsetDateTime toOffsetDateTime(const time_t epoch) const;
+    /*!
+      @brief Converts the local date-time to the date-time with the offset.
+      @note Gap and overlap are resolved as ZoneRules::toEpochSecond.
+     */
+    OffsetDateTime toOffsetDateTime(const LocalDateTime& ldt) const { return toOffsetDateTime(toEpochSecond(ldt)); }
+    /*! @brief Converts the local date-time to the epoch. */
+    time_t toEpochSecond(const LocalDateTime& ldt) const { return _rules.toEpochSecond(ldt); }
+
+    /*! @brief Obtains an instance from POSIX TZ string. */
+    static ZoneContext parse(const char* posix) { return ZoneContext(ZoneRules::parse(posix)); }
+    /*! @brief Obtains an instance from location such as "Asia/Tokyo". */
+    static ZoneContext ofLocation(const char* location) { return ZoneContext(ZoneRules::ofLocation(location)); }
+
+    ///@name Context of the current thread
+    ///@{
+    /*! @brief Gets the context of the current thread, or nullptr if not set. (The process TZ environment is used) */
+    static const ZoneContext* current();
+    /*!
+      @brief Sets the context of the current thread.
+      @return False if the context is invalid. (Not set)
+     */
+    static bool setCurrent(const ZoneContext& ctx);
+    /*! @brief Resets the context of the current thread. (Use the process TZ environment) */
+    static void resetCurrent();
+    ///@}
+
+  private:
+    ZoneRules _rules{};
+};
+
+/*!
+  @class ScopedZoneContext
+  @brief Sets the context of the current thread in the scope, and restores the previous one on destruction.
+*/
+class ScopedZoneContext
+{
+  public:
+    explicit ScopedZoneContext(const ZoneContext& ctx);
+    ~ScopedZoneContext();
+
+    ScopedZoneContext(const ScopedZoneContext&) = delete;
+    ScopedZoneContext& operator=(const ScopedZoneContext&) = delete;
+
+  private:
+    ZoneContext _prev{};
+    bool _hasPrev{};
+};
+
+//
+}}
+#endif
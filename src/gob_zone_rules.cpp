@@ -0,0 +1,312 @@
+/*!
+  @file gob_zone_rules.cpp
+  @brief The rules defining how the zone offset varies, made from POSIX TZ string.
+*/
+#include "gob_zone_rules.hpp"
+#include "gob_datetime_internal.hpp"
+#include "gob_instrumentation.hpp"
+#include <cctype>
+
+namespace
+{
+using goblib::datetime::ZoneRules;
+using goblib::datetime::ZoneOffsetTransition;
+using goblib::datetime::detail::SEC_PER_MIN;
+using goblib::datetime::detail::SEC_PER_HOUR;
+using goblib::datetime::detail::SEC_PER_DAY;
+using goblib::datetime::detail::floorDiv;
+
+// std / dst name. "JST" or "<+0930>"
+const char* parseName(const char* p)
+{
+    if(*p == '<')
+    {
+        while(*p && *p != '>') { ++p; }
+        return *p ? p + 1 : nullptr;
+    }
+    const char* s = p;
+    while(std::isalpha(static_cast<unsigned char>(*p))) { ++p; }
+    return (p - s >= 3) ? p : nullptr;
+}
+
+const char* parseNumber(const char* p, int32_t& v, const int maxDigits)
+{
+    if(!std::isdigit(static_cast<unsigned char>(*p))) { return nullptr; }
+    v = 0;
+    for(int i = 0; i < maxDigits && std::isdigit(static_cast<unsigned char>(*p)); ++i)
+    {
+        v = v * 10 + (*p++ - '0');
+    }
+    return p;
+}
+
+// [+|-]hh[:mm[:ss]]
+const char* parseTime(const char* p, int32_t& sec)
+{
+    int sign = 1;
+    if(*p == '+' || *p == '-') { sign = (*p++ == '-') ? -1 : 1; }
+    int32_t hh{}, mm{}, ss{};
+    if(!(p = parseNumber(p, hh, 3))) { return nullptr; }
+    if(*p == ':')
+    {
+        if(!(p = parseNumber(p + 1, mm, 2))) { return nullptr; }
+        if(*p == ':' && !(p = parseNumber(p + 1, ss, 2))) { return nullptr; }
+    }
+    sec = sign * (hh * SEC_PER_HOUR + mm * SEC_PER_MIN + ss);
+    return p;
+}
+
+// Jn | n | Mm.w.d [/time]
+const char* parseRule(const char* p, ZoneRules::Rule& r)
+{
+    int32_t v{};
+    if(*p == 'M')
+    {
+        r.type = ZoneRules::Rule::Type::MonthWeekDay;
+        if(!(p = parseNumber(p + 1, v, 2)) || v < 1 || v > 12 || *p != '.') { return nullptr; }
+        r.month = v;
+        if(!(p = parseNumber(p + 1, v, 1)) || v < 1 || v > 5 || *p != '.') { return nullptr; }
+        r.week = v;
+        if(!(p = parseNumber(p + 1, v, 1)) || v > 6) { return nullptr; }
+        r.dayOfWeek = v;
+    }
+    else if(*p == 'J')
+    {
+        r.type = ZoneRules::Rule::Type::Julian1;
+        if(!(p = parseNumber(p + 1, v, 3)) || v < 1 || v > 365) { return nullptr; }
+        r.day = v;
+    }
+    else
+    {
+        r.type = ZoneRules::Rule::Type::Julian0;
+        if(!(p = parseNumber(p, v, 3)) || v > 365) { return nullptr; }
+        r.day = v;
+    }
+    r.time = 2 * SEC_PER_HOUR;
+    if(*p == '/' && !(p = parseTime(p + 1, r.time))) { return nullptr; }
+    return p;
+}
+
+// Range of the local date-time [lo, hi) that is skipped or repeated by the transition.
+inline int64_t localLo(const ZoneOffsetTransition& tr)
+{
+    const int32_t b = tr.offsetBefore().totalSeconds(), a = tr.offsetAfter().totalSeconds();
+    return static_cast<int64_t>(tr.epochSecond()) + (a < b ? a : b);
+}
+inline int64_t localHi(const ZoneOffsetTransition& tr)
+{
+    const int32_t b = tr.offsetBefore().totalSeconds(), a = tr.offsetAfter().totalSeconds();
+    return static_cast<int64_t>(tr.epochSecond()) + (a < b ? b : a);
+}
+
+// Days around the new year where the transitions of the neighboring year may be. (Rule time is up to 167 hours, and the offsets)
+constexpr int16_t NEIGHBOR_DAYS = 10;
+//
+}
+
+namespace goblib { namespace datetime {
+
+// ----------------------------------------------------------------------
+// struct ZoneRules::Rule
+int32_t ZoneRules::Rule::epochDay(const int16_t year) const
+{
+    LocalDate ld(year, (type == Type::MonthWeekDay) ? month : 1, 1);
+    switch(type)
+    {
+    case Type::Julian1: return ld.toEpochDay() + day - 1 + (ld.isLeapYear() && day >= 60);
+    case Type::Julian0: return ld.toEpochDay() + day;
+    default: break;
+    }
+    int32_t d = 1 + (dayOfWeek - static_cast<int32_t>(ld.dayOfWeek()) + 7) % 7 + (week - 1) * 7;
+    while(d > ld.lengthOfMonth()) { d -= 7; }
+    return ld.toEpochDay() + d - 1;
+}
+
+// ----------------------------------------------------------------------
+// class ZoneRules
+ZoneOffset ZoneRules::offset(const time_t epoch) const
+{
+    GOBLIB_DATETIME_PROBE(ZoneRulesOffset);
+    return isDaylightSavings(epoch) ? _dst : _std;
+}
+
+bool ZoneRules::isDaylightSavings(const time_t epoch) const
+{
+    if(!_hasDST) { return false; }
+    auto year = LocalDate::ofEpochDay(floorDiv((int64_t)epoch + _std.totalSeconds(), SEC_PER_DAY)).year();
+    auto s = daylightStart(year);
+    auto e = daylightEnd(year);
+    return (s < e) ? (epoch >= s && epoch < e) : !(epoch >= e && epoch < s); // Northern / Southern hemisphere
+}
+
+int ZoneRules::validOffsets(const LocalDateTime& ldt, ZoneOffset out[2]) const
+{
+    auto r = resolve(ldt);
+    switch(r.kind())
+    {
+    case ZoneResolution::Kind::Gap: return 0;
+    case ZoneResolution::Kind::Overlap: // The earlier instant (greater offset) first.
+        out[0] = r.transition().offsetBefore();
+        out[1] = r.transition().offsetAfter();
+        return 2;
+    default: break;
+    }
+    out[0] = r.offset();
+    return 1;
+}
+
+time_t ZoneRules::toEpochSecond(const LocalDateTime& ldt) const
+{
+    GOBLIB_DATETIME_PROBE(ZoneRulesToEpoch);
+    return resolve(ldt).epochSecond();
+}
+
+ZoneResolution ZoneRules::resolve(const LocalDateTime& ldt, const ResolvePolicy policy) const
+{
+    const int64_t local = ldt.toEpochSecond(ZoneOffset::UTC);
+    if(!_hasDST || _std == _dst) { return ZoneResolution(ZoneResolution::Kind::Normal, true, local - _std.totalSeconds(), _std); }
+
+    // Transitions in order, including the neighboring year only near the new year.
+    ZoneOffsetTransition trs[4];
+    size_t n{};
+    const int16_t doy = ldt.toLocalDate().dayOfYear();
+    if(doy < NEIGHBOR_DAYS)
+    {
+        ZoneOffsetTransition tmp[2];
+        transitionsInYear(static_cast<int16_t>(ldt.year() - 1), tmp);
+        trs[n++] = tmp[1];
+    }
+    n += transitionsInYear(ldt.year(), trs + n);
+    if(doy >= ldt.toLocalDate().lengthOfYear() - NEIGHBOR_DAYS)
+    {
+        ZoneOffsetTransition tmp[2];
+        transitionsInYear(static_cast<int16_t>(ldt.year() + 1), tmp);
+        trs[n++] = tmp[0];
+    }
+
+    ZoneOffset zo = trs[0].offsetBefore();
+    for(size_t i = 0; i < n; ++i)
+    {
+        const auto& tr = trs[i];
+        if(local < localLo(tr)) { break; }
+        if(local < localHi(tr))
+        {
+            const ZoneOffset& before = tr.offsetBefore();
+            const ZoneOffset& after = tr.offsetAfter();
+            if(tr.isGap())
+            {
+                switch(policy)
+                {
+                case ResolvePolicy::Reject:       return ZoneResolution(ZoneResolution::Kind::Gap, false, 0, ZoneOffset(), tr);
+                case ResolvePolicy::Earlier:      return ZoneResolution(ZoneResolution::Kind::Gap, true, local - after.totalSeconds(), before, tr);
+                case ResolvePolicy::ShiftForward: return ZoneResolution(ZoneResolution::Kind::Gap, true, tr.epochSecond(), after, tr);
+                default:                          return ZoneResolution(ZoneResolution::Kind::Gap, true, local - before.totalSeconds(), after, tr);
+                }
+            }
+            switch(policy)
+            {
+            case ResolvePolicy::Reject: return ZoneResolution(ZoneResolution::Kind::Overlap, false, 0, ZoneOffset(), tr);
+            case ResolvePolicy::Later:  return ZoneResolution(ZoneResolution::Kind::Overlap, true, local - after.totalSeconds(), after, tr);
+            default:                    return ZoneResolution(ZoneResolution::Kind::Overlap, true, local - before.totalSeconds(), before, tr);
+            }
+        }
+        zo = tr.offsetAfter();
+    }
+    return ZoneResolution(ZoneResolution::Kind::Normal, true, local - zo.totalSeconds(), zo);
+}
+
+time_t ZoneRules::daylightStart(const int16_t year) const
+{
+    return (time_t)_start.epochDay(year) * SEC_PER_DAY + _start.time - _std.totalSeconds();
+}
+
+time_t ZoneRules::daylightEnd(const int16_t year) const
+{
+    return (time_t)_end.epochDay(year) * SEC_PER_DAY + _end.time - _dst.totalSeconds();
+}
+
+size_t ZoneRules::transitionsInYear(const int16_t year, ZoneOffsetTransition out[2]) const
+{
+    if(!_hasDST || _std == _dst) { return 0; }
+    ZoneOffsetTransition s(daylightStart(year), _std, _dst);
+    ZoneOffsetTransition e(daylightEnd(year), _dst, _std);
+    const bool startFirst = s.epochSecond() < e.epochSecond();
+    out[0] = startFirst ? s : e;
+    out[1] = startFirst ? e : s;
+    return 2;
+}
+
+// Transitions of a year may be in the neighboring year by the local time of the rule, so check the three years.
+ZoneOffsetTransition ZoneRules::nextTransition(const time_t epoch) const
+{
+    ZoneOffsetTransition found{}, tr[2];
+    const int16_t year = LocalDate::ofEpochDay(floorDiv((int64_t)epoch + _std.totalSeconds(), SEC_PER_DAY)).year();
+    for(int32_t y = year + 1; y >= year - 1; --y)
+    {
+        if(!transitionsInYear(static_cast<int16_t>(y), tr)) { break; }
+        for(int i = 1; i >= 0; --i)
+        {
+            if(tr[i].epochSecond() > epoch && (!found.valid() || tr[i].epochSecond() < found.epochSecond())) { found = tr[i]; }
+        }
+    }
+    return found;
+}
+
+ZoneOffsetTransition ZoneRules::previousTransition(const time_t epoch) const
+{
+    ZoneOffsetTransition found{}, tr[2];
+    const int16_t year = LocalDate::ofEpochDay(floorDiv((int64_t)epoch + _std.totalSeconds(), SEC_PER_DAY)).year();
+    for(int32_t y = year - 1; y <= year + 1; ++y)
+    {
+        if(!transitionsInYear(static_cast<int16_t>(y), tr)) { break; }
+        for(int i = 0; i < 2; ++i)
+        {
+            if(tr[i].epochSecond() < epoch && (!found.valid() || tr[i].epochSecond() > found.epochSecond())) { found = tr[i]; }
+        }
+    }
+    return found;
+}
+
+ZoneRules ZoneRules::parse(const char* posix)
+{
+    ZoneRules invalid(ZoneOffset(ZoneOffset::MAX.totalSeconds() + 1));
+    if(!posix || !posix[0]) { return invalid; }
+
+    ZoneRules zr;
+    int32_t sec{};
+    const char* p = posix;
+
+    // std offset (POSIX offset is positive to the west of Greenwich)
+    if(!(p = parseName(p)) || !(p = parseTime(p, sec))) { return invalid; }
+    zr._std = zr._dst = ZoneOffset(-sec);
+    if(!*p) { return zr.valid() ? zr : invalid; }
+
+    // dst [offset]
+    if(!(p = parseName(p))) { return invalid; }
+    zr._hasDST = true;
+    zr._dst = ZoneOffset(zr._std.totalSeconds() + SEC_PER_HOUR);
+    if(*p && *p != ',')
+    {
+        if(!(p = parseTime(p, sec))) { return invalid; }
+        zr._dst = ZoneOffset(-sec);
+    }
+
+    // ,start[/time],end[/time]
+    if(!*p)
+    {
+        // Default rule (US)
+        zr._start.month = 3; zr._start.week = 2;
+        zr._end.month = 11;  zr._end.week = 1;
+        return zr;
+    }
+    if(*p++ != ',' || !(p = parseRule(p, zr._start))) { return invalid; }
+    if(*p++ != ',' || !(p = parseRule(p, zr._end)))   { return invalid; }
+    return (*p == '\0' && zr.valid()) ? zr : invalid;
+}
+
+ZoneRules ZoneRules::ofLocation(const char* location)
+{
+    return parse(locationToPOSIX(location));
+}
+//
+}}
@@ -0,0 +1,226 @@
+/*!
+  @file gob_zone_rules.hpp
+  @brief The rules defining how the zone offset varies, made from POSIX TZ string.
+*/
+#ifndef GOBLIB_ZONE_RULES_HPP
+#define GOBLIB_ZONE_RULES_HPP
+
+#include "gob_datetime.hpp"
+
+namespace goblib { namespace datetime {
+
+/*!
+  @class ZoneOffsetTransition
+  @brief A transition between two offsets caused by a discontinuity in the local time-line.
+ */
+class ZoneOffsetTransition
+{
+  public:
+    ///@name Constructors
+    ///@{
+    constexpr ZoneOffsetTransition() {} // invalid
+    constexpr ZoneOffsetTransition(const time_t epoch, const ZoneOffset& before, const ZoneOffset& after) : _epoch(epoch), _before(before), _after(after) {}
+    ///@}
+
+    ///@name Properties
+    ///@{
+    constexpr time_t     epochSecond()  const { return _epoch;  } //!< @brief Gets the epoch of the transition.
+    constexpr ZoneOffset offsetBefore() const { return _before; } //!< @brief Gets the offset before the transition.
+    constexpr ZoneOffset offsetAfter()  const { return _after;  } //!< @brief Gets the offset after the transition.
+    constexpr int32_t durationSeconds() const { return _after.totalSeconds() - _before.totalSeconds(); } //!< @brief Gets the length of the gap (positive) or the overlap (negative) in seconds.
+    constexpr bool isGap()     const { return durationSeconds() > 0; } //!< @brief Does the transition skip local date-times? (e.g. spring forward)
+    constexpr bool isOverlap() const { return durationSeconds() < 0; } //!< @brief Does the transition repeat local date-times? (e.g. fall back)
+    ///@}
+
+    /*! @brief Is valid instance? */
+    constexpr bool valid() const { return _before.valid() && _after.valid() && durationSeconds() != 0; }
+    /*! @brief Gets the local date-time of the transition by the offset before. (e.g. 02:00 of spring forward) */
+    LocalDateTime dateTimeBefore() const { return LocalDateTime::ofEpochSecond(_epoch, _before); }
+    /*! @brief Gets the local date-time of the transition by the offset after. (e.g. 03:00 of spring forward) */
+    LocalDateTime dateTimeAfter() const { return LocalDateTime::ofEpochSecond(_epoch, _after); }
+
+    friend inline bool operator==(const ZoneOffsetTransition& a, const ZoneOffsetTransition& b) { return a._epoch == b._epoch && a._before == b._before && a._after == b._after; }
+    friend inline bool operator!=(const ZoneOffsetTransition& a, const ZoneOffsetTransition& b) { return !(a == b); }
+
+  private:
+    time_t _epoch{};
+    ZoneOffset _before{}, _after{};
+};
+
+/*!
+  @enum ResolvePolicy
+  @brief How to resolve a local date-time in a gap or an overlap to an instant.
+ */
+enum class ResolvePolicy : uint8_t
+{
+    Compatible,   //!< Gap : Later, Overlap : Earlier (Same as ZoneRules::toEpochSecond and Java ZonedDateTime.ofLocal)
+    Earlier,      //!< The earlier instant. In a gap, interpreted by the offset after the transition. (e.g. 02:30 to 01:30 of the offset before)
+    Later,        //!< The later instant. In a gap, interpreted by the offset before the transition. (e.g. 02:30 to 03:30 of the offset after)
+    Reject,       //!< Fails in a gap or an overlap.
+    ShiftForward, //!< In a gap, the instant of the transition. (e.g. 02:30 to 03:00 of the offset after) In an overlap, same as Earlier.
+};
+
+/*!
+  @class ZoneResolution
+  @brief The result of resolving a local date-time to an instant.
+ */
+class ZoneResolution
+{
+  public:
+    enum class Kind : uint8_t
+    {
+        Normal,  //!< The local date-time has one offset.
+        Gap,     //!< The local date-time is skipped by the transition.
+        Overlap, //!< The local date-time is repeated by the transition.
+    };
+
+    ///@name Constructors
+    ///@{
+    constexpr ZoneResolution() {} // invalid
+    constexpr ZoneResolution(const Kind kind, const bool valid, const time_t epoch, const ZoneOffset& zo, const ZoneOffsetTransition& tr = ZoneOffsetTransition())
+            : _epoch(epoch), _offset(zo), _transition(tr), _kind(kind), _valid(valid) {}
+    ///@}
+
+    ///@name Properties
+    ///@{
+    constexpr Kind kind()        const { return _kind; } //!< @brief Gets the kind of the local date-time.
+    constexpr bool isGap()       const { return _kind == Kind::Gap; } //!< @brief Was the local date-time in a gap?
+    constexpr bool isOverlap()   const { return _kind == Kind::Overlap; } //!< @brief Was the local date-time in an overlap?
+    constexpr time_t epochSecond() const { return _epoch; } //!< @brief Gets the resolved epoch.
+    constexpr ZoneOffset offset()  const { return _offset; } //!< @brief Gets the offset at the resolved epoch.
+    constexpr ZoneOffsetTransition transition() const { return _transition; } //!< @brief Gets the transition of the gap or the overlap. (Invalid if Normal)
+    ///@}
+
+    /*! @brief Is resolved? (false if rejected) */
+    constexpr bool valid() const { return _valid; }
+    /*! @brief Gets the resolved date-time with the offset. (The local date-time may differ from the requested in a gap) */
+    OffsetDateTime toOffsetDateTime() const { return OffsetDateTime(LocalDateTime::ofEpochSecond(_epoch, _offset), _offset); }
+
+  private:
+    time_t _epoch{};
+    ZoneOffset _offset{};
+    ZoneOffsetTransition _transition{};
+    Kind _kind{Kind::Normal};
+    bool _valid{};
+};
+
+/*!
+  @class ZoneRules
+  @brief The rules defining how the zone offset varies for a single time-zone.
+  @note Made from POSIX TZ string such as "PST8PDT,M3.2.0,M11.1.0". Computed by integer arithmetic without libc functions and the TZ environment.
+  @note One rule is applied to all years. (Restriction of POSIX TZ string)
+  @sa https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/V1_chap08.html
+*/
+class ZoneRules
+{
+  public:
+    /*!
+      @struct Rule
+      @brief Date and time of the transition. (start or end of the daylight saving time)
+     */
+    struct Rule
+    {
+        enum class Type : uint8_t
+        {
+            Julian1, //!< Jn : 1-365 (February 29 is never counted)
+            Julian0, //!< n  : 0-365 (February 29 is counted)
+            MonthWeekDay //!< Mm.w.d : The d'th day (0 <= d <= 6) of week w of month m
+        };
+        Type type{Type::MonthWeekDay};
+        int8_t month{};  //!< @brief Month [1-12] (MonthWeekDay)
+        int8_t week{};   //!< @brief Week [1-5] (5 means the last) (MonthWeekDay)
+        int8_t dayOfWeek{}; //!< @brief Day of week [0-6] (Sunday is 0) (MonthWeekDay)
+        int16_t day{};   //!< @brief Day (Julian1, Julian0)
+        int32_t time{7200}; //!< @brief Local time of the transition in seconds. May be negative or greater than 24 hours.
+
+        /*! @brief Gets the epoch day of the transition date in the year. */
+        int32_t epochDay(const int16_t year) const;
+    };
+
+    ///@name Constructors
+    ///@{
+    constexpr ZoneRules() {} // UTC
+    constexpr explicit ZoneRules(const ZoneOffset& zo) : _std(zo), _dst(zo) {}
+    ///@}
+
+    ///@name Properties
+    ///@{
+    constexpr ZoneOffset standardOffset() const { return _std; } //!< @brief Gets the standard offset.
+    constexpr ZoneOffset daylightOffset() const { return _dst; } //!< @brief Gets the offset in the daylight saving time.
+    constexpr bool isFixedOffset() const { return !_hasDST; } //!< @brief Checks of the zone rules are fixed, such that the offset never varies.
+    constexpr Rule startRule() const { return _start; } //!< @brief Gets the rule of the start of the daylight saving time.
+    constexpr Rule endRule()   const { return _end;   } //!< @brief Gets the rule of the end of the daylight saving time.
+    ///@}
+
+    /*! @brief Is valid instance? */
+    constexpr bool valid() const { return _std.valid() && _dst.valid(); }
+    /*! @brief Gets the offset applicable at the specified epoch. */
+    ZoneOffset offset(const time_t epoch) const;
+    /*! @brief Checks if the specified epoch is in daylight savings. */
+    bool isDaylightSavings(const time_t epoch) const;
+    /*!
+      @brief Gets the valid offsets for the specified local date-time.
+      @param ldt Local date-time
+      @param[out] out Valid offsets, the earlier instant first.
+      @retval 0 The local date-time is in a gap. (skipped by the transition)
+      @retval 1 Normal
+      @retval 2 The local date-time is in an overlap. (repeated by the transition)
+     */
+    int validOffsets(const LocalDateTime& ldt, ZoneOffset out[2]) const;
+    /*!
+      @brief Converts local date-time to the epoch.
+      @note A local date-time in a gap is shifted later by the length of the gap, and in an overlap the earlier offset is used. (Same as Java ZonedDateTime.ofLocal)
+     */
+    time_t toEpochSecond(const LocalDateTime& ldt) const;
+    /*!
+      @brief Resolves local date-time to the instant by the policy, and tells if it was in a gap or an overlap.
+      @note Computed in a single pass by the transitions around the local date-time.
+     */
+    ZoneResolution resolve(const LocalDateTime& ldt, const ResolvePolicy policy = ResolvePolicy::Compatible) const;
+    /*! @brief Gets the epoch of the start of the daylight saving time in the year. */
+    time_t daylightStart(const int16_t year) const;
+    /*! @brief Gets the epoch of the end of the daylight saving time in the year. */
+    time_t daylightEnd(const int16_t year) const;
+
+    ///@name Transitions
+    ///@{
+    /*!
+      @brief Gets the first transition after the epoch.
+      @return Invalid instance if the offset never varies.
+     */
+    ZoneOffsetTransition nextTransition(const time_t epoch) const;
+    /*!
+      @brief Gets the last transition before the epoch.
+      @return Invalid instance if the offset never varies.
+     */
+    ZoneOffsetTransition previousTransition(const time_t epoch) const;
+    /*!
+      @brief Gets the transitions by the rules of the year.
+      @param year Year
+      @param[out] out Transitions in order of the epoch.
+      @return Number of the transitions. (0 or 2)
+     */
+    size_t transitionsInYear(const int16_t year, ZoneOffsetTransition out[2]) const;
+    ///@}
+
+    /*!
+      @brief Obtains an instance of ZoneRules from POSIX TZ string.
+      @return Invalid instance if failed to parse.
+     */
+    static ZoneRules parse(const char* posix);
+    /*!
+      @brief Obtains an instance of ZoneRules from location such as "America/Los_Angeles".
+      @return Invalid instance if failed to find location.
+      @sa locationToPOSIX
+     */
+    static ZoneRules ofLocation(const char* location);
+
+  private:
+    ZoneOffset _std{}, _dst{};
+    Rule _start{}, _end{};
+    bool _hasDST{};
+};
+
+//
+}}
+#endif
@@ -0,0 +1,39 @@
+/* Helper for benchmark */
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <chrono>
+#include <cstdio>
+
+// Returns the elapsed time of f() in microseconds. (Minimum of the trials)
+template<typename F> double benchmark(F f, const int trials = 5)
+{
+    double best = 0.0;
+    for(int i = 0; i < trials; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto end = std::chrono::steady_clock::now();
+        double us = std::chrono::duration<double, std::micro>(end - start).count();
+        if(i == 0 || us < best) { best = us; }
+    }
+    return best;
+}
+
+// Print the result and the ratio to the baseline.
+inline void printBenchmark(const char* name, const double us, const double baseline)
+{
+    printf("%-40s %12.1f us  x%.2f\n", name, us, baseline / us);
+}
+
+// Prevent the result from being optimized away.
+template<typename T> inline void doNotOptimize(const T& v)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&v) : "memory");
+#else
+    static volatile const void* p; p = &v;
+#endif
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <gob_binary.hpp>
+#include <vector>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+TEST(Bench, Binary)
+{
+    std::vector<OffsetDateTime> v;
+    for(int i = 0; i < 10000; ++i)
+    {
+        auto zo = ZoneOffset::of(i % 27 - 12);
+        v.push_back(OffsetDateTime(LocalDateTime::ofEpochSecond(1600000000 + i * 8641, zo), zo));
+    }
+    std::vector<string_t> strs(v.size());
+    std::vector<OffsetDateTime> d(v.size());
+    std::vector<uint8_t> buf(v.size() * BinaryCodec<OffsetDateTime>::SIZE);
+
+    auto str = benchmark([&]()
+    {
+        for(size_t i = 0; i < v.size(); ++i) { strs[i] = v[i].toString(); }
+        for(size_t i = 0; i < v.size(); ++i) { d[i] = OffsetDateTime::parse(strs[i].c_str()); }
+        doNotOptimize(d);
+    });
+    auto one = benchmark([&]()
+    {
+        for(size_t i = 0; i < v.size(); ++i) { BinaryCodec<OffsetDateTime>::encode(v[i], buf.data() + i * BinaryCodec<OffsetDateTime>::SIZE); }
+        for(size_t i = 0; i < v.size(); ++i) { d[i] = BinaryCodec<OffsetDateTime>::decode(buf.data() + i * BinaryCodec<OffsetDateTime>::SIZE); }
+        doNotOptimize(d);
+    });
+    auto bulk = benchmark([&]()
+    {
+        encodeArray(v.data(), v.size(), buf.data());
+        decodeArray(buf.data(), d.size(), d.data());
+        doNotOptimize(d);
+    });
+    EXPECT_EQ(v[123].toString(), d[123].toString());
+    printBenchmark("10k ODT: toString/parse", str, str);
+    printBenchmark("10k ODT: BinaryCodec encode/decode", one, str);
+    printBenchmark("10k ODT: encodeArray/decodeArray", bulk, str);
+}
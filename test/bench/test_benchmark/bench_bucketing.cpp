@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include <gob_bucketing.hpp>
+#include <vector>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+namespace
+{
+void benchUnit(const char* name, const ChronoUnit unit)
+{
+    const ZoneOffset zo = ZoneOffset::of(9);
+    std::vector<time_t> epochs;
+    for(time_t t = 1500000000; epochs.size() < 100000; t += 97) { epochs.push_back(t); }
+    std::vector<time_t> out0(epochs.size()), out1(epochs.size());
+
+    // Naive: ofEpochSecond, truncate fields and toEpochSecond
+    auto naive = benchmark([&]()
+    {
+        for(size_t i = 0; i < epochs.size(); ++i)
+        {
+            out0[i] = LocalDateTime::ofEpochSecond(epochs[i], zo).truncatedTo(unit).toEpochSecond(zo);
+        }
+        doNotOptimize(out0);
+    });
+    auto bulk = benchmark([&]()
+    {
+        truncateEpochSeconds(out1.data(), epochs.data(), epochs.size(), unit, zo);
+        doNotOptimize(out1);
+    });
+    EXPECT_EQ(out0, out1);
+
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s: naive (LocalDateTime)", name);
+    printBenchmark(buf, naive, naive);
+    snprintf(buf, sizeof(buf), "%s: truncateEpochSeconds", name);
+    printBenchmark(buf, bulk, naive);
+}
+//
+}
+
+TEST(Bench, Bucketing)
+{
+    benchUnit("Minutes", ChronoUnit::Minutes);
+    benchUnit("Days", ChronoUnit::Days);
+    benchUnit("Weeks", ChronoUnit::Weeks);
+    benchUnit("Months", ChronoUnit::Months);
+}
@@ -0,0 +1,150 @@
+// Differential benchmark against C++20 std::chrono. (native_bench_20)
+#include <gtest/gtest.h>
+#include <gob_datetime.hpp>
+#include <gob_zone_context.hpp>
+#include "chrono_calendar.hpp"
+#include "bench.hpp"
+
+#if defined(CHRONO_CALENDAR)
+using namespace goblib::datetime;
+namespace chr = std::chrono;
+
+TEST(Bench, ChronoEpochDay)
+{
+    constexpr int32_t N = 100000;
+    int64_t sum0{}, sum1{}, sum2{}, sum3{};
+
+    auto toYmdChrono = benchmark([&]()
+    {
+        sum0 = 0;
+        for(int32_t ed = 0; ed < N; ++ed)
+        {
+            chr::year_month_day ymd{chr::sys_days{chr::days{ed}}};
+            sum0 += static_cast<int>(ymd.year()) + static_cast<unsigned>(ymd.month()) + static_cast<unsigned>(ymd.day());
+        }
+        doNotOptimize(sum0);
+    });
+    auto toYmd = benchmark([&]()
+    {
+        sum1 = 0;
+        for(int32_t ed = 0; ed < N; ++ed)
+        {
+            auto ld = LocalDate::ofEpochDay(ed);
+            sum1 += ld.year() + ld.month() + ld.day();
+        }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+
+    std::vector<LocalDate> dates(N);
+    std::vector<chr::year_month_day> ymds(N);
+    for(int32_t ed = 0; ed < N; ++ed)
+    {
+        dates[ed] = LocalDate::ofEpochDay(ed);
+        ymds[ed] = chr::year_month_day{chr::sys_days{chr::days{ed}}};
+    }
+    auto fromYmdChrono = benchmark([&]()
+    {
+        sum2 = 0;
+        for(auto& e : ymds) { sum2 += chr::sys_days{e}.time_since_epoch().count(); }
+        doNotOptimize(sum2);
+    });
+    auto fromYmd = benchmark([&]()
+    {
+        sum3 = 0;
+        for(auto& e : dates) { sum3 += e.toEpochDay(); }
+        doNotOptimize(sum3);
+    });
+    EXPECT_EQ(sum2, sum3);
+
+    auto dowChrono = benchmark([&]()
+    {
+        sum0 = 0;
+        for(auto& e : ymds) { sum0 += chr::weekday{e}.c_encoding(); }
+        doNotOptimize(sum0);
+    });
+    auto dow = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& e : dates) { sum1 += static_cast<unsigned>(e.dayOfWeek()); }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+
+    printBenchmark("100k epoch day to date: chrono", toYmdChrono, toYmdChrono);
+    printBenchmark("100k epoch day to date: LocalDate", toYmd, toYmdChrono);
+    printBenchmark("100k date to epoch day: chrono", fromYmdChrono, fromYmdChrono);
+    printBenchmark("100k date to epoch day: LocalDate", fromYmd, fromYmdChrono);
+    printBenchmark("100k day of week: chrono", dowChrono, dowChrono);
+    printBenchmark("100k day of week: LocalDate", dow, dowChrono);
+}
+
+TEST(Bench, ChronoFormat)
+{
+    constexpr int N = 10000;
+    const int64_t base = 1671000000;
+    size_t len0{}, len1{};
+    int mismatch{};
+
+    auto chrono = benchmark([&]()
+    {
+        len0 = 0;
+        for(int i = 0; i < N; ++i) { len0 += chronoToString(chr::sys_seconds{chr::seconds{base + i * 7919}}).size(); }
+        doNotOptimize(len0);
+    });
+    auto gob = benchmark([&]()
+    {
+        len1 = 0;
+        for(int i = 0; i < N; ++i) { len1 += LocalDateTime::ofEpochSecond(base + i * 7919, ZoneOffset::UTC).toString().length(); }
+        doNotOptimize(len1);
+    });
+    for(int i = 0; i < N; ++i)
+    {
+        if(chronoToString(chr::sys_seconds{chr::seconds{base + i * 7919}}) != LocalDateTime::ofEpochSecond(base + i * 7919, ZoneOffset::UTC).toString().c_str()) { ++mismatch; }
+    }
+    EXPECT_EQ(len0, len1);
+    EXPECT_EQ(0, mismatch);
+# if defined(CHRONO_FORMAT)
+    printBenchmark("10k format: std::format", chrono, chrono);
+# else
+    printBenchmark("10k format: chrono + snprintf", chrono, chrono);
+# endif
+    printBenchmark("10k format: LocalDateTime::toString", gob, chrono);
+}
+
+# if defined(CHRONO_TZDB)
+TEST(Bench, ChronoZone)
+{
+    constexpr int N = 10000;
+    const int64_t base = 1704067200; // 2024-01-01
+    int64_t sum0{}, sum1{};
+    const chr::time_zone* tz{};
+    try { tz = chr::locate_zone("America/Los_Angeles"); } catch(...) { GTEST_SKIP() << "No time-zone database"; }
+    auto ctx = ZoneContext::ofLocation("America/Los_Angeles");
+
+    auto chrono = benchmark([&]()
+    {
+        sum0 = 0;
+        for(int i = 0; i < N; ++i)
+        {
+            chr::zoned_time<chr::seconds> zt{tz, chr::sys_seconds{chr::seconds{base + i * 3607}}};
+            sum0 += zt.get_local_time().time_since_epoch().count();
+        }
+        doNotOptimize(sum0);
+    });
+    auto gob = benchmark([&]()
+    {
+        sum1 = 0;
+        for(int i = 0; i < N; ++i)
+        {
+            const time_t t = base + i * 3607;
+            sum1 += ctx.toLocalDateTime(t).toEpochSecond(ZoneOffset::UTC);
+        }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+    printBenchmark("10k zone conversion: zoned_time", chrono, chrono);
+    printBenchmark("10k zone conversion: ZoneContext", gob, chrono);
+}
+# endif
+#endif
@@ -0,0 +1,42 @@
+// Cost of suspending and resuming waiters of TimerScheduler. (native_bench_20)
+#include <gtest/gtest.h>
+#include <gob_coroutine.hpp>
+#include "bench.hpp"
+
+#if defined(GOBLIB_DATETIME_HAS_COROUTINE)
+#include <random>
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(Bench, CoroutineWaiters)
+{
+    double base{};
+    for(int n : { 1000, 10000, 100000 })
+    {
+        std::mt19937 rng(52);
+        std::uniform_int_distribution<int> dist(1, 86400);
+        std::vector<time_t> epochs(n);
+        for(auto& e : epochs) { e = 86400 + dist(rng); }
+
+        size_t resumed{};
+        auto us = benchmark([&]()
+        {
+            time_t clock = 86400;
+            TimerScheduler sched([&]() { return clock; });
+            auto task = [&](const time_t epoch) -> DetachedTask { co_await sched.sleepUntil(epoch); };
+            for(auto& e : epochs) { task(e); }
+            resumed = 0;
+            for(int i = 0; i < 86400; i += 60) { clock += 60; resumed += sched.poll(); }
+            doNotOptimize(resumed);
+        });
+        EXPECT_EQ(static_cast<size_t>(n), resumed);
+
+        char name[64];
+        snprintf(name, sizeof(name), "TimerScheduler %d waiters (ns/waiter)", n);
+        const double per = us * 1000.0 / n;
+        if(!base) { base = per; }
+        printf("%-40s %12.1f ns  x%.2f\n", name, per, base / per);
+    }
+}
+#endif
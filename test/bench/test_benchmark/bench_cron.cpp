@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <gob_cron.hpp>
+#include <vector>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+TEST(Bench, CronNext)
+{
+    const char* exprs[] =
+    {
+        "* * * * *", "*/15 9-17 * * MON-FRI", "0 12 1,15 * ?", "30 2 * * *", "0 0 1 */3 *",
+        "5 4 * * SUN", "0 22 * * 1-5", "@hourly", "@daily", "0 0 13 * FRI",
+    };
+    std::vector<CronExpression> crons;
+    for(int i = 0; i < 1000; ++i) { crons.push_back(CronExpression::parse(exprs[i % 10])); }
+    const LocalDateTime after(2022, 12, 13, 12, 34, 56);
+    int64_t sum0{}, sum1{};
+
+    // Naive: step by minute until matched (the first 10 expressions)
+    auto naive = benchmark([&]()
+    {
+        sum0 = 0;
+        for(int i = 0; i < 10; ++i)
+        {
+            auto t = after.toEpochSecond(ZoneOffset::UTC);
+            t = t - (t % 60) + 60;
+            while(!crons[i].matches(LocalDateTime::ofEpochSecond(t, ZoneOffset::UTC))) { t += 60; }
+            sum0 += t;
+        }
+        doNotOptimize(sum0);
+    });
+    auto cron = benchmark([&]()
+    {
+        sum1 = 0;
+        for(int i = 0; i < 10; ++i) { sum1 += crons[i].next(after).toEpochSecond(ZoneOffset::UTC); }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+    printBenchmark("Cron 10 exprs: naive (minute step)", naive, naive);
+    printBenchmark("Cron 10 exprs: CronExpression::next", cron, naive);
+
+    // Throughput of many expressions
+    auto bulk = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& c : crons) { sum1 += c.next(after).minute(); }
+        doNotOptimize(sum1);
+    });
+    printf("Cron next() for %zu exprs: %.1f us (%.0f exprs/ms)\n", crons.size(), bulk, crons.size() * 1000.0 / bulk);
+}
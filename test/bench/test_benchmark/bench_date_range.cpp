@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <gob_date_range.hpp>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+TEST(Bench, DateRange)
+{
+    const LocalDate start(1980, 1, 1), end(2080, 1, 1);
+    int64_t sum0{}, sum1{};
+
+    // Naive loop (recomputing from epoch per step)
+    auto naive = benchmark([&]()
+    {
+        sum0 = 0;
+        for(int32_t ed = start.toEpochDay(); ed < end.toEpochDay(); ++ed)
+        {
+            auto ld = LocalDateTime::ofEpochSecond((time_t)ed * 86400, ZoneOffset::UTC).toLocalDate();
+            sum0 += ld.day();
+        }
+        doNotOptimize(sum0);
+    });
+    auto range = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& ld : DateRange(start, end)) { sum1 += ld.day(); }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+    printBenchmark("Days: naive (ofEpochSecond)", naive, naive);
+    printBenchmark("Days: DateRange", range, naive);
+}
+
+TEST(Bench, DateTimeRange)
+{
+    const LocalDateTime start(2000, 1, 1, 0, 0, 0), end(2020, 1, 1, 0, 0, 0);
+    int64_t sum0{}, sum1{};
+
+    auto naive = benchmark([&]()
+    {
+        sum0 = 0;
+        for(time_t t = start.toEpochSecond(ZoneOffset::UTC); t < end.toEpochSecond(ZoneOffset::UTC); t += 3600)
+        {
+            auto ldt = LocalDateTime::ofEpochSecond(t, ZoneOffset::UTC);
+            sum0 += ldt.day() + ldt.hour();
+        }
+        doNotOptimize(sum0);
+    });
+    auto range = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& ldt : DateTimeRange(start, end, 1, ChronoUnit::Hours)) { sum1 += ldt.day() + ldt.hour(); }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+    printBenchmark("Hours: naive (ofEpochSecond)", naive, naive);
+    printBenchmark("Hours: DateTimeRange", range, naive);
+}
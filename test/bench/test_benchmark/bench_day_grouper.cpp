@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <gob_day_grouper.hpp>
+#include "bench.hpp"
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(Bench, LocalDayGrouper)
+{
+    constexpr int32_t N = 200000;
+    auto ny = ZoneRules::ofLocation("America/New_York");
+    std::vector<time_t> epochs(N);
+    const time_t base = OffsetDateTime::parse("2023-01-01T00:00:00Z").toEpochSecond();
+    for(int32_t i = 0; i < N; ++i) { epochs[i] = base + i * 157LL; } // About 550 events a day
+    size_t groups0{}, groups1{}, groups2{};
+
+    auto naive = benchmark([&]()
+    {
+        groups0 = 0;
+        LocalDate prev(0, 0, 0);
+        for(auto& t : epochs)
+        {
+            auto ld = LocalDateTime::ofEpochSecond(t, ny.offset(t)).toLocalDate();
+            if(ld != prev) { ++groups0; prev = ld; }
+        }
+        doNotOptimize(groups0);
+    });
+    auto grouper = benchmark([&]()
+    {
+        LocalDayGrouper g(ny);
+        groups1 = 0;
+        for(auto& t : epochs) { groups1 += g.push(t); }
+        doNotOptimize(groups1);
+    });
+    std::vector<size_t> starts(N);
+    auto bulk = benchmark([&]()
+    {
+        groups2 = localDayBoundaries(starts.data(), nullptr, epochs.data(), N, ny);
+        doNotOptimize(groups2);
+    });
+    EXPECT_EQ(groups0, groups1);
+    EXPECT_EQ(groups0, groups2);
+
+    printBenchmark("ofEpochSecond + toLocalDate", naive, naive);
+    printBenchmark("LocalDayGrouper::push", grouper, naive);
+    printBenchmark("localDayBoundaries", bulk, naive);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <gob_epoch_date.hpp>
+#include "bench.hpp"
+#include <vector>
+
+using namespace goblib::datetime;
+
+namespace
+{
+constexpr int32_t N = 100000;
+}
+
+// Arithmetic, comparison and day of week.
+TEST(Bench, EpochDateArithmetic)
+{
+    std::vector<LocalDate> lds(N);
+    std::vector<EpochDate> eds(N);
+    for(int32_t i = 0; i < N; ++i)
+    {
+        lds[i] = LocalDate::ofEpochDay(i * 3);
+        eds[i] = EpochDate(lds[i]);
+    }
+    const LocalDate lpivot(2100, 6, 15);
+    const EpochDate epivot(lpivot);
+    int64_t sum0{}, sum1{};
+
+    auto localDate = benchmark([&]()
+    {
+        sum0 = 0;
+        for(auto& e : lds)
+        {
+            auto next = LocalDate::ofEpochDay(e.toEpochDay() + 7);
+            sum0 += (next < lpivot) + (lpivot.toEpochDay() - next.toEpochDay()) + static_cast<int>(next.dayOfWeek());
+        }
+        doNotOptimize(sum0);
+    });
+    auto epochDate = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& e : eds)
+        {
+            auto next = e + 7;
+            sum1 += (next < epivot) + (epivot - next) + static_cast<int>(next.dayOfWeek());
+        }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+
+    printBenchmark("LocalDate arithmetic", localDate, localDate);
+    printBenchmark("EpochDate arithmetic", epochDate, localDate);
+}
+
+// Year, month and day access.
+TEST(Bench, EpochDateFields)
+{
+    std::vector<LocalDate> lds(N);
+    std::vector<EpochDate> eds(N);
+    for(int32_t i = 0; i < N; ++i)
+    {
+        lds[i] = LocalDate::ofEpochDay(i * 3);
+        eds[i] = EpochDate(lds[i]);
+    }
+    int64_t sum0{}, sum1{}, sum2{};
+
+    auto localDate = benchmark([&]()
+    {
+        sum0 = 0;
+        for(auto& e : lds) { sum0 += e.year() + e.month() + e.day(); }
+        doNotOptimize(sum0);
+    });
+    auto epochDateEach = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& e : eds) { sum1 += e.year() + e.month() + e.day(); }
+        doNotOptimize(sum1);
+    });
+    auto epochDateOnce = benchmark([&]()
+    {
+        sum2 = 0;
+        for(auto& e : eds)
+        {
+            auto ld = e.toLocalDate();
+            sum2 += ld.year() + ld.month() + ld.day();
+        }
+        doNotOptimize(sum2);
+    });
+    EXPECT_EQ(sum0, sum1);
+    EXPECT_EQ(sum0, sum2);
+
+    printBenchmark("LocalDate fields", localDate, localDate);
+    printBenchmark("EpochDate fields (each)", epochDateEach, localDate);
+    printBenchmark("EpochDate fields (toLocalDate)", epochDateOnce, localDate);
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <gob_http_date.hpp>
+#include <cstring>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+TEST(Bench, HttpDate)
+{
+    constexpr int N = 10000;
+    const time_t base = 1671000000;
+    size_t len0{}, len1{}, len2{};
+
+    auto naive = benchmark([&]()
+    {
+        len0 = 0;
+        for(int i = 0; i < N; ++i)
+        {
+            auto ldt = LocalDateTime::ofEpochSecond(base + i / 10, ZoneOffset::UTC);
+            len0 += ldt.toString("%a, %d %b %Y %H:%M:%S GMT").length();
+        }
+        doNotOptimize(len0);
+    });
+    auto fmt = benchmark([&]()
+    {
+        len1 = 0;
+        char buf[HTTP_DATE_BUFFER_SIZE];
+        for(int i = 0; i < N; ++i) { len1 += formatHttpDate(buf, sizeof(buf), base + i / 10); }
+        doNotOptimize(len1);
+    });
+    // 10 responses per second
+    auto cached = benchmark([&]()
+    {
+        len2 = 0;
+        HttpDateCache cache;
+        for(int i = 0; i < N; ++i) { len2 += std::strlen(cache.get(base + i / 10)); }
+        doNotOptimize(len2);
+    });
+    EXPECT_EQ(len0, len1);
+    EXPECT_EQ(len0, len2);
+    printBenchmark("10k Date: toString(strftime)", naive, naive);
+    printBenchmark("10k Date: formatHttpDate", fmt, naive);
+    printBenchmark("10k Date: HttpDateCache", cached, naive);
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <gob_iso_week.hpp>
+#include "bench.hpp"
+#include <ctime>
+#include <cstdlib>
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(Bench, IsoWeek)
+{
+    constexpr int32_t N = 100000;
+    std::vector<LocalDate> dates(N);
+    std::vector<time_t> epochs(N);
+    for(int32_t i = 0; i < N; ++i)
+    {
+        dates[i] = LocalDate::ofEpochDay(i);
+        epochs[i] = i * 86400LL + 43200;
+    }
+    int64_t sum0{}, sum1{}, sum2{};
+
+    auto strf = benchmark([&]()
+    {
+        char buf[8];
+        sum0 = 0;
+        for(auto& ld : dates)
+        {
+            struct tm tm{};
+            tm.tm_year = ld.year() - 1900;
+            tm.tm_mon = ld.month() - 1;
+            tm.tm_mday = ld.day();
+            tm.tm_wday = static_cast<int>(ld.dayOfWeek());
+            tm.tm_yday = ld.dayOfYear();
+            strftime(buf, sizeof(buf), "%V", &tm);
+            sum0 += atoi(buf);
+        }
+        doNotOptimize(sum0);
+    });
+    auto member = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& ld : dates) { sum1 += ld.isoWeek(); }
+        doNotOptimize(sum1);
+    });
+    std::vector<int32_t> keys(N);
+    auto bulk = benchmark([&]()
+    {
+        isoWeekKeys(keys.data(), epochs.data(), N);
+        sum2 = 0;
+        for(auto& k : keys) { sum2 += k % 100; }
+        doNotOptimize(sum2);
+    });
+    EXPECT_EQ(sum0, sum1);
+    EXPECT_EQ(sum0, sum2);
+
+    printBenchmark("strftime %V", strf, strf);
+    printBenchmark("LocalDate::isoWeek", member, strf);
+    printBenchmark("isoWeekKeys (sorted epochs)", bulk, strf);
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <gob_parallel.hpp>
+#include <gob_rfc3339.hpp>
+#include "bench.hpp"
+#include <vector>
+#include <thread>
+
+using namespace goblib::datetime;
+
+// Scaling of the rezoning by the number of threads. (Compare with the scalar loop)
+TEST(Bench, ParallelRezone)
+{
+    constexpr size_t N = 1000000;
+    std::vector<OffsetDateTime> src(N), dst(N);
+    for(size_t i = 0; i < N; ++i) { src[i] = OffsetDateTime(LocalDateTime::ofEpochSecond(86400 + i * 977, ZoneOffset::of(9)), ZoneOffset::of(9)); }
+    const auto zo = ZoneOffset::of(-5);
+
+    auto scalar = benchmark([&]()
+    {
+        for(size_t i = 0; i < N; ++i) { dst[i] = src[i].withOffsetSameEpoch(zo); }
+        doNotOptimize(dst);
+    });
+    printBenchmark("withOffsetSameEpoch (scalar)", scalar, scalar);
+
+    const size_t hc = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+    for(size_t threads = 1; threads <= hc * 2 && threads <= 32; threads *= 2)
+    {
+        ThreadPool pool(threads);
+        auto par = benchmark([&]()
+        {
+            parallelWithOffsetSameEpoch(dst.data(), src.data(), N, zo, pool);
+            doNotOptimize(dst);
+        });
+        char name[64];
+        snprintf(name, sizeof(name), "parallelWithOffsetSameEpoch (%zu)", threads);
+        printBenchmark(name, par, scalar);
+    }
+}
+
+TEST(Bench, ParallelFormatParse)
+{
+    constexpr size_t N = 200000;
+    std::vector<OffsetDateTime> src(N), parsed(N);
+    for(size_t i = 0; i < N; ++i) { src[i] = OffsetDateTime(LocalDateTime::ofEpochSecond(86400 + i * 977, ZoneOffset::of(9)), ZoneOffset::of(9)); }
+    std::vector<char> buf(N * RFC3339_BUFFER_SIZE);
+    std::vector<const char*> strs(N);
+    for(size_t i = 0; i < N; ++i) { strs[i] = buf.data() + i * RFC3339_BUFFER_SIZE; }
+
+    ThreadPool single(1), pool;
+    auto fmt1 = benchmark([&]() { parallelFormatRFC3339(buf.data(), RFC3339_BUFFER_SIZE, src.data(), N, single); });
+    auto fmtN = benchmark([&]() { parallelFormatRFC3339(buf.data(), RFC3339_BUFFER_SIZE, src.data(), N, pool); });
+    auto parse1 = benchmark([&]() { parallelParseRFC3339(parsed.data(), strs.data(), N, single); doNotOptimize(parsed); });
+    auto parseN = benchmark([&]() { parallelParseRFC3339(parsed.data(), strs.data(), N, pool); doNotOptimize(parsed); });
+    EXPECT_EQ(src, parsed);
+
+    char name[64];
+    printBenchmark("parallelFormatRFC3339 (1)", fmt1, fmt1);
+    snprintf(name, sizeof(name), "parallelFormatRFC3339 (%zu)", pool.size());
+    printBenchmark(name, fmtN, fmt1);
+    printBenchmark("parallelParseRFC3339 (1)", parse1, parse1);
+    snprintf(name, sizeof(name), "parallelParseRFC3339 (%zu)", pool.size());
+    printBenchmark(name, parseN, parse1);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <gob_rfc3339.hpp>
+#include <cstring>
+#include <vector>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+TEST(Bench, RFC3339)
+{
+    std::vector<OffsetDateTime> v;
+    for(int i = 0; i < 10000; ++i)
+    {
+        auto zo = (i % 2) ? ZoneOffset::UTC : ZoneOffset::of(9);
+        v.push_back(OffsetDateTime(LocalDateTime::ofEpochSecond(1600000000 + i * 8641, zo), zo));
+    }
+    size_t len0{}, len1{};
+
+    // Build from toString output and insert milliseconds.
+    auto naive = benchmark([&]()
+    {
+        len0 = 0;
+        for(size_t i = 0; i < v.size(); ++i)
+        {
+            char frac[8];
+            snprintf(frac, sizeof(frac), ".%03u", (unsigned)(i % 1000));
+            auto s = v[i].toLocalDateTime().toString();
+            s += frac;
+            s += v[i].offset().toString();
+            len0 += s.length();
+        }
+        doNotOptimize(len0);
+    });
+    auto fast = benchmark([&]()
+    {
+        len1 = 0;
+        char buf[RFC3339_BUFFER_SIZE];
+        for(size_t i = 0; i < v.size(); ++i) { len1 += formatRFC3339(buf, sizeof(buf), v[i], (i % 1000) * 1000000U, 3); }
+        doNotOptimize(len1);
+    });
+    EXPECT_EQ(len0, len1);
+    printBenchmark("10k RFC3339 format: toString + frac", naive, naive);
+    printBenchmark("10k RFC3339 format: formatRFC3339", fast, naive);
+
+    std::vector<string_t> strs;
+    char buf[RFC3339_BUFFER_SIZE];
+    for(size_t i = 0; i < v.size(); ++i) { formatRFC3339(buf, sizeof(buf), v[i], (i % 1000) * 1000000U, 3); strs.push_back(buf); }
+    int64_t sum0{}, sum1{};
+    // OffsetDateTime::parse does not accept fractions, so remove it before parsing.
+    auto naiveParse = benchmark([&]()
+    {
+        sum0 = 0;
+        for(auto& s : strs)
+        {
+            string_t t = s;
+            auto dot = t.find('.');
+            t.erase(dot, 4);
+            sum0 += OffsetDateTime::parse(t.c_str()).toEpochSecond() + std::atoi(s.c_str() + dot + 1);
+        }
+        doNotOptimize(sum0);
+    });
+    auto fastParse = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& s : strs)
+        {
+            uint32_t ns{};
+            sum1 += parseRFC3339(s.c_str(), &ns).toEpochSecond() + ns / 1000000;
+        }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+    printBenchmark("10k RFC3339 parse: strip frac + parse", naiveParse, naiveParse);
+    printBenchmark("10k RFC3339 parse: parseRFC3339", fastParse, naiveParse);
+}
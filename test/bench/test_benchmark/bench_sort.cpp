@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <gob_sort.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+namespace
+{
+template<typename T> void benchSort(const char* name, const std::vector<T>& src)
+{
+    std::vector<T> v0, v1, v2;
+    auto stdsort = benchmark([&]()
+    {
+        v0 = src;
+        std::sort(v0.begin(), v0.end());
+        doNotOptimize(v0);
+    });
+    auto stdstable = benchmark([&]()
+    {
+        v0 = src;
+        std::stable_sort(v0.begin(), v0.end());
+        doNotOptimize(v0);
+    });
+    auto radix = benchmark([&]()
+    {
+        v1 = src;
+        sort(v1.data(), v1.data() + v1.size());
+        doNotOptimize(v1);
+    });
+    auto stable = benchmark([&]()
+    {
+        v2 = src;
+        stableSort(v2.data(), v2.data() + v2.size());
+        doNotOptimize(v2);
+    });
+    EXPECT_TRUE(std::is_sorted(v1.begin(), v1.end()));
+    EXPECT_TRUE(std::is_sorted(v2.begin(), v2.end()));
+
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s: std::sort", name);        printBenchmark(buf, stdsort, stdsort);
+    snprintf(buf, sizeof(buf), "%s: std::stable_sort", name); printBenchmark(buf, stdstable, stdsort);
+    snprintf(buf, sizeof(buf), "%s: sort", name);             printBenchmark(buf, radix, stdsort);
+    snprintf(buf, sizeof(buf), "%s: stableSort", name);       printBenchmark(buf, stable, stdsort);
+}
+//
+}
+
+TEST(Bench, Sort)
+{
+    constexpr size_t N = 100000;
+    std::mt19937 rng(52);
+    std::uniform_int_distribution<int64_t> epoch(0, 4102444800LL);
+    std::uniform_int_distribution<int> hour(-12, 14);
+
+    std::vector<LocalDate> ld;
+    std::vector<LocalDateTime> ldt;
+    std::vector<OffsetDateTime> odt;
+    for(size_t i = 0; i < N; ++i)
+    {
+        auto e = epoch(rng);
+        auto zo = ZoneOffset::of(hour(rng));
+        ld.push_back(LocalDate::ofEpochDay(e / 86400));
+        ldt.push_back(LocalDateTime::ofEpochSecond(e, ZoneOffset::UTC));
+        odt.push_back(OffsetDateTime(LocalDateTime::ofEpochSecond(e, zo), zo));
+    }
+    benchSort("LocalDate 100k", ld);
+    benchSort("LocalDateTime 100k", ldt);
+    benchSort("OffsetDateTime 100k", odt);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <gob_timer_wheel.hpp>
+#include "bench.hpp"
+#include <queue>
+#include <vector>
+#include <random>
+#include <functional>
+
+using namespace goblib::datetime;
+
+namespace
+{
+// Binary heap with lazy cancellation, as std::priority_queue does not support removal.
+struct HeapTimers
+{
+    struct Entry
+    {
+        time_t epoch;
+        uint32_t id;
+        bool operator>(const Entry& o) const { return epoch != o.epoch ? epoch > o.epoch : id > o.id; }
+    };
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    std::vector<bool> canceled;
+
+    void schedule(const OffsetDateTime& odt, const uint32_t id)
+    {
+        heap.push({ odt.toEpochSecond(), id });
+        if(canceled.size() <= id) { canceled.resize(id + 1); }
+        canceled[id] = false;
+    }
+    void cancel(const uint32_t id) { canceled[id] = true; }
+    template<typename F> void advance(const time_t to, F f)
+    {
+        while(!heap.empty() && heap.top().epoch <= to)
+        {
+            auto e = heap.top();
+            heap.pop();
+            if(!canceled[e.id]) { f(e.id, e.epoch); }
+        }
+    }
+};
+}
+
+TEST(Bench, TimerWheel)
+{
+    constexpr uint32_t N = 300000;
+    const time_t start = 1672531200; // 2023-01-01T00:00:00Z
+    std::mt19937 rng(52);
+    std::uniform_int_distribution<int> dist(1, 86400);
+    std::vector<OffsetDateTime> deadlines(N);
+    for(auto& d : deadlines) { d = OffsetDateTime(LocalDateTime::ofEpochSecond(start + dist(rng), ZoneOffset::of(9)), ZoneOffset::of(9)); }
+
+    uint64_t sum0{}, sum1{};
+    // Schedule all, cancel a quarter, and advance every second through the day.
+    auto heap = benchmark([&]()
+    {
+        HeapTimers timers;
+        for(uint32_t i = 0; i < N; ++i) { timers.schedule(deadlines[i], i); }
+        for(uint32_t i = 0; i < N; i += 4) { timers.cancel(i); }
+        sum0 = 0;
+        for(time_t t = start; t <= start + 86400; ++t) { timers.advance(t, [&](const uint32_t id, const time_t due) { sum0 += id ^ static_cast<uint64_t>(due); }); }
+        doNotOptimize(sum0);
+    }, 3);
+    auto wheel = benchmark([&]()
+    {
+        TimerWheel<uint32_t> timers(start);
+        std::vector<TimerWheel<uint32_t>::Handle> handles(N);
+        for(uint32_t i = 0; i < N; ++i) { handles[i] = timers.schedule(deadlines[i], i); }
+        for(uint32_t i = 0; i < N; i += 4) { timers.cancel(handles[i]); }
+        sum1 = 0;
+        for(time_t t = start; t <= start + 86400; ++t) { timers.advance(t, [&](uint32_t& id, const time_t due) { sum1 += id ^ static_cast<uint64_t>(due); }); }
+        doNotOptimize(sum1);
+    }, 3);
+    EXPECT_EQ(sum0, sum1);
+
+    printBenchmark("priority_queue schedule/cancel/advance", heap, heap);
+    printBenchmark("TimerWheel schedule/cancel/advance", wheel, heap);
+
+    // Schedule only
+    auto heapSchedule = benchmark([&]()
+    {
+        HeapTimers timers;
+        for(uint32_t i = 0; i < N; ++i) { timers.schedule(deadlines[i], i); }
+        doNotOptimize(timers);
+    }, 3);
+    auto wheelSchedule = benchmark([&]()
+    {
+        TimerWheel<uint32_t> timers(start);
+        for(uint32_t i = 0; i < N; ++i) { timers.schedule(deadlines[i], i); }
+        doNotOptimize(timers);
+    }, 3);
+    printBenchmark("priority_queue schedule", heapSchedule, heapSchedule);
+    printBenchmark("TimerWheel schedule", wheelSchedule, heapSchedule);
+}
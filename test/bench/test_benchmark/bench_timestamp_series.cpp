@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include <gob_timestamp_series.hpp>
+#include <random>
+#include <vector>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+TEST(Bench, TimestampSeries)
+{
+    constexpr size_t N = 1000000;
+    std::mt19937 rng(52);
+    std::uniform_int_distribution<int> jitter(0, 99);
+
+    std::vector<time_t> regular(N), jittered(N);
+    for(size_t i = 0; i < N; ++i)
+    {
+        regular[i] = 1600000000 + (time_t)i * 10;
+        jittered[i] = 1600000000 + (time_t)i * 10 + (jitter(rng) < 5 ? 1 : 0); // Occasional 1 second jitter
+    }
+    struct { const char* name; std::vector<time_t>* v; } tbl[] = { { "regular", &regular }, { "jittered", &jittered } };
+
+    for(auto& e : tbl)
+    {
+        TimestampSeries ts;
+        auto enc = benchmark([&]()
+        {
+            ts.clear();
+            for(auto& t : *e.v) { ts.append(t, ZoneOffset::of(9)); }
+        }, 3);
+        std::vector<time_t> out(N);
+        auto dec = benchmark([&]()
+        {
+            ts.decode(out.data(), 0, N);
+            doNotOptimize(out);
+        });
+        EXPECT_EQ(*e.v, out);
+        printf("%-9s: %.3f bits/sample, encode %.1f us, decode %.1f us (%.2f GB/s as 8-byte epochs)\n",
+               e.name, ts.serializedSize() * 8.0 / N, enc, dec, N * sizeof(time_t) / dec / 1000.0);
+    }
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <gob_world_clock.hpp>
+#include <gob_rfc3339.hpp>
+#include "bench.hpp"
+#include <ctime>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(Bench, WorldClock)
+{
+    const char* locations[] =
+    {
+        "Asia/Tokyo", "America/Los_Angeles", "America/New_York", "America/Chicago", "America/Denver",
+        "America/Sao_Paulo", "America/St_Johns", "Europe/London", "Europe/Paris", "Europe/Berlin",
+        "Europe/Moscow", "Africa/Cairo", "Asia/Dubai", "Asia/Kolkata", "Asia/Kathmandu",
+        "Asia/Shanghai", "Asia/Singapore", "Australia/Sydney", "Pacific/Auckland", "Pacific/Honolulu",
+    };
+    constexpr size_t Z = sizeof(locations) / sizeof(locations[0]);
+    constexpr int32_t N = 500; // Refreshes, every second
+    std::vector<ZoneRules> zones;
+    std::vector<std::string> posix;
+    for(auto& loc : locations)
+    {
+        zones.push_back(ZoneRules::ofLocation(loc));
+        posix.push_back(locationToPOSIX(loc));
+    }
+    const time_t base = OffsetDateTime::parse("2023-03-26T00:59:00Z").toEpochSecond();
+    int64_t sum0{}, sum1{}, sum2{}, sum3{};
+
+    const char* org = getenv("TZ");
+    std::string saved = org ? org : "";
+    auto libc = benchmark([&]()
+    {
+        sum0 = 0;
+        for(int32_t j = 0; j < N; ++j)
+        {
+            const time_t t = base + j;
+            for(auto& p : posix)
+            {
+                setenv("TZ", p.c_str(), 1);
+                tzset();
+                struct tm tm;
+                localtime_r(&t, &tm);
+                sum0 += tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec + tm.tm_gmtoff;
+            }
+        }
+        doNotOptimize(sum0);
+    }, 3);
+    if(org) { setenv("TZ", saved.c_str(), 1); } else { unsetenv("TZ"); }
+    tzset();
+
+    auto perZone = benchmark([&]()
+    {
+        sum1 = 0;
+        for(int32_t j = 0; j < N; ++j)
+        {
+            const time_t t = base + j;
+            for(auto& zr : zones)
+            {
+                const auto zo = zr.offset(t);
+                const OffsetDateTime odt(LocalDateTime::ofEpochSecond(t, zo), zo);
+                sum1 += odt.hour() * 3600 + odt.minute() * 60 + odt.second() + odt.offset().totalSeconds();
+            }
+        }
+        doNotOptimize(sum1);
+    });
+    WorldClock wc(zones);
+    OffsetDateTime odts[Z];
+    auto fanOut = benchmark([&]()
+    {
+        sum2 = 0;
+        for(int32_t j = 0; j < N; ++j)
+        {
+            wc.convert(odts, base + j);
+            for(auto& odt : odts) { sum2 += odt.hour() * 3600 + odt.minute() * 60 + odt.second() + odt.offset().totalSeconds(); }
+        }
+        doNotOptimize(sum2);
+    });
+    EXPECT_EQ(sum0, sum1);
+    EXPECT_EQ(sum0, sum2);
+
+    char strs[Z][RFC3339_BUFFER_SIZE];
+    auto fmtPerZone = benchmark([&]()
+    {
+        sum3 = 0;
+        for(int32_t j = 0; j < N; ++j)
+        {
+            const time_t t = base + j;
+            for(size_t i = 0; i < Z; ++i)
+            {
+                const auto zo = zones[i].offset(t);
+                sum3 += formatRFC3339(strs[i], RFC3339_BUFFER_SIZE, OffsetDateTime(LocalDateTime::ofEpochSecond(t, zo), zo));
+            }
+        }
+        doNotOptimize(sum3);
+    });
+    auto fmtFanOut = benchmark([&]()
+    {
+        sum3 = 0;
+        for(int32_t j = 0; j < N; ++j)
+        {
+            sum3 += wc.format(strs[0], RFC3339_BUFFER_SIZE, base + j);
+        }
+        doNotOptimize(sum3);
+    });
+
+    printBenchmark("setenv/tzset/localtime_r", libc, libc);
+    printBenchmark("ZoneRules for each zone", perZone, libc);
+    printBenchmark("WorldClock::convert", fanOut, libc);
+    printBenchmark("format for each zone", fmtPerZone, fmtPerZone);
+    printBenchmark("WorldClock::format", fmtFanOut, fmtPerZone);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <gob_datetime.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include "bench.hpp"
+
+using namespace goblib::datetime;
+
+namespace
+{
+// Same as the previous implementation.
+string_t toStringBySnprintf(const ZoneOffset& zo)
+{
+    const int32_t sec = zo.totalSeconds();
+    if(sec == 0) { return string_t("Z"); }
+    char buf[64];
+    if(sec % 60) { snprintf(buf, sizeof(buf), "%c%02d:%02d:%02d", sec < 0 ? '-' : '+', std::abs(zo.hour()), std::abs(zo.minute()), std::abs(zo.second())); }
+    else         { snprintf(buf, sizeof(buf), "%c%02d:%02d", sec < 0 ? '-' : '+', std::abs(zo.hour()), std::abs(zo.minute())); }
+    return string_t(buf);
+}
+
+ZoneOffset ofBySscanf(const char* s)
+{
+    if(s[0] == 'Z' && !s[1]) { return ZoneOffset::UTC; }
+    char sch = 0;
+    int hh{}, mm{}, ss{};
+    if(sscanf(s, "%c%02d:%02d:%02d", &sch, &hh, &mm, &ss) != 4)
+    {
+        hh = mm = ss = 0;
+        if(sscanf(s, "%c%02d:%02d", &sch, &hh, &mm) != 3) { return ZoneOffset(0xBADBEAF); }
+    }
+    int sign = (sch == '-') ? -1 : 1;
+    return ZoneOffset::of(sign * hh, sign * mm, sign * ss);
+}
+}
+
+TEST(Bench, ZoneOffset)
+{
+    constexpr int N = 145 * 100;
+    size_t len0{}, len1{}, len2{};
+    int64_t sum0{}, sum1{};
+
+    auto oldFormat = benchmark([&]()
+    {
+        len0 = 0;
+        for(int i = 0; i < N; ++i) { len0 += toStringBySnprintf(ZoneOffset((i % 145 - 72) * 900)).length(); }
+        doNotOptimize(len0);
+    });
+    auto newFormat = benchmark([&]()
+    {
+        len1 = 0;
+        for(int i = 0; i < N; ++i) { len1 += ZoneOffset((i % 145 - 72) * 900).toString().length(); }
+        doNotOptimize(len1);
+    });
+    auto toChars = benchmark([&]()
+    {
+        len2 = 0;
+        char buf[16];
+        for(int i = 0; i < N; ++i) { len2 += ZoneOffset((i % 145 - 72) * 900).toChars(buf, sizeof(buf)); }
+        doNotOptimize(len2);
+    });
+    EXPECT_EQ(len0, len1);
+    EXPECT_EQ(len0, len2);
+
+    string_t strs[145];
+    for(int i = 0; i < 145; ++i) { strs[i] = ZoneOffset((i - 72) * 900).toString(); }
+    auto oldParse = benchmark([&]()
+    {
+        sum0 = 0;
+        for(int i = 0; i < N; ++i) { sum0 += ofBySscanf(strs[i % 145].c_str()).totalSeconds(); }
+        doNotOptimize(sum0);
+    });
+    auto newParse = benchmark([&]()
+    {
+        sum1 = 0;
+        for(int i = 0; i < N; ++i) { sum1 += ZoneOffset::of(strs[i % 145].c_str()).totalSeconds(); }
+        doNotOptimize(sum1);
+    });
+    EXPECT_EQ(sum0, sum1);
+
+    printBenchmark("14.5k ZoneOffset: toString(snprintf)", oldFormat, oldFormat);
+    printBenchmark("14.5k ZoneOffset: toString(table)", newFormat, oldFormat);
+    printBenchmark("14.5k ZoneOffset: toChars", toChars, oldFormat);
+    printBenchmark("14.5k ZoneOffset: of(sscanf)", oldParse, oldParse);
+    printBenchmark("14.5k ZoneOffset: of(hand-rolled)", newParse, oldParse);
+}
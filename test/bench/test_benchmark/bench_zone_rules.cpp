@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <gob_zone_rules.hpp>
+#include "bench.hpp"
+#include <ctime>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(Bench, ZoneRulesResolve)
+{
+    constexpr int32_t N = 100000;
+    const char* posix = "EST5EDT,M3.2.0,M11.1.0";
+    auto ny = ZoneRules::parse(posix);
+    std::vector<LocalDateTime> ldts(N);
+    const time_t base = LocalDateTime(2023, 1, 1, 0, 0, 0).toEpochSecond(ZoneOffset::UTC);
+    for(int32_t i = 0; i < N; ++i) { ldts[i] = LocalDateTime::ofEpochSecond(base + i * 313LL, ZoneOffset::UTC); }
+    ZoneOffsetTransition tr[2];
+    ny.transitionsInYear(2023, tr);
+    const ZoneOffset greater = tr[0].offsetBefore() > tr[0].offsetAfter() ? tr[0].offsetBefore() : tr[0].offsetAfter();
+    const ZoneOffset lesser = tr[0].offsetBefore() > tr[0].offsetAfter() ? tr[0].offsetAfter() : tr[0].offsetBefore();
+    int64_t sum0{}, sum1{}, sum2{};
+
+    const char* org = getenv("TZ");
+    std::string saved = org ? org : "";
+    setenv("TZ", posix, 1);
+    tzset();
+    auto mk = benchmark([&]()
+    {
+        sum0 = 0;
+        for(auto& ldt : ldts)
+        {
+            auto tm = ldt.toTm();
+            tm.tm_isdst = -1;
+            sum0 += mktime(&tm);
+        }
+        doNotOptimize(sum0);
+    });
+    if(org) { setenv("TZ", saved.c_str(), 1); } else { unsetenv("TZ"); }
+    tzset();
+
+    // Probing both offsets (previous implementation of toEpochSecond)
+    auto probe = benchmark([&]()
+    {
+        sum1 = 0;
+        for(auto& ldt : ldts)
+        {
+            const time_t local = ldt.toEpochSecond(ZoneOffset::UTC);
+            sum1 += ny.offset(local - greater.totalSeconds()) == greater ? local - greater.totalSeconds()
+                    : ny.offset(local - lesser.totalSeconds()) == lesser ? local - lesser.totalSeconds()
+                    : local - lesser.totalSeconds();
+        }
+        doNotOptimize(sum1);
+    });
+    auto resolve = benchmark([&]()
+    {
+        sum2 = 0;
+        for(auto& ldt : ldts) { sum2 += ny.resolve(ldt).epochSecond(); }
+        doNotOptimize(sum2);
+    });
+    EXPECT_EQ(sum1, sum2);
+
+    printBenchmark("mktime (TZ)", mk, mk);
+    printBenchmark("probe offsets", probe, mk);
+    printBenchmark("ZoneRules::resolve", resolve, mk);
+}
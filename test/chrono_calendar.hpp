@@ -0,0 +1,48 @@
+/* Availability of C++20 std::chrono calendar and time-zone database for the conformance test and benchmark */
+#ifndef CHRONO_CALENDAR_HPP
+#define CHRONO_CALENDAR_HPP
+
+#include <chrono>
+#if __cplusplus >= 202002L
+#include <version>
+#endif
+
+// year_month_day, sys_days, weekday, hh_mm_ss (libstdc++ 11 or later has them before defining __cpp_lib_chrono 201907L)
+#if __cplusplus >= 202002L && ((defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L) || (defined(_GLIBCXX_RELEASE) && _GLIBCXX_RELEASE >= 11))
+# define CHRONO_CALENDAR 1
+#endif
+
+// locate_zone, zoned_time
+#if defined(CHRONO_CALENDAR) && defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L
+# define CHRONO_TZDB 1
+#endif
+
+// std::format for chrono types
+#if defined(CHRONO_CALENDAR) && defined(__cpp_lib_format)
+# include <format>
+# define CHRONO_FORMAT 1
+#endif
+
+#if defined(CHRONO_CALENDAR)
+#include <cstdio>
+#include <string>
+
+// "YYYY-MM-DDThh:mm:ss" by std::chrono
+inline std::string chronoToString(const std::chrono::sys_seconds& tp)
+{
+# if defined(CHRONO_FORMAT)
+    return std::format("{:%FT%T}", tp);
+# else
+    using namespace std::chrono;
+    const auto dp = floor<days>(tp);
+    const year_month_day ymd{dp};
+    const hh_mm_ss<seconds> hms{tp - dp};
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%04d-%02u-%02uT%02d:%02d:%02d", static_cast<int>(ymd.year()), static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()),
+             static_cast<int>(hms.hours().count()), static_cast<int>(hms.minutes().count()), static_cast<int>(hms.seconds().count()));
+    return std::string(buf);
+# endif
+}
+#endif
+
+#endif
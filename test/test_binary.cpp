@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <gob_binary.hpp>
+#include "helper.hpp"
+#include <algorithm>
+#include <vector>
+#include <cstring>
+
+using namespace goblib::datetime;
+
+TEST(Binary, Encode)
+{
+    // Byte order is fixed regardless of the platform.
+    uint8_t buf[12]{};
+    BinaryCodec<LocalDate>::encode(LocalDate(2022, 12, 13), buf);
+    EXPECT_EQ(0xE6, buf[0]);
+    EXPECT_EQ(0x07, buf[1]);
+    EXPECT_EQ(12, buf[2]);
+    EXPECT_EQ(13, buf[3]);
+
+    BinaryCodec<LocalTime>::encode(LocalTime(12, 34, 56), buf);
+    EXPECT_EQ(12, buf[0]);
+    EXPECT_EQ(34, buf[1]);
+    EXPECT_EQ(56, buf[2]);
+    EXPECT_EQ(0, buf[3]);
+
+    BinaryCodec<ZoneOffset>::encode(ZoneOffset::of(-9, -30), buf); // -34200 = 0xFFFF7A68
+    EXPECT_EQ(0x68, buf[0]);
+    EXPECT_EQ(0x7A, buf[1]);
+    EXPECT_EQ(0xFF, buf[2]);
+    EXPECT_EQ(0xFF, buf[3]);
+
+    const uint8_t expected[] = { 0xE6, 0x07, 12, 13, 12, 34, 56, 0, 0x90, 0x7E, 0x00, 0x00 }; // +09:00 = 32400
+    BinaryCodec<OffsetDateTime>::encode(OffsetDateTime::of(2022, 12, 13, 12, 34, 56, ZoneOffset::of(9)), buf);
+    EXPECT_TRUE(std::equal(buf, buf + 12, expected));
+    EXPECT_STREQ("2022-12-13T12:34:56+09:00", BinaryCodec<OffsetDateTime>::decode(expected).toString().c_str());
+
+    EXPECT_EQ(4U, BinaryCodec<LocalDate>::SIZE);
+    EXPECT_EQ(4U, BinaryCodec<LocalTime>::SIZE);
+    EXPECT_EQ(4U, BinaryCodec<ZoneOffset>::SIZE);
+    EXPECT_EQ(8U, BinaryCodec<LocalDateTime>::SIZE);
+    EXPECT_EQ(12U, BinaryCodec<OffsetDateTime>::SIZE);
+}
+
+TEST(Binary, RoundTrip)
+{
+    uint8_t buf[12]{};
+    const LocalDate lds[] = { LocalDate::MIN, LocalDate::MAX, LocalDate(2000, 2, 29) };
+    for(auto& e : lds) { BinaryCodec<LocalDate>::encode(e, buf); EXPECT_EQ(e, BinaryCodec<LocalDate>::decode(buf)); }
+    const ZoneOffset zos[] = { ZoneOffset::MIN, ZoneOffset::MAX, ZoneOffset::UTC };
+    for(auto& e : zos) { BinaryCodec<ZoneOffset>::encode(e, buf); EXPECT_EQ(e, BinaryCodec<ZoneOffset>::decode(buf)); }
+    BinaryCodec<LocalDateTime>::encode(LocalDateTime::MAX, buf);
+    EXPECT_EQ(LocalDateTime::MAX, BinaryCodec<LocalDateTime>::decode(buf));
+    BinaryCodec<LocalTime>::encode(LocalTime(23, 59, 60), buf);
+    EXPECT_EQ(60, BinaryCodec<LocalTime>::decode(buf).second());
+}
+
+TEST(Binary, Array)
+{
+    std::vector<OffsetDateTime> v;
+    for(int i = 0; i < 100; ++i)
+    {
+        auto zo = ZoneOffset::of(i % 27 - 12);
+        v.push_back(OffsetDateTime(LocalDateTime::ofEpochSecond(1600000000 + i * 86413, zo), zo));
+    }
+    const size_t sz = BinaryCodec<OffsetDateTime>::SIZE;
+    std::vector<uint8_t> buf(v.size() * sz);
+    encodeArray(v.data(), v.size(), buf.data());
+
+    // Same as encoding one by one
+    for(size_t i = 0; i < v.size(); ++i)
+    {
+        uint8_t one[12];
+        BinaryCodec<OffsetDateTime>::encode(v[i], one);
+        EXPECT_TRUE(std::equal(one, one + sz, buf.data() + i * sz)) << i;
+    }
+
+    std::vector<OffsetDateTime> d(v.size());
+    decodeArray(buf.data(), d.size(), d.data());
+    for(size_t i = 0; i < v.size(); ++i) { EXPECT_EQ(v[i].toString(), d[i].toString()); }
+
+    // View
+    BinaryView<OffsetDateTime> view(buf.data(), v.size());
+    EXPECT_EQ(v.size(), view.size());
+    EXPECT_FALSE(view.empty());
+    EXPECT_EQ(buf.data(), view.data());
+    EXPECT_EQ(v[42].toString(), view[42].toString());
+    EXPECT_EQ((std::ptrdiff_t)v.size(), view.end() - view.begin());
+    size_t i{};
+    for(auto odt : view) { EXPECT_EQ(v[i++].toString(), odt.toString()); }
+    EXPECT_EQ(v.size(), i);
+    EXPECT_EQ(v[99].toString(), (*(view.end() - 1)).toString());
+    EXPECT_TRUE(std::is_sorted(view.begin(), view.end()));
+    EXPECT_TRUE(BinaryView<LocalDate>().empty());
+}
+
+TEST(Binary, ReservedByte)
+{
+    // Nonzero reserved byte of LocalTime is ignored.
+    const LocalDateTime ldt(2023, 4, 5, 6, 7, 8);
+    const OffsetDateTime odt(ldt, ZoneOffset::of(9));
+    std::vector<uint8_t> lbuf(BinaryCodec<LocalDateTime>::SIZE * 2), obuf(BinaryCodec<OffsetDateTime>::SIZE * 2), tbuf(BinaryCodec<LocalTime>::SIZE * 2);
+    for(int i = 0; i < 2; ++i)
+    {
+        BinaryCodec<LocalDateTime>::encode(ldt, lbuf.data() + i * BinaryCodec<LocalDateTime>::SIZE);
+        BinaryCodec<OffsetDateTime>::encode(odt, obuf.data() + i * BinaryCodec<OffsetDateTime>::SIZE);
+        BinaryCodec<LocalTime>::encode(ldt.toLocalTime(), tbuf.data() + i * BinaryCodec<LocalTime>::SIZE);
+    }
+    lbuf[BinaryCodec<LocalDateTime>::SIZE + 7] = 0xA5;
+    obuf[BinaryCodec<OffsetDateTime>::SIZE + 7] = 0xA5;
+    tbuf[BinaryCodec<LocalTime>::SIZE + 3] = 0xA5;
+
+    LocalDateTime ld[2];
+    OffsetDateTime od[2];
+    LocalTime lt[2];
+    decodeArray(lbuf.data(), 2, ld);
+    decodeArray(obuf.data(), 2, od);
+    decodeArray(tbuf.data(), 2, lt);
+    for(int i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(ldt, ld[i]) << i;
+        EXPECT_EQ(odt, od[i]) << i;
+        EXPECT_EQ(ldt.toLocalTime(), lt[i]) << i;
+        // Same memory image, including the padding
+        EXPECT_EQ(0, std::memcmp(&ldt, &ld[i], sizeof(ldt))) << i;
+        EXPECT_EQ(0, std::memcmp(&odt, &od[i], sizeof(odt))) << i;
+    }
+    EXPECT_EQ(ldt, BinaryCodec<LocalDateTime>::decode(lbuf.data() + BinaryCodec<LocalDateTime>::SIZE));
+}
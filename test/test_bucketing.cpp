@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <gob_bucketing.hpp>
+#include "helper.hpp"
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(Bucketing, FixedUnitSeconds)
+{
+    EXPECT_EQ(1, fixedUnitSeconds(ChronoUnit::Seconds));
+    EXPECT_EQ(60, fixedUnitSeconds(ChronoUnit::Minutes));
+    EXPECT_EQ(3600, fixedUnitSeconds(ChronoUnit::Hours));
+    EXPECT_EQ(43200, fixedUnitSeconds(ChronoUnit::HalfDays));
+    EXPECT_EQ(86400, fixedUnitSeconds(ChronoUnit::Days));
+    EXPECT_EQ(604800, fixedUnitSeconds(ChronoUnit::Weeks));
+    EXPECT_EQ(0, fixedUnitSeconds(ChronoUnit::Months));
+    EXPECT_EQ(0, fixedUnitSeconds(ChronoUnit::Years));
+}
+
+TEST(Bucketing, Truncate)
+{
+    const ChronoUnit units[] =
+    {
+        ChronoUnit::Seconds, ChronoUnit::Minutes, ChronoUnit::Hours, ChronoUnit::HalfDays,
+        ChronoUnit::Days, ChronoUnit::Weeks, ChronoUnit::Months, ChronoUnit::Years
+    };
+    const ZoneOffset offsets[] = { ZoneOffset::UTC, ZoneOffset::of(9), ZoneOffset::of(-8), ZoneOffset::of(5, 30), ZoneOffset::of(-9, -30) };
+
+    // Compare with LocalDateTime::truncatedTo
+    std::vector<time_t> epochs;
+    for(time_t t = 86400 * 14; t < 86400LL * 365 * 60; t += 86400 * 3 + 3607 * 5 + 17) { epochs.push_back(t); }
+    std::vector<time_t> out(epochs.size());
+
+    for(auto& zo : offsets)
+    {
+        for(auto& u : units)
+        {
+            truncateEpochSeconds(out.data(), epochs.data(), epochs.size(), u, zo);
+            for(size_t i = 0; i < epochs.size(); ++i)
+            {
+                auto expected = LocalDateTime::ofEpochSecond(epochs[i], zo).truncatedTo(u).toEpochSecond(zo);
+                EXPECT_EQ(expected, out[i]) << epochs[i] << " unit:" << (int)u << " " << zo.toString().c_str();
+                EXPECT_EQ(expected, truncateEpochSecond(epochs[i], u, zo));
+            }
+        }
+    }
+
+    // In-place and unsorted
+    std::vector<time_t> v = { 1671100000, 1234567890, 1671100000 + 86400 * 40, 1000000000 };
+    truncateEpochSeconds(v.data(), v.data(), v.size(), ChronoUnit::Months);
+    EXPECT_EQ(LocalDateTime(2022, 12, 1, 0, 0, 0).toEpochSecond(ZoneOffset::UTC), v[0]);
+    EXPECT_EQ(LocalDateTime(2009,  2, 1, 0, 0, 0).toEpochSecond(ZoneOffset::UTC), v[1]);
+    EXPECT_EQ(LocalDateTime(2023,  1, 1, 0, 0, 0).toEpochSecond(ZoneOffset::UTC), v[2]);
+    EXPECT_EQ(LocalDateTime(2001,  9, 1, 0, 0, 0).toEpochSecond(ZoneOffset::UTC), v[3]);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <gob_business_calendar.hpp>
+#include "helper.hpp"
+
+using namespace goblib::datetime;
+
+namespace
+{
+// Day by day for comparison.
+LocalDate naivePlus(const BusinessCalendar& cal, const LocalDate& ld, int32_t days)
+{
+    int32_t ed = ld.toEpochDay();
+    const int32_t step = days < 0 ? -1 : 1;
+    while(days)
+    {
+        ed += step;
+        if(cal.isBusinessDay(LocalDate::ofEpochDay(ed))) { days -= step; }
+    }
+    return LocalDate::ofEpochDay(ed);
+}
+
+int32_t naiveBetween(const BusinessCalendar& cal, const LocalDate& from, const LocalDate& to)
+{
+    int32_t c{};
+    for(int32_t ed = from.toEpochDay(); ed < to.toEpochDay(); ++ed) { c += cal.isBusinessDay(LocalDate::ofEpochDay(ed)); }
+    return c;
+}
+//
+}
+
+TEST(BusinessCalendar, Basic)
+{
+    BusinessCalendar cal;
+    EXPECT_EQ(BusinessCalendar::SATURDAY_AND_SUNDAY, cal.weekends());
+    EXPECT_TRUE(cal.isWeekend(DayOfWeek::Sat));
+    EXPECT_TRUE(cal.isWeekend(DayOfWeek::Sun));
+    EXPECT_FALSE(cal.isWeekend(DayOfWeek::Mon));
+
+    EXPECT_TRUE(cal.isBusinessDay(LocalDate(2022, 12, 13)));  // Tue
+    EXPECT_FALSE(cal.isBusinessDay(LocalDate(2022, 12, 17))); // Sat
+    EXPECT_FALSE(cal.isBusinessDay(LocalDate(2022, 12, 18))); // Sun
+    EXPECT_FALSE(cal.isBusinessDay(LocalDate(2022, 2, 30)));  // invalid
+
+    EXPECT_EQ(260, cal.businessDaysInYear(2022));
+    EXPECT_EQ(262, cal.businessDaysInYear(2024)); // leap (starts on Monday)
+
+    // Holidays
+    EXPECT_TRUE(cal.addHoliday(LocalDate(2022, 12, 13)));
+    EXPECT_FALSE(cal.addHoliday(LocalDate(2022, 13, 1)));
+    EXPECT_TRUE(cal.isHoliday(LocalDate(2022, 12, 13)));
+    EXPECT_FALSE(cal.isBusinessDay(LocalDate(2022, 12, 13)));
+    EXPECT_FALSE(cal.isHoliday(LocalDate(2022, 12, 17))); // weekend
+    EXPECT_EQ(259, cal.businessDaysInYear(2022));
+    EXPECT_TRUE(cal.addHoliday(LocalDate(2022, 12, 17))); // Holiday on weekend
+    EXPECT_EQ(259, cal.businessDaysInYear(2022));
+
+    cal.removeHoliday(LocalDate(2022, 12, 13));
+    cal.removeHoliday(LocalDate(2022, 12, 17));
+    EXPECT_TRUE(cal.isBusinessDay(LocalDate(2022, 12, 13)));
+    EXPECT_FALSE(cal.isBusinessDay(LocalDate(2022, 12, 17)));
+    EXPECT_EQ(260, cal.businessDaysInYear(2022));
+
+    cal.addHoliday(LocalDate(2022, 12, 13));
+    cal.clearHolidays();
+    EXPECT_TRUE(cal.isBusinessDay(LocalDate(2022, 12, 13)));
+
+    // Other weekends (Friday and Saturday)
+    BusinessCalendar fs((1U << static_cast<uint8_t>(DayOfWeek::Fri)) | (1U << static_cast<uint8_t>(DayOfWeek::Sat)));
+    EXPECT_FALSE(fs.isBusinessDay(LocalDate(2022, 12, 16)));
+    EXPECT_TRUE(fs.isBusinessDay(LocalDate(2022, 12, 18)));
+}
+
+TEST(BusinessCalendar, PlusBusinessDays)
+{
+    BusinessCalendar cal;
+    cal.addHoliday(LocalDate(2023, 1, 2));
+    cal.addHoliday(LocalDate(2022, 12, 26));
+
+    EXPECT_EQ(LocalDate(2023, 1, 3), cal.plusBusinessDays(LocalDate(2022, 12, 30), 1));
+    EXPECT_EQ(LocalDate(2022, 12, 31), cal.plusBusinessDays(LocalDate(2022, 12, 31), 0));
+    EXPECT_EQ(LocalDate(2023, 1, 3), cal.plusBusinessDays(LocalDate(2022, 12, 31), 1));
+    EXPECT_EQ(LocalDate(2022, 12, 30), cal.plusBusinessDays(LocalDate(2023, 1, 3), -1));
+    EXPECT_EQ(LocalDate(2022, 12, 23), cal.plusBusinessDays(LocalDate(2022, 12, 27), -1));
+    EXPECT_FALSE(cal.plusBusinessDays(LocalDate(1970, 1, 2), -2).valid());
+    EXPECT_FALSE(cal.plusBusinessDays(LocalDate::MAX, 10).valid());
+
+    // Compare with day by day
+    for(int i = 0; i < 20; ++i) { cal.addHoliday(LocalDate::ofEpochDay(18000 + i * 97)); }
+    const int32_t tbl[] = { 1, 2, 5, 10, 100, 261, 262, 1000, 5000 };
+    for(int32_t ed = 17500; ed < 21500; ed += 123)
+    {
+        const LocalDate ld = LocalDate::ofEpochDay(ed);
+        for(auto& n : tbl)
+        {
+            EXPECT_EQ(naivePlus(cal, ld, n), cal.plusBusinessDays(ld, n)) << ld.toString().c_str() << " + " << n;
+            EXPECT_EQ(naivePlus(cal, ld, -n), cal.plusBusinessDays(ld, -n)) << ld.toString().c_str() << " - " << n;
+        }
+    }
+}
+
+TEST(BusinessCalendar, BusinessDaysBetween)
+{
+    BusinessCalendar cal;
+    EXPECT_EQ(22, cal.businessDaysBetween(LocalDate(2023, 1, 1), LocalDate(2023, 2, 1)));
+    cal.addHoliday(LocalDate(2023, 1, 2));
+    EXPECT_EQ(21, cal.businessDaysBetween(LocalDate(2023, 1, 1), LocalDate(2023, 2, 1)));
+    EXPECT_EQ(-21, cal.businessDaysBetween(LocalDate(2023, 2, 1), LocalDate(2023, 1, 1)));
+    EXPECT_EQ(0, cal.businessDaysBetween(LocalDate(2023, 1, 3), LocalDate(2023, 1, 3)));
+    EXPECT_EQ(1, cal.businessDaysBetween(LocalDate(2023, 1, 3), LocalDate(2023, 1, 4)));
+
+    // Compare with day by day
+    for(int i = 0; i < 20; ++i) { cal.addHoliday(LocalDate::ofEpochDay(18000 + i * 97)); }
+    for(int32_t a = 17000; a < 20000; a += 311)
+    {
+        for(int32_t b = a; b < a + 3000; b += 137)
+        {
+            const LocalDate la = LocalDate::ofEpochDay(a), lb = LocalDate::ofEpochDay(b);
+            EXPECT_EQ(naiveBetween(cal, la, lb), cal.businessDaysBetween(la, lb)) << la.toString().c_str() << " " << lb.toString().c_str();
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <gob_chrono.hpp>
+#include "helper.hpp"
+
+using namespace goblib::datetime;
+namespace chr = std::chrono;
+
+TEST(Chrono, TimePoint)
+{
+    {
+        OffsetDateTime odt(LocalDateTime(2022, 12, 13, 12, 34, 56), ZoneOffset::of(9));
+        auto tp = toTimePoint(odt);
+        EXPECT_EQ(odt.toEpochSecond(), tp.time_since_epoch().count());
+        chr::system_clock::time_point stp = tp;
+        EXPECT_EQ(odt.toEpochSecond(), chr::system_clock::to_time_t(stp));
+
+        EXPECT_EQ(odt, toOffsetDateTime(tp, ZoneOffset::of(9)));
+        EXPECT_EQ(odt.toLocalDateTime(), toOffsetDateTime(tp, ZoneOffset::of(9)).toLocalDateTime());
+        EXPECT_EQ(LocalDateTime(2022, 12, 13, 3, 34, 56), toLocalDateTime(tp));
+        EXPECT_EQ(ZoneOffset::UTC, toOffsetDateTime(tp).offset());
+    }
+    // Sub-second is floored
+    {
+        auto tp = sys_seconds_t(chr::seconds(86400)) + chr::milliseconds(999);
+        EXPECT_EQ(LocalDateTime(1970, 1, 2, 0, 0, 0), toLocalDateTime(tp));
+        auto tp2 = sys_seconds_t(chr::seconds(86400)) - chr::milliseconds(1);
+        EXPECT_EQ(LocalDateTime(1970, 1, 1, 23, 59, 59), toLocalDateTime(tp2));
+        auto tp3 = chr::time_point<chr::system_clock, chr::microseconds>(chr::microseconds(1671000000123456LL));
+        EXPECT_EQ(LocalDateTime(2022, 12, 14, 6, 40, 0), toLocalDateTime(tp3));
+    }
+    // Same as gmtime
+    for(int64_t t = 0; t < 4102444800LL; t += 86400LL * 7 + 4271)
+    {
+        auto zo = ZoneOffset::of(-5, -30);
+        auto tp = sys_seconds_t(chr::seconds(t));
+        time_t e = static_cast<time_t>(t);
+        struct tm tmp{};
+        toGmtime(&e, &tmp);
+        ASSERT_EQ(LocalDateTime(tmp), toLocalDateTime(tp)) << t;
+        ASSERT_EQ(LocalDateTime(tmp), LocalDateTime(1970, 1, 1, 0, 0, 0) + chr::seconds(t)) << t;
+        if(t >= 86400)
+        {
+            e = static_cast<time_t>(t + zo.totalSeconds());
+            toGmtime(&e, &tmp);
+            ASSERT_EQ(LocalDateTime(tmp), toLocalDateTime(tp, zo)) << t;
+        }
+    }
+}
+
+TEST(Chrono, Duration)
+{
+    constexpr LocalTime lt(12, 34, 56);
+    constexpr auto d = toDuration(lt);
+    static_assert(d.count() == 45296, "");
+    EXPECT_EQ(lt, toLocalTime(d));
+    EXPECT_EQ(LocalTime(0, 0, 1), toLocalTime(chr::hours(24) + chr::seconds(1)));
+    EXPECT_EQ(LocalTime(23, 59, 59), toLocalTime(chr::seconds(-1)));
+    EXPECT_EQ(LocalTime(1, 30, 0), toLocalTime(chr::minutes(90)));
+    EXPECT_EQ(LocalTime(0, 0, 0), toLocalTime(chr::milliseconds(999)));
+}
+
+TEST(Chrono, Arithmetic)
+{
+    // LocalDateTime
+    {
+        LocalDateTime ldt(2022, 12, 31, 23, 0, 0);
+        EXPECT_EQ(LocalDateTime(2023, 1, 1, 0, 30, 0), ldt + chr::minutes(90));
+        EXPECT_EQ(LocalDateTime(2022, 12, 31, 21, 30, 0), ldt - chr::minutes(90));
+        EXPECT_EQ(LocalDateTime(2023, 1, 1, 23, 0, 0), ldt + chr::hours(24));
+        EXPECT_EQ(LocalDateTime(2022, 12, 31, 23, 0, 1), ldt + chr::milliseconds(1500));
+        EXPECT_EQ(LocalDateTime(2022, 12, 31, 22, 59, 58), ldt - chr::milliseconds(1500));
+        EXPECT_EQ(LocalDateTime(2024, 2, 29, 23, 0, 0), LocalDateTime(2024, 2, 28, 23, 0, 0) + days_t(1));
+        EXPECT_EQ(chr::seconds(5400), (ldt + chr::minutes(90)) - ldt);
+        EXPECT_EQ(chr::seconds(-5400), ldt - (ldt + chr::minutes(90)));
+    }
+    // OffsetDateTime
+    {
+        OffsetDateTime odt(LocalDateTime(2022, 12, 31, 23, 0, 0), ZoneOffset::of(9));
+        auto odt2 = odt + chr::hours(2);
+        EXPECT_EQ(LocalDateTime(2023, 1, 1, 1, 0, 0), odt2.toLocalDateTime());
+        EXPECT_EQ(ZoneOffset::of(9), odt2.offset());
+        EXPECT_EQ(odt, odt2 - chr::hours(2));
+        EXPECT_EQ(chr::seconds(7200), odt2 - odt);
+        OffsetDateTime utc(LocalDateTime(2022, 12, 31, 14, 0, 0), ZoneOffset::UTC);
+        EXPECT_EQ(chr::seconds(0), utc - odt);
+    }
+    // LocalTime
+    {
+        LocalTime lt(23, 30, 0);
+        EXPECT_EQ(LocalTime(0, 30, 0), lt + chr::hours(1));
+        EXPECT_EQ(LocalTime(22, 30, 0), lt - chr::hours(1));
+        EXPECT_EQ(LocalTime(23, 30, 0), lt + chr::hours(48));
+    }
+    // LocalDate
+    {
+        LocalDate ld(2022, 12, 31);
+        EXPECT_EQ(LocalDate(2023, 1, 1), ld + days_t(1));
+        EXPECT_EQ(LocalDate(2022, 12, 1), ld - days_t(30));
+        using weeks = chr::duration<int, std::ratio<86400 * 7>>;
+        EXPECT_EQ(LocalDate(2023, 1, 14), ld + weeks(2));
+        EXPECT_EQ(days_t(365), LocalDate(2023, 12, 31) - ld);
+    }
+}
+
+#if defined(GOBLIB_DATETIME_HAS_CHRONO_CALENDAR)
+TEST(Chrono, Calendar)
+{
+    {
+        constexpr LocalDate ld(2022, 12, 13);
+        constexpr auto ymd = toYearMonthDay(ld);
+        static_assert(ymd == chr::year(2022) / chr::December / 13, "");
+        constexpr auto sd = toSysDays(ld);
+        static_assert(sd.time_since_epoch().count() == 19339, "");
+        static_assert(toLocalDate(sd) == ld, "");
+        static_assert(toLocalDate(ymd) == ld, "");
+        EXPECT_EQ(ld.toEpochDay(), sd.time_since_epoch().count());
+    }
+    {
+        constexpr LocalTime lt(12, 34, 56);
+        constexpr auto hms = toHhMmSs(lt);
+        static_assert(hms.hours().count() == 12 && hms.minutes().count() == 34 && hms.seconds().count() == 56, "");
+        static_assert(toLocalTime(hms) == lt, "");
+        EXPECT_EQ(LocalTime(1, 2, 3), toLocalTime(chr::hh_mm_ss<chr::milliseconds>(chr::milliseconds(3723999))));
+    }
+    {
+        constexpr OffsetDateTime odt(LocalDateTime(2022, 12, 13, 12, 34, 56), ZoneOffset(9 * 3600));
+        constexpr auto ss = toSysSeconds(odt);
+        static_assert(ss.time_since_epoch().count() == 1670902496, "");
+        EXPECT_EQ(odt.toEpochSecond(), ss.time_since_epoch().count());
+        EXPECT_EQ(toTimePoint(odt), ss);
+    }
+    for(int32_t ed = 0; ed < 200000; ed += 17)
+    {
+        auto ld = LocalDate::ofEpochDay(ed);
+        ASSERT_EQ(ed, toSysDays(ld).time_since_epoch().count());
+        ASSERT_EQ(ld, toLocalDate(chr::sys_days(chr::days(ed))));
+    }
+}
+#endif
@@ -0,0 +1,99 @@
+/*
+  Conformance with C++20 std::chrono calendar (and the time-zone database if available)
+  Compiled only in C++20 builds (native_20) that have them.
+*/
+#include <gtest/gtest.h>
+#include <gob_datetime.hpp>
+#include <gob_zone_rules.hpp>
+#include "chrono_calendar.hpp"
+#include "helper.hpp"
+
+#if defined(CHRONO_CALENDAR)
+using namespace goblib::datetime;
+namespace chr = std::chrono;
+
+namespace
+{
+constexpr int MAX_REPORT = 8; // Number of mismatches to report in detail.
+
+bool sameDate(const LocalDate& ld, const chr::year_month_day& ymd)
+{
+    return ld.year() == static_cast<int>(ymd.year()) && ld.month() == static_cast<int>(static_cast<unsigned>(ymd.month()))
+            && ld.day() == static_cast<int>(static_cast<unsigned>(ymd.day()));
+}
+//
+}
+
+TEST(ChronoConformance, EpochDay)
+{
+    // All the days in 1970-9999, and every 97 days after that.
+    const int32_t last = LocalDate(9999, 12, 31).toEpochDay();
+    const int32_t maxDay = LocalDate::MAX.toEpochDay();
+    int mismatch{};
+    for(int32_t ed = 0; ed <= maxDay; ed += (ed < last) ? 1 : 97)
+    {
+        const chr::sys_days sd{chr::days{ed}};
+        const chr::year_month_day ymd{sd};
+        const LocalDate ld = LocalDate::ofEpochDay(ed);
+        const LocalDate jan1(ld.year(), 1, 1);
+
+        bool ok = sameDate(ld, ymd)
+                && ld.toEpochDay() == sd.time_since_epoch().count()
+                && static_cast<unsigned>(ld.dayOfWeek()) == chr::weekday{sd}.c_encoding()
+                && ld.dayOfYear() == (sd - chr::sys_days{ymd.year() / chr::January / 1}).count()
+                && ld.isLeapYear() == ymd.year().is_leap()
+                && ld.lengthOfMonth() == static_cast<int>(static_cast<unsigned>(chr::year_month_day_last{ymd.year() / ymd.month() / chr::last}.day()))
+                && jan1.toEpochDay() == chr::sys_days{ymd.year() / chr::January / 1}.time_since_epoch().count();
+        if(!ok && mismatch++ < MAX_REPORT)
+        {
+            ADD_FAILURE() << "epoch day " << ed << " : " << ld.toString().c_str();
+        }
+    }
+    EXPECT_EQ(0, mismatch);
+}
+
+TEST(ChronoConformance, Format)
+{
+    int mismatch{};
+    for(int64_t t = 0; t < 4102444800LL; t += 86400LL * 13 + 3607) // until 2100-01-01
+    {
+        auto s0 = LocalDateTime::ofEpochSecond(static_cast<time_t>(t), ZoneOffset::UTC).toString();
+        auto s1 = chronoToString(chr::sys_seconds{chr::seconds{t}});
+        if(s1 != s0.c_str() && mismatch++ < MAX_REPORT)
+        {
+            ADD_FAILURE() << t << " : " << s0.c_str() << " != " << s1;
+        }
+    }
+    EXPECT_EQ(0, mismatch);
+}
+
+# if defined(CHRONO_TZDB)
+// POSIX TZ string describes only the current rule, so compare from 2024.
+TEST(ChronoConformance, Zone)
+{
+    const char* locations[] =
+    {
+        "Asia/Tokyo", "America/Los_Angeles", "America/New_York", "America/St_Johns", "Europe/London", "Europe/Paris",
+        "Asia/Kolkata", "Asia/Kathmandu", "Australia/Sydney", "Australia/Lord_Howe", "Pacific/Auckland", "Pacific/Chatham",
+    };
+    for(auto& loc : locations)
+    {
+        auto zr = ZoneRules::ofLocation(loc);
+        ASSERT_TRUE(zr.valid()) << loc;
+        const chr::time_zone* tz{};
+        try { tz = chr::locate_zone(loc); } catch(...) { continue; } // Not in the database of this system
+        int mismatch{};
+        for(int64_t t = 1704067200LL; t < 2051222400LL; t += 1800) // 2024 - 2034
+        {
+            const chr::sys_seconds tp{chr::seconds{t}};
+            const auto off = tz->get_info(tp).offset.count();
+            if(zr.offset(static_cast<time_t>(t)).totalSeconds() != off && mismatch++ < MAX_REPORT)
+            {
+                ADD_FAILURE() << loc << " : " << t;
+            }
+        }
+        EXPECT_EQ(0, mismatch) << loc;
+    }
+}
+# endif
+#endif
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <gob_coroutine.hpp>
+#include "helper.hpp"
+
+#if defined(GOBLIB_DATETIME_HAS_COROUTINE)
+#include <vector>
+#include <random>
+#include <algorithm>
+
+using namespace goblib::datetime;
+
+namespace
+{
+time_t epochOf(const char* s) { return OffsetDateTime::parse(s).toEpochSecond(); }
+}
+
+TEST(Coroutine, SleepUntil)
+{
+    time_t clock = epochOf("2022-12-31T23:59:00Z");
+    TimerScheduler sched([&]() { return clock; });
+    std::vector<int> log;
+
+    auto task = [&](const int id, const OffsetDateTime odt) -> DetachedTask
+    {
+        auto due = co_await sched.sleepUntil(odt);
+        EXPECT_EQ(odt, due);
+        log.push_back(id);
+    };
+    task(1, OffsetDateTime::parse("2023-01-01T09:00:30+09:00"));
+    task(2, OffsetDateTime::parse("2023-01-01T00:00:10Z"));
+    task(3, OffsetDateTime::parse("2022-12-31T15:00:10-09:00")); // Same instant as 2, FIFO
+    task(4, OffsetDateTime::parse("2022-12-31T23:00:00Z"));      // Already passed
+    EXPECT_EQ(std::vector<int>({ 4 }), log);
+    EXPECT_EQ(3U, sched.size());
+    EXPECT_EQ(epochOf("2023-01-01T00:00:10Z"), sched.nextDue());
+
+    EXPECT_EQ(0U, sched.poll());
+    clock = epochOf("2023-01-01T00:00:10Z");
+    EXPECT_EQ(2U, sched.poll());
+    EXPECT_EQ(std::vector<int>({ 4, 2, 3 }), log);
+    clock += 20;
+    EXPECT_EQ(1U, sched.poll());
+    EXPECT_EQ(std::vector<int>({ 4, 2, 3, 1 }), log);
+    EXPECT_TRUE(sched.empty());
+    EXPECT_EQ(-1, sched.nextDue());
+
+    // sleepFor and loop
+    int count{};
+    auto ticker = [&]() -> DetachedTask
+    {
+        for(int i = 0; i < 3; ++i)
+        {
+            co_await sched.sleepFor(std::chrono::minutes(1));
+            ++count;
+        }
+    };
+    ticker();
+    for(int i = 0; i < 5; ++i) { clock += 60; sched.poll(); }
+    EXPECT_EQ(3, count);
+    EXPECT_TRUE(sched.empty());
+}
+
+TEST(Coroutine, WallClockJump)
+{
+    time_t clock = epochOf("2023-06-01T00:00:00Z");
+    TimerScheduler sched([&]() { return clock; });
+    int resumed{};
+    auto task = [&](const time_t epoch) -> DetachedTask
+    {
+        co_await sched.sleepUntil(epoch);
+        ++resumed;
+    };
+    for(int i = 1; i <= 10; ++i) { task(clock + i * 3600); }
+
+    clock -= 86400; // Backward
+    EXPECT_EQ(0U, sched.poll());
+    clock += 86400 + 3600 * 3; // Forward
+    EXPECT_EQ(3U, sched.poll());
+    clock += 86400 * 30; // Forward far
+    EXPECT_EQ(7U, sched.poll());
+    EXPECT_EQ(10, resumed);
+}
+
+TEST(Coroutine, NextLocal)
+{
+    auto ny = ZoneRules::ofLocation("America/New_York");
+    ASSERT_TRUE(ny.valid());
+    time_t clock = epochOf("2023-03-11T12:00:00-05:00");
+    TimerScheduler sched([&]() { return clock; });
+    std::vector<OffsetDateTime> fired;
+
+    auto daily = [&](const LocalTime lt) -> DetachedTask
+    {
+        for(;;) { fired.push_back(co_await sched.nextLocal(lt, ny)); }
+    };
+    daily(LocalTime(2, 30, 0)); // In the gap of 2023-03-12
+    EXPECT_EQ(epochOf("2023-03-12T03:30:00-04:00"), sched.nextDue());
+    for(int i = 0; i < 3 * 24; ++i) { clock += 3600; sched.poll(); }
+    ASSERT_EQ(3U, fired.size());
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T03:30:00-04:00"), fired[0]);
+    EXPECT_EQ(ZoneOffset::of(-4), fired[0].offset());
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-13T02:30:00-04:00"), fired[1]);
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-14T02:30:00-04:00"), fired[2]);
+    EXPECT_EQ(1U, sched.size()); // Still waiting, destroyed with the scheduler
+
+    // Overlap uses the earlier
+    fired.clear();
+    clock = epochOf("2023-11-04T12:00:00-04:00");
+    TimerScheduler sched2([&]() { return clock; });
+    auto once = [&](const LocalTime lt) -> DetachedTask { fired.push_back(co_await sched2.nextLocal(lt, ny)); };
+    once(LocalTime(1, 30, 0));
+    once(LocalTime(12, 0, 0)); // Now is not the next
+    EXPECT_EQ(epochOf("2023-11-05T01:30:00-04:00"), sched2.nextDue());
+    clock = epochOf("2023-11-06T00:00:00Z");
+    EXPECT_EQ(2U, sched2.poll());
+    ASSERT_EQ(2U, fired.size());
+    EXPECT_EQ(OffsetDateTime::parse("2023-11-05T01:30:00-04:00"), fired[0]);
+    EXPECT_EQ(OffsetDateTime::parse("2023-11-05T12:00:00-05:00"), fired[1]);
+}
+
+TEST(Coroutine, ManyWaiters)
+{
+    constexpr int N = 10000;
+    time_t clock = 86400;
+    TimerScheduler sched([&]() { return clock; });
+    std::vector<time_t> order;
+    order.reserve(N);
+    auto task = [&](const time_t epoch) -> DetachedTask
+    {
+        auto due = co_await sched.sleepUntil(epoch);
+        EXPECT_EQ(epoch, due.toEpochSecond());
+        order.push_back(clock);
+    };
+    std::mt19937 rng(52);
+    std::uniform_int_distribution<int> dist(1, 86400);
+    for(int i = 0; i < N; ++i) { task(clock + dist(rng)); }
+    EXPECT_EQ(static_cast<size_t>(N), sched.size());
+
+    size_t total{};
+    for(int i = 0; i < 86400; i += 600) { clock += 600; total += sched.poll(); }
+    EXPECT_EQ(static_cast<size_t>(N), total);
+    EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+}
+#endif
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <gob_cron.hpp>
+#include "helper.hpp"
+
+using namespace goblib::datetime;
+
+namespace
+{
+// Brute-force search for comparison.
+LocalDateTime bruteForceNext(const CronExpression& ce, const LocalDateTime& after, const int32_t step)
+{
+    auto t = after.toEpochSecond(ZoneOffset::UTC);
+    t = t - (t % step) + step;
+    for(int i = 0; i < 366 * 24 * 60 * 2; ++i, t += step)
+    {
+        auto ldt = LocalDateTime::ofEpochSecond(t, ZoneOffset::UTC);
+        if(ce.matches(ldt)) { return ldt; }
+    }
+    return LocalDateTime();
+}
+//
+}
+
+TEST(CronExpression, Parse)
+{
+    // valid
+    {
+        const char* tbl[] =
+        {
+            "* * * * *", "0 0 * * *", "*/15 9-17 * * MON-FRI", "0 12 1,15 * ?", "0 0 29 2 *", "5/10 * * jan,Jul sun",
+            "30 */2 * * * *", "0 0 * * 7", "@yearly", "@annually", "@monthly", "@weekly", "@daily", "@midnight", "@hourly",
+            "  1  2  3  4  5  ",
+        };
+        for(auto& e : tbl) { EXPECT_TRUE(CronExpression::parse(e).valid()) << e; }
+    }
+    // invalid
+    {
+        const char* tbl[] =
+        {
+            "", "*", "* * * *", "* * * * * * *", "60 * * * *", "* 24 * * *", "* * 0 * *", "* * 32 * *",
+            "* * * 13 *", "* * * * 8", "5-1 * * * *", "*/0 * * * *", "? * * * *", "* * * FOO *", "1,,2 * * * *",
+            "@never", "x * * * *",
+        };
+        for(auto& e : tbl) { EXPECT_FALSE(CronExpression::parse(e).valid()) << e; }
+        EXPECT_FALSE(CronExpression::parse(nullptr).valid());
+        EXPECT_FALSE(CronExpression().valid());
+    }
+}
+
+TEST(CronExpression, Matches)
+{
+    CronExpression ce("*/15 9-17 * * MON-FRI");
+    EXPECT_TRUE(ce.matches(LocalDateTime(2022, 12, 13, 9, 45, 0)));  // Tue
+    EXPECT_FALSE(ce.matches(LocalDateTime(2022, 12, 13, 9, 45, 1)));
+    EXPECT_FALSE(ce.matches(LocalDateTime(2022, 12, 13, 9, 46, 0)));
+    EXPECT_FALSE(ce.matches(LocalDateTime(2022, 12, 13, 18, 0, 0)));
+    EXPECT_FALSE(ce.matches(LocalDateTime(2022, 12, 11, 9, 45, 0))); // Sun
+
+    // Both day-of-month and day-of-week are restricted => OR
+    CronExpression ce2("0 0 13 * FRI");
+    EXPECT_TRUE(ce2.matches(LocalDateTime(2022, 12, 13, 0, 0, 0)));  // Tue 13th
+    EXPECT_TRUE(ce2.matches(LocalDateTime(2022, 12, 16, 0, 0, 0)));  // Fri
+    EXPECT_FALSE(ce2.matches(LocalDateTime(2022, 12, 14, 0, 0, 0)));
+    // Day-of-week is "*" => day-of-month only
+    CronExpression ce3("0 0 13 * *");
+    EXPECT_FALSE(ce3.matches(LocalDateTime(2022, 12, 16, 0, 0, 0)));
+
+    // "n/step" runs to the maximum, but "n-n/step" is the single value
+    CronExpression ce4("0 5-5/10 * * * *"), ce5("0 5/10 * * * *"), ce6("5-25/10 * * * *");
+    for(int8_t m = 0; m < 60; ++m)
+    {
+        const LocalDateTime ldt(2022, 12, 13, 9, m, 0);
+        EXPECT_EQ(m == 5, ce4.matches(ldt)) << (int)m;
+        EXPECT_EQ(m % 10 == 5, ce5.matches(ldt)) << (int)m;
+        EXPECT_EQ(m % 10 == 5 && m <= 25, ce6.matches(ldt)) << (int)m;
+    }
+}
+
+TEST(CronExpression, NextLocal)
+{
+    {
+        struct EAN { const char* expr; LocalDateTime after; LocalDateTime next; };
+        EAN tbl[] =
+        {
+            { "* * * * *",         { 2022, 12, 31, 23, 59, 30 }, { 2023,  1,  1,  0,  0,  0 } },
+            { "0 0 29 2 *",        { 2021,  1,  1,  0,  0,  0 }, { 2024,  2, 29,  0,  0,  0 } },
+            { "0 0 31 * *",        { 2022,  1, 31,  0,  0,  0 }, { 2022,  3, 31,  0,  0,  0 } },
+            { "*/15 9-17 * * 1-5", { 2022, 12, 16, 17, 45,  0 }, { 2022, 12, 19,  9,  0,  0 } },
+            { "0 0 13 * 5",        { 2022, 12, 13,  0,  0,  0 }, { 2022, 12, 16,  0,  0,  0 } },
+            { "30 */2 * * * *",    { 2022, 12, 13, 12, 34, 30 }, { 2022, 12, 13, 12, 36, 30 } },
+            { "@yearly",           { 2022,  6,  1,  0,  0,  0 }, { 2023,  1,  1,  0,  0,  0 } },
+            { "@weekly",           { 2022, 12, 13,  0,  0,  0 }, { 2022, 12, 18,  0,  0,  0 } },
+            { "0 0 * * SUN",       { 2022, 12, 13,  0,  0,  0 }, { 2022, 12, 18,  0,  0,  0 } },
+            { "0 0 * * 7",         { 2022, 12, 13,  0,  0,  0 }, { 2022, 12, 18,  0,  0,  0 } },
+        };
+        for(auto& e : tbl)
+        {
+            auto ce = CronExpression::parse(e.expr);
+            auto n = ce.next(e.after);
+            EXPECT_TRUE(n.valid()) << e.expr;
+            EXPECT_EQ(e.next, n) << e.expr << " : " << n.toString().c_str();
+        }
+    }
+    // Never
+    EXPECT_FALSE(CronExpression("0 0 30 2 *").next(LocalDateTime(2022, 1, 1, 0, 0, 0)).valid());
+
+    // Compare with brute force
+    {
+        const char* tbl[] = { "7 */5 * * *", "0 12 1,15 * ?", "0 0 1-7 * MON", "*/10 3 * * 2,4", "0 0 * * 6,0" };
+        for(auto& e : tbl)
+        {
+            auto ce = CronExpression::parse(e);
+            LocalDateTime ldt(2019, 12, 30, 12, 34, 0);
+            for(int i = 0; i < 10; ++i)
+            {
+                auto n = ce.next(ldt);
+                EXPECT_EQ(bruteForceNext(ce, ldt, 60), n) << e << " : " << ldt.toString().c_str();
+                ldt = n;
+            }
+        }
+    }
+}
+
+TEST(CronExpression, NextZone)
+{
+    auto la = ZoneRules::ofLocation("America/Los_Angeles");
+    // Normal
+    {
+        CronExpression ce("0 9 * * *");
+        auto n = ce.next(OffsetDateTime::of(2022, 12, 13, 10, 0, 0, ZoneOffset::of(-8)), la);
+        EXPECT_STREQ("2022-12-14T09:00:00-08:00", n.toString().c_str());
+        n = ce.next(OffsetDateTime::of(2022, 12, 13, 10, 0, 0, ZoneOffset::UTC), la); // 02:00 -08:00
+        EXPECT_STREQ("2022-12-13T09:00:00-08:00", n.toString().c_str());
+    }
+    // Gap (2020-03-08 02:00 -> 03:00)
+    {
+        CronExpression ce("30 2 * * *");
+        auto n = ce.next(OffsetDateTime::of(2020, 3, 7, 12, 0, 0, ZoneOffset::of(-8)), la);
+        EXPECT_STREQ("2020-03-08T03:00:00-07:00", n.toString().c_str());
+        n = ce.next(n, la);
+        EXPECT_STREQ("2020-03-09T02:30:00-07:00", n.toString().c_str());
+
+        CronExpression hourly("0 * * * *");
+        auto h = hourly.next(OffsetDateTime::of(2020, 3, 8, 1, 30, 0, ZoneOffset::of(-8)), la);
+        EXPECT_STREQ("2020-03-08T03:00:00-07:00", h.toString().c_str());
+        h = hourly.next(h, la);
+        EXPECT_STREQ("2020-03-08T04:00:00-07:00", h.toString().c_str());
+    }
+    // Overlap (2020-11-01 02:00 -> 01:00) fires once.
+    {
+        CronExpression ce("30 1 * * *");
+        auto n = ce.next(OffsetDateTime::of(2020, 10, 31, 12, 0, 0, ZoneOffset::of(-7)), la);
+        EXPECT_STREQ("2020-11-01T01:30:00-07:00", n.toString().c_str());
+        n = ce.next(n, la);
+        EXPECT_STREQ("2020-11-02T01:30:00-08:00", n.toString().c_str());
+
+        CronExpression every15("*/15 * * * *");
+        auto m = every15.next(OffsetDateTime::of(2020, 11, 1, 1, 50, 0, ZoneOffset::of(-7)), la);
+        EXPECT_STREQ("2020-11-01T02:00:00-08:00", m.toString().c_str()); // Skip the repeated 01:00-01:59
+    }
+    // Fixed offset
+    {
+        CronExpression ce("0 0 * * *");
+        auto n = ce.next(OffsetDateTime::of(2022, 12, 13, 10, 0, 0, ZoneOffset::of(9)));
+        EXPECT_STREQ("2022-12-14T00:00:00+09:00", n.toString().c_str());
+    }
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <gob_date_range.hpp>
+#include "helper.hpp"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <climits>
+
+using namespace goblib::datetime;
+
+TEST(DateRange, Days)
+{
+    // Compare with epoch day
+    {
+        struct SEA { LocalDate s, e; int32_t amount; };
+        SEA tbl[] =
+        {
+            { { 1970,  1,  1 }, { 1970,  1,  1 },   1 },
+            { { 1999, 12, 25 }, { 2000,  3, 10 },   1 },
+            { { 2000,  2, 27 }, { 2001,  3,  2 },   3 },
+            { { 2012,  1,  1 }, { 2030,  1,  1 },  40 },
+            { { 2012,  1,  1 }, { 2030,  1,  1 }, 400 },
+            { { 2022, 12, 13 }, { 2022, 12, 12 },   1 },
+        };
+        for(auto& e : tbl)
+        {
+            DateRange range(e.s, e.e, e.amount);
+            int32_t ed = e.s.toEpochDay();
+            size_t cnt{};
+            for(auto& ld : range)
+            {
+                auto exp = LocalDateTime::ofEpochSecond((time_t)ed * 86400, ZoneOffset::UTC).toLocalDate();
+                EXPECT_EQ(exp, ld) << ld.toString().c_str();
+                EXPECT_TRUE(ld < e.e) << ld.toString().c_str();
+                ed += e.amount;
+                ++cnt;
+            }
+            EXPECT_EQ(cnt, range.size()) << e.s.toString().c_str();
+            EXPECT_GE(ed, e.e.toEpochDay()) << e.s.toString().c_str();
+            EXPECT_EQ(range.size() == 0, range.empty());
+        }
+    }
+    // Weeks
+    {
+        DateRange range(LocalDate(2022, 12, 5), LocalDate(2023, 2, 1), 1, ChronoUnit::Weeks);
+        EXPECT_EQ(9U, range.size());
+        for(auto& ld : range) { EXPECT_EQ(DayOfWeek::Mon, ld.dayOfWeek()) << ld.toString().c_str(); }
+    }
+    // Unsupported
+    {
+        EXPECT_TRUE(DateRange(LocalDate(2022, 1, 1), LocalDate(2023, 1, 1), 1, ChronoUnit::Hours).empty());
+        EXPECT_TRUE(DateRange(LocalDate(2022, 1, 1), LocalDate(2023, 1, 1), 0).empty());
+        EXPECT_TRUE(DateRange(LocalDate(2022, 1, 1), LocalDate(2023, 1, 1), -1).empty());
+    }
+    // Large step
+    for(auto u : { ChronoUnit::Days, ChronoUnit::Weeks, ChronoUnit::Months, ChronoUnit::Years })
+    {
+        DateRange range(LocalDate(1900, 1, 1), LocalDate(2100, 1, 1), INT32_MAX, u);
+        std::vector<LocalDate> v(range.begin(), range.end());
+        ASSERT_EQ(1U, v.size());
+        EXPECT_EQ(LocalDate(1900, 1, 1), v[0]);
+    }
+}
+
+TEST(DateRange, Months)
+{
+    {
+        const char* exp[] = { "2020-01-31", "2020-02-29", "2020-03-31", "2020-04-30", "2020-05-31", "2020-06-30",
+                              "2020-07-31", "2020-08-31", "2020-09-30", "2020-10-31", "2020-11-30", "2020-12-31",
+                              "2021-01-31", "2021-02-28", "2021-03-31" };
+        DateRange range(LocalDate(2020, 1, 31), LocalDate(2021, 3, 31), 1, ChronoUnit::Months);
+        ASSERT_EQ(14U, range.size());
+        size_t i{};
+        for(auto& ld : range) { EXPECT_STREQ(exp[i++], ld.toString().c_str()); }
+        EXPECT_EQ(15U, DateRange(LocalDate(2020, 1, 31), LocalDate(2021, 4, 1), 1, ChronoUnit::Months).size());
+        EXPECT_EQ(14U, DateRange(LocalDate(2020, 1, 31), LocalDate(2021, 3, 30), 1, ChronoUnit::Months).size());
+    }
+    {
+        DateRange range(LocalDate(2020, 1, 31), LocalDate(2021, 1, 1), 3, ChronoUnit::Months);
+        std::vector<LocalDate> v(range.begin(), range.end());
+        ASSERT_EQ(4U, v.size());
+        EXPECT_EQ(LocalDate(2020,  1, 31), v[0]);
+        EXPECT_EQ(LocalDate(2020,  4, 30), v[1]);
+        EXPECT_EQ(LocalDate(2020,  7, 31), v[2]);
+        EXPECT_EQ(LocalDate(2020, 10, 31), v[3]);
+    }
+    // Years
+    {
+        DateRange range(LocalDate(2000, 2, 29), LocalDate(2010, 1, 1), 2, ChronoUnit::Years);
+        std::vector<LocalDate> v(range.begin(), range.end());
+        ASSERT_EQ(5U, v.size());
+        EXPECT_EQ(LocalDate(2000, 2, 29), v[0]);
+        EXPECT_EQ(LocalDate(2002, 2, 28), v[1]);
+        EXPECT_EQ(LocalDate(2004, 2, 29), v[2]);
+        EXPECT_EQ(LocalDate(2008, 2, 29), v[4]);
+    }
+}
+
+TEST(DateRange, Algorithms)
+{
+    DateRange range(LocalDate(2022, 1, 1), LocalDate(2023, 1, 1));
+    EXPECT_EQ(365, std::distance(range.begin(), range.end()));
+    EXPECT_EQ(52, std::count_if(range.begin(), range.end(), [](const LocalDate& ld) { return ld.dayOfWeek() == DayOfWeek::Sun; }));
+    auto it = std::find(range.begin(), range.end(), LocalDate(2022, 3, 1));
+    ASSERT_TRUE(it != range.end());
+    EXPECT_EQ(31 + 28, it->dayOfYear());
+    EXPECT_TRUE(std::is_sorted(range.begin(), range.end()));
+}
+
+TEST(DateTimeRange, Basic)
+{
+    // Compare with epoch second
+    {
+        struct SEAU { LocalDateTime s, e; int32_t amount; ChronoUnit unit; int32_t sec; };
+        SEAU tbl[] =
+        {
+            { { 1999, 12, 31, 20,  0,  0 }, { 2000,  1,  1,  4,  0,  0 },  1, ChronoUnit::Hours,    3600 },
+            { { 2000,  2, 28, 23, 59, 58 }, { 2000,  3,  1,  0,  0,  3 },  1, ChronoUnit::Seconds,  1 },
+            { { 2020, 12, 31,  0,  0,  0 }, { 2021,  1,  3,  0,  0,  0 }, 90, ChronoUnit::Minutes,  90 * 60 },
+            { { 2020,  2, 28, 12, 34, 56 }, { 2021,  3,  3,  0,  0,  0 },  1, ChronoUnit::HalfDays, 43200 },
+            { { 2020,  2, 28, 12, 34, 56 }, { 2021,  3,  3,  0,  0,  0 },  3, ChronoUnit::Days,     3 * 86400 },
+            { { 2020,  2, 28, 12, 34, 56 }, { 2025,  3,  3,  0,  0,  0 },  2, ChronoUnit::Weeks,    14 * 86400 },
+            { { 2020,  2, 28, 12, 34, 56 }, { 2021,  3,  3,  0,  0,  0 }, 25, ChronoUnit::Hours,    25 * 3600 },
+            { { 2020,  2, 28, 12, 34, 56 }, { 2021,  3,  3,  0,  0,  0 }, 12345, ChronoUnit::Seconds, 12345 },
+        };
+        for(auto& e : tbl)
+        {
+            DateTimeRange range(e.s, e.e, e.amount, e.unit);
+            auto t = e.s.toEpochSecond(ZoneOffset::UTC);
+            size_t cnt{};
+            for(auto& ldt : range)
+            {
+                EXPECT_EQ(LocalDateTime::ofEpochSecond(t, ZoneOffset::UTC), ldt) << ldt.toString().c_str();
+                t += e.sec;
+                ++cnt;
+            }
+            EXPECT_EQ(cnt, range.size()) << e.s.toString().c_str();
+            EXPECT_GE(t, e.e.toEpochSecond(ZoneOffset::UTC));
+            EXPECT_LT(t - e.sec, e.e.toEpochSecond(ZoneOffset::UTC));
+        }
+    }
+    // Months
+    {
+        DateTimeRange range(LocalDateTime(2020, 1, 31, 12, 0, 0), LocalDateTime(2020, 4, 30, 12, 0, 0), 1, ChronoUnit::Months);
+        std::vector<LocalDateTime> v(range.begin(), range.end());
+        ASSERT_EQ(3U, v.size());
+        EXPECT_EQ(LocalDateTime(2020, 1, 31, 12, 0, 0), v[0]);
+        EXPECT_EQ(LocalDateTime(2020, 2, 29, 12, 0, 0), v[1]);
+        EXPECT_EQ(LocalDateTime(2020, 3, 31, 12, 0, 0), v[2]);
+        EXPECT_EQ(4U, DateTimeRange(LocalDateTime(2020, 1, 31, 12, 0, 0), LocalDateTime(2020, 4, 30, 12, 0, 1), 1, ChronoUnit::Months).size());
+    }
+    // Empty
+    {
+        EXPECT_TRUE(DateTimeRange(LocalDateTime(2020, 1, 1, 0, 0, 0), LocalDateTime(2020, 1, 1, 0, 0, 0)).empty());
+        EXPECT_TRUE(DateTimeRange(LocalDateTime(2020, 1, 1, 0, 0, 1), LocalDateTime(2020, 1, 1, 0, 0, 0)).empty());
+        EXPECT_TRUE(DateTimeRange(LocalDateTime(2020, 1, 1, 0, 0, 0), LocalDateTime(2021, 1, 1, 0, 0, 0), 0).empty());
+    }
+    // Large step (beyond 32-bit seconds)
+    {
+        const LocalDateTime s(1900, 1, 1, 0, 0, 0), e(2100, 1, 1, 0, 0, 0);
+        DateTimeRange weeks(s, e, 5000, ChronoUnit::Weeks);
+        std::vector<LocalDateTime> v(weeks.begin(), weeks.end());
+        ASSERT_EQ(3U, v.size());
+        EXPECT_EQ(s, v[0]);
+        EXPECT_EQ(LocalDateTime::ofEpochSecond(s.toEpochSecond(ZoneOffset::UTC) + 5000LL * 7 * 86400, ZoneOffset::UTC), v[1]);
+        EXPECT_EQ(LocalDateTime::ofEpochSecond(s.toEpochSecond(ZoneOffset::UTC) + 10000LL * 7 * 86400, ZoneOffset::UTC), v[2]);
+        EXPECT_EQ(3U, DateTimeRange(s, e, 30000, ChronoUnit::Days).size());
+        EXPECT_EQ(2U, DateTimeRange(s, e, 1000000, ChronoUnit::Hours).size());
+        EXPECT_EQ(8U, DateTimeRange(s, e, 20000, ChronoUnit::HalfDays).size());
+        for(auto u : { ChronoUnit::Minutes, ChronoUnit::Hours, ChronoUnit::HalfDays, ChronoUnit::Days, ChronoUnit::Weeks, ChronoUnit::Months, ChronoUnit::Years })
+        {
+            DateTimeRange r(s, e, INT32_MAX, u);
+            ASSERT_EQ(1U, r.size());
+            std::vector<LocalDateTime> one(r.begin(), r.end());
+            ASSERT_EQ(1U, one.size());
+            EXPECT_EQ(s, one[0]);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <gob_day_grouper.hpp>
+#include "helper.hpp"
+#include <vector>
+
+using namespace goblib::datetime;
+
+namespace
+{
+const char* locations[] =
+{
+    "Asia/Tokyo", "America/Los_Angeles", "America/New_York", "America/St_Johns", "America/Sao_Paulo",
+    "America/Santiago", "America/Havana", "America/Scoresbysund", "Europe/London", "Europe/Dublin",
+    "Asia/Kathmandu", "Australia/Lord_Howe", "Pacific/Chatham", "Asia/Gaza",
+};
+
+LocalDate naiveDay(const time_t t, const ZoneRules& zr)
+{
+    return LocalDateTime::ofEpochSecond(t, zr.offset(t)).toLocalDate();
+}
+//
+}
+
+TEST(LocalDayGrouper, Basic)
+{
+    auto ny = ZoneRules::ofLocation("America/New_York");
+    LocalDayGrouper g(ny);
+    EXPECT_FALSE(g.day().valid());
+    EXPECT_EQ(0U, g.count());
+
+    const time_t t = OffsetDateTime::parse("2023-03-11T23:00:00-05:00").toEpochSecond();
+    EXPECT_TRUE(g.push(t));
+    EXPECT_EQ(LocalDate(2023, 3, 11), g.day());
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-11T00:00:00-05:00").toEpochSecond(), g.dayStart());
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T00:00:00-05:00").toEpochSecond(), g.nextMidnight());
+    EXPECT_EQ(86400, g.lengthOfDaySeconds());
+    EXPECT_FALSE(g.push(t + 3599));
+    EXPECT_EQ(2U, g.count());
+    // 23 hours
+    EXPECT_TRUE(g.push(t + 3600));
+    EXPECT_EQ(1U, g.count());
+    EXPECT_EQ(LocalDate(2023, 3, 12), g.day());
+    EXPECT_EQ(82800, g.lengthOfDaySeconds());
+    EXPECT_FALSE(g.push(g.nextMidnight() - 1));
+    // Back to the previous day
+    EXPECT_TRUE(g.push(t));
+    EXPECT_EQ(LocalDate(2023, 3, 11), g.day());
+    // 25 hours
+    EXPECT_TRUE(g.push(OffsetDateTime::parse("2023-11-05T12:00:00-05:00").toEpochSecond()));
+    EXPECT_EQ(90000, g.lengthOfDaySeconds());
+
+    g.reset();
+    EXPECT_EQ(0U, g.count());
+    EXPECT_TRUE(g.push(t));
+
+    // Midnight in the gap starts the day at the end of the gap
+    {
+        auto havana = ZoneRules::parse("CST5CDT,M3.2.0/0,M11.1.0/1");
+        EXPECT_EQ(OffsetDateTime::parse("2023-03-12T01:00:00-04:00").toEpochSecond(), LocalDayGrouper::startOfDay(LocalDate(2023, 3, 12), havana));
+        LocalDayGrouper h(havana);
+        EXPECT_TRUE(h.push(OffsetDateTime::parse("2023-03-12T12:00:00-04:00").toEpochSecond()));
+        EXPECT_EQ(82800, h.lengthOfDaySeconds());
+    }
+    // Fixed
+    {
+        LocalDayGrouper u;
+        EXPECT_TRUE(u.push(-1));
+        EXPECT_EQ(LocalDate(1969, 12, 31), u.day());
+        EXPECT_TRUE(u.push(0));
+        EXPECT_FALSE(u.push(86399));
+        EXPECT_TRUE(u.push(86400));
+    }
+}
+
+TEST(LocalDayGrouper, Boundaries)
+{
+    std::vector<time_t> epochs;
+    for(time_t t = OffsetDateTime::parse("2022-12-25T00:00:00Z").toEpochSecond(); t < OffsetDateTime::parse("2024-01-05T00:00:00Z").toEpochSecond(); t += 1021) { epochs.push_back(t); }
+    // Unsorted tail
+    const size_t sorted = epochs.size();
+    for(size_t i = 0; i < sorted; i += 13) { epochs.push_back(epochs[(i * 7919) % sorted]); }
+
+    for(auto& loc : locations)
+    {
+        auto zr = ZoneRules::ofLocation(loc);
+        std::vector<size_t> starts(epochs.size());
+        std::vector<LocalDate> days(epochs.size());
+        const size_t groups = localDayBoundaries(starts.data(), days.data(), epochs.data(), epochs.size(), zr);
+
+        std::vector<size_t> expectedStarts;
+        std::vector<LocalDate> expectedDays;
+        for(size_t i = 0; i < epochs.size(); ++i)
+        {
+            auto d = naiveDay(epochs[i], zr);
+            if(expectedDays.empty() || expectedDays.back() != d)
+            {
+                expectedStarts.push_back(i);
+                expectedDays.push_back(d);
+            }
+        }
+        ASSERT_EQ(expectedStarts.size(), groups) << loc;
+        for(size_t k = 0; k < groups; ++k)
+        {
+            ASSERT_EQ(expectedStarts[k], starts[k]) << loc << ' ' << k;
+            ASSERT_EQ(expectedDays[k], days[k]) << loc << ' ' << k;
+        }
+        EXPECT_EQ(groups, localDayBoundaries(starts.data(), nullptr, epochs.data(), epochs.size(), zr));
+
+        // The day bounds are the instants where the local day changes
+        LocalDayGrouper g(zr);
+        for(size_t i = 0; i < sorted; i += 97)
+        {
+            g.push(epochs[i]);
+            ASSERT_EQ(g.day(), naiveDay(g.dayStart(), zr)) << loc;
+            ASSERT_NE(g.day(), naiveDay(g.dayStart() - 1, zr)) << loc;
+            ASSERT_EQ(g.day(), naiveDay(g.nextMidnight() - 1, zr)) << loc;
+            ASSERT_NE(g.day(), naiveDay(g.nextMidnight(), zr)) << loc;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <gob_epoch_date.hpp>
+#include "helper.hpp"
+
+using namespace goblib::datetime;
+
+TEST(EpochDate, Basic)
+{
+    static_assert(sizeof(EpochDate) == sizeof(LocalDate), "");
+    {
+        constexpr EpochDate ed(19339);
+        static_assert(ed.valid(), "");
+        static_assert(ed.toEpochDay() == 19339, "");
+        static_assert(ed.dayOfWeek() == DayOfWeek::Tue, "");
+        EXPECT_EQ(19339 * 86400LL, ed.toEpochSecond());
+        static_assert(ed.plusDays(19).daysUntil(ed) == -19, "");
+        EXPECT_EQ(LocalDate(2022, 12, 13), ed.toLocalDate());
+        EXPECT_EQ(2022, ed.year());
+        EXPECT_EQ(12, ed.month());
+        EXPECT_EQ(13, ed.day());
+        EXPECT_EQ(ed, EpochDate(2022, 12, 13));
+        EXPECT_EQ(ed, EpochDate(LocalDate(2022, 12, 13)));
+        EXPECT_EQ(ed, EpochDate::parse("2022-12-13"));
+        EXPECT_STREQ("2022-12-13", ed.toString().c_str());
+        EXPECT_EQ(LocalDateTime(2022, 12, 13, 0, 0, 0), ed.atStartOfDay());
+        EXPECT_EQ(LocalDateTime(2022, 12, 13, 1, 2, 3), ed.atTime(LocalTime(1, 2, 3)));
+        EXPECT_EQ(OffsetDateTime(LocalDateTime(2022, 12, 13, 0, 0, 0), ZoneOffset::of(9)).toEpochSecond(), ed.toEpochSecond(ZoneOffset::of(9)));
+    }
+    EXPECT_EQ(LocalDate::MIN, EpochDate::MIN.toLocalDate());
+    EXPECT_EQ(LocalDate::MAX, EpochDate::MAX.toLocalDate());
+    EXPECT_EQ(EpochDate(), EpochDate::MIN);
+
+    // Invalid
+    EXPECT_FALSE(EpochDate(-1).valid());
+    EXPECT_FALSE((EpochDate::MAX + 1).valid());
+    EXPECT_FALSE(EpochDate(2022, 2, 29).valid());
+    EXPECT_FALSE(EpochDate::parse("2022-13-01").valid());
+    EXPECT_FALSE(EpochDate(-1).toLocalDate().valid());
+}
+
+TEST(EpochDate, Arithmetic)
+{
+    EpochDate ed(2022, 12, 31);
+    EXPECT_EQ(EpochDate(2023, 1, 1), ed + 1);
+    EXPECT_EQ(EpochDate(2022, 12, 1), ed - 30);
+    EXPECT_EQ(EpochDate(2023, 1, 14), ed.plusWeeks(2));
+    EXPECT_EQ(365, EpochDate(2023, 12, 31) - ed);
+    EXPECT_EQ(-365, ed - EpochDate(2023, 12, 31));
+    EXPECT_LT(ed, ed + 1);
+    EXPECT_GT(ed, ed - 1);
+    EXPECT_NE(ed, ed + 1);
+
+    auto e = ed;
+    ++e;
+    EXPECT_EQ(EpochDate(2023, 1, 1), e);
+    --e;
+    e += 60;
+    EXPECT_EQ(EpochDate(2023, 3, 1), e);
+    e -= 1;
+    EXPECT_EQ(EpochDate(2023, 2, 28), e);
+
+    // 2022-12-31 is Saturday
+    EXPECT_EQ(EpochDate(2022, 12, 26), ed.previousOrSame(DayOfWeek::Mon));
+    EXPECT_EQ(ed, ed.previousOrSame(DayOfWeek::Sat));
+    EXPECT_EQ(EpochDate(2023, 1, 2), ed.nextOrSame(DayOfWeek::Mon));
+    EXPECT_EQ(ed, ed.nextOrSame(DayOfWeek::Sat));
+}
+
+TEST(EpochDate, SameAsLocalDate)
+{
+    for(int32_t d = 0; d <= EpochDate::MAX.toEpochDay(); d += (d < 200000) ? 1 : 997)
+    {
+        auto ld = LocalDate::ofEpochDay(d);
+        EpochDate ed(ld);
+        ASSERT_EQ(d, ed.toEpochDay());
+        ASSERT_EQ(ld, ed.toLocalDate()) << d;
+        ASSERT_EQ(ld.dayOfWeek(), ed.dayOfWeek()) << d;
+    }
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <gob_http_date.hpp>
+#include "helper.hpp"
+
+using namespace goblib::datetime;
+
+TEST(HttpDate, Format)
+{
+    char buf[HTTP_DATE_BUFFER_SIZE];
+    EXPECT_EQ(29U, formatHttpDate(buf, sizeof(buf), (time_t)784111777));
+    EXPECT_STREQ("Sun, 06 Nov 1994 08:49:37 GMT", buf);
+    formatHttpDate(buf, sizeof(buf), OffsetDateTime::of(2022, 12, 13, 9, 8, 7, ZoneOffset::of(9)));
+    EXPECT_STREQ("Tue, 13 Dec 2022 00:08:07 GMT", buf);
+    formatHttpDate(buf, sizeof(buf), (time_t)0);
+    EXPECT_STREQ("Thu, 01 Jan 1970 00:00:00 GMT", buf);
+    EXPECT_EQ(0U, formatHttpDate(buf, sizeof(buf) - 1, (time_t)0));
+    EXPECT_EQ(0U, formatHttpDate(nullptr, sizeof(buf), (time_t)0));
+
+    // Same as strftime in C locale.
+    for(time_t t = 0; t < 4102444800LL; t += 86400 * 13 + 3607)
+    {
+        struct tm tm{};
+        gmtime_r(&t, &tm);
+        char expected[64];
+        strftime(expected, sizeof(expected), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+        formatHttpDate(buf, sizeof(buf), t);
+        EXPECT_STREQ(expected, buf) << t;
+    }
+}
+
+TEST(HttpDate, Parse)
+{
+    const char* tbl[] =
+    {
+        "Sun, 06 Nov 1994 08:49:37 GMT",  // IMF-fixdate
+        "Sunday, 06-Nov-94 08:49:37 GMT", // RFC 850
+        "Sun Nov  6 08:49:37 1994",       // asctime
+    };
+    for(auto& e : tbl)
+    {
+        auto odt = parseHttpDate(e);
+        EXPECT_TRUE(odt.valid()) << e;
+        EXPECT_EQ(784111777, odt.toEpochSecond()) << e;
+        EXPECT_EQ(ZoneOffset::UTC, odt.offset());
+    }
+    EXPECT_EQ(LocalDateTime(2022, 12, 13, 0, 8, 7), parseHttpDate("Tuesday, 13-Dec-22 00:08:07 GMT").toLocalDateTime());
+    EXPECT_EQ(LocalDateTime(2022, 12, 13, 0, 8, 7), parseHttpDate("Tue Dec 13 00:08:07 2022").toLocalDateTime());
+
+    const char* invalids[] =
+    {
+        "", "Sun, 06 Nov 1994 08:49:37", "Sun, 06 Nov 1994 08:49:37 UTC", "sun, 06 Nov 1994 08:49:37 GMT",
+        "Sun, 06 nov 1994 08:49:37 GMT", "Sun, 6 Nov 1994 08:49:37 GMT", "Sun, 31 Nov 1994 08:49:37 GMT",
+        "Sun, 06 Nov 1994 24:49:37 GMT", "Sun, 06 Nov 94 08:49:37 GMT", "Sun, 06-Nov-94 08:49:37 GMT",
+        "Sunday, 06-Nov-1994 08:49:37 GMT", "Sun Nov 6 08:49:37 1994", "Xyz, 06 Nov 1994 08:49:37 GMT",
+    };
+    for(auto& e : invalids) { EXPECT_FALSE(parseHttpDate(e).valid()) << e; }
+    EXPECT_FALSE(parseHttpDate(nullptr).valid());
+
+    // Round trip
+    char buf[HTTP_DATE_BUFFER_SIZE];
+    for(time_t t = 0; t < 4102444800LL; t += 86400 * 17 + 3559)
+    {
+        formatHttpDate(buf, sizeof(buf), t);
+        EXPECT_EQ(t, parseHttpDate(buf).toEpochSecond()) << buf;
+    }
+}
+
+TEST(HttpDate, Cache)
+{
+    HttpDateCache cache;
+    char buf[HTTP_DATE_BUFFER_SIZE];
+    const time_t tbl[] = { 784111777, 784111777, 784111778, 784111799, 784111800, 784111740, 0, 1671000000, 1671000059, 1671000060 };
+    for(auto& t : tbl)
+    {
+        formatHttpDate(buf, sizeof(buf), t);
+        EXPECT_STREQ(buf, cache.get(t)) << t;
+    }
+    EXPECT_EQ(29U, strlen(cache.now()));
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <gob_instrumentation.hpp>
+#include <gob_datetime.hpp>
+#include <gob_rfc3339.hpp>
+#include <cstring>
+#include "helper.hpp"
+
+using namespace goblib::datetime;
+
+TEST(Instrumentation, Names)
+{
+    for(uint8_t i = 0; i < PROBE_COUNT; ++i)
+    {
+        auto name = probeName(static_cast<Probe>(i));
+        ASSERT_NE(nullptr, name);
+        EXPECT_NE(0U, std::strlen(name)) << (int)i;
+    }
+    EXPECT_STREQ("strptime", probeName(Probe::Strptime));
+    EXPECT_STREQ("formatHttpDate", probeName(Probe::FormatHttpDate));
+    EXPECT_STREQ("ZoneOffset::toChars", probeName(Probe::FormatZoneOffset));
+    // No wrap around on long runs
+    static_assert(sizeof(ProbeStats::count) == 8, "64-bit counter");
+    static_assert(sizeof(ProbeStats::histogram[0]) == 8, "64-bit counter");
+    EXPECT_STREQ("", probeName(static_cast<Probe>(PROBE_COUNT)));
+}
+
+#if defined(GOBLIB_DATETIME_ENABLE_INSTRUMENTATION)
+TEST(Instrumentation, Enabled)
+{
+    EXPECT_TRUE(instrumentationEnabled());
+    resetProbes();
+    auto snap0 = probeSnapshot();
+    for(auto& s : snap0.stats) { EXPECT_EQ(0U, s.count); }
+
+    auto odt = OffsetDateTime::parse("2022-12-13T12:34:56+09:00");
+    auto str = odt.toString();
+    char buf[RFC3339_BUFFER_SIZE];
+    formatRFC3339(buf, sizeof(buf), odt);
+    formatRFC3339(buf, sizeof(buf), odt);
+
+    auto snap = probeSnapshot();
+    EXPECT_EQ(1U, snap[Probe::ParseOffsetDateTime].count);
+    EXPECT_EQ(1U, snap[Probe::Strptime].count);
+    EXPECT_EQ(1U, snap[Probe::ParseZoneOffset].count);
+    EXPECT_EQ(1U, snap[Probe::FormatLocalDateTime].count);
+    EXPECT_EQ(1U, snap[Probe::Strftime].count);
+    EXPECT_EQ(1U, snap[Probe::FormatZoneOffset].count);
+    EXPECT_EQ(2U, snap[Probe::StringAlloc].count);
+    EXPECT_EQ(2U, snap[Probe::FormatRFC3339].count);
+    EXPECT_EQ(0U, snap[Probe::ParseHttpDate].count);
+
+    for(auto& s : snap.stats)
+    {
+        uint64_t sum{};
+        for(auto& h : s.histogram) { sum += h; }
+        EXPECT_EQ(s.count, sum);
+    }
+    EXPECT_GT(snap[Probe::ParseOffsetDateTime].nanos, 0U);
+    EXPECT_GE(snap[Probe::ParseOffsetDateTime].nanos, snap[Probe::Strptime].nanos);
+
+    // toChars directly, and toString through it
+    resetProbes();
+    char zb[16];
+    odt.offset().toChars(zb, sizeof(zb));
+    odt.offset().toString();
+    EXPECT_EQ(2U, probeSnapshot()[Probe::FormatZoneOffset].count);
+
+    resetProbes();
+    EXPECT_EQ(0U, probeSnapshot()[Probe::FormatRFC3339].count);
+}
+#else
+TEST(Instrumentation, Disabled)
+{
+    EXPECT_FALSE(instrumentationEnabled());
+    auto odt = OffsetDateTime::parse("2022-12-13T12:34:56+09:00");
+    auto str = odt.toString();
+    auto snap = probeSnapshot();
+    for(auto& s : snap.stats)
+    {
+        EXPECT_EQ(0U, s.count);
+        EXPECT_EQ(0U, s.nanos);
+        for(auto& h : s.histogram) { EXPECT_EQ(0U, h); }
+    }
+}
+#endif
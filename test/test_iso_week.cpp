@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <gob_iso_week.hpp>
+#include "helper.hpp"
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(IsoWeek, Constexpr)
+{
+    static_assert(LocalDate(2021, 1, 3).isoWeek() == 53, "");
+    static_assert(LocalDate(2021, 1, 3).weekBasedYear() == 2020, "");
+    static_assert(LocalDate(2021, 1, 4).isoWeek() == 1, "");
+    static_assert(LocalDate(2019, 12, 30).isoWeek() == 1, "");
+    static_assert(LocalDate(2019, 12, 30).weekBasedYear() == 2020, "");
+    static_assert(LocalDate(2022, 12, 13).isoWeek() == 50, "");
+    static_assert(LocalDate(2022, 12, 13).isoDayOfWeek() == 2, "");
+    static_assert(LocalDate(2023, 1, 1).isoDayOfWeek() == 7, "");
+    static_assert(LocalDate::weeksInWeekBasedYear(2020) == 53, "");
+    static_assert(LocalDate::weeksInWeekBasedYear(2021) == 52, "");
+    static_assert(LocalDate::weeksInWeekBasedYear(2015) == 53, "");
+    static_assert(LocalDateTime(LocalDate(2021, 1, 3), LocalTime(1, 2, 3)).isoWeek() == 53, "");
+    static_assert(LocalDateTime(LocalDate(2021, 1, 3), LocalTime(1, 2, 3)).weekBasedYear() == 2020, "");
+    EXPECT_EQ(1, LocalDate(1970, 1, 1).isoWeek());
+    EXPECT_EQ(1970, LocalDate(1970, 1, 1).weekBasedYear());
+}
+
+// Same as strftime %G, %V, %u
+TEST(IsoWeek, SameAsStrftime)
+{
+    char buf[32];
+    for(int32_t ed = 0; ed < 200000; ++ed)
+    {
+        auto ld = LocalDate::ofEpochDay(ed);
+        struct tm tm{};
+        tm.tm_year = ld.year() - 1900;
+        tm.tm_mon = ld.month() - 1;
+        tm.tm_mday = ld.day();
+        tm.tm_wday = static_cast<int>(ld.dayOfWeek());
+        tm.tm_yday = ld.dayOfYear();
+        strftime(buf, sizeof(buf), "%G %V %u", &tm);
+        int y{}, w{}, d{};
+        ASSERT_EQ(3, sscanf(buf, "%d %d %d", &y, &w, &d));
+        ASSERT_EQ(y, ld.weekBasedYear()) << ed;
+        ASSERT_EQ(w, ld.isoWeek()) << ed;
+        ASSERT_EQ(d, ld.isoDayOfWeek()) << ed;
+        ASSERT_EQ(ld, ofIsoWeekDate(y, w, d)) << ed;
+    }
+}
+
+TEST(IsoWeek, FormatParse)
+{
+    char buf[ISO_WEEK_DATE_BUFFER_SIZE];
+    EXPECT_EQ(10U, formatIsoWeekDate(buf, sizeof(buf), LocalDate(2021, 1, 3)));
+    EXPECT_STREQ("2020-W53-7", buf);
+    EXPECT_EQ(10U, formatIsoWeekDate(buf, sizeof(buf), LocalDate(2022, 12, 13)));
+    EXPECT_STREQ("2022-W50-2", buf);
+    EXPECT_EQ(0U, formatIsoWeekDate(buf, sizeof(buf) - 1, LocalDate(2022, 12, 13)));
+    EXPECT_EQ(0U, formatIsoWeekDate(buf, sizeof(buf), LocalDate(2022, 2, 29)));
+    EXPECT_EQ(0U, formatIsoWeekDate(buf, sizeof(buf), LocalDate(12345, 1, 10)));
+
+    EXPECT_EQ(LocalDate(2021, 1, 3), parseIsoWeekDate("2020-W53-7"));
+    EXPECT_EQ(LocalDate(2020, 12, 28), parseIsoWeekDate("2020-W53"));
+    EXPECT_EQ(LocalDate(2021, 1, 3), parseIsoWeekDate("2020W537"));
+    EXPECT_EQ(LocalDate(2020, 12, 28), parseIsoWeekDate("2020W53"));
+    {
+        const char* end{};
+        EXPECT_EQ(LocalDate(2022, 12, 13), parseIsoWeekDate("2022-W50-2T12:00", &end));
+        EXPECT_STREQ("T12:00", end);
+    }
+    const char* ng[] = { "", "2021-W53-1", "2020-W00-1", "2020-W54-1", "2020-W01-8", "2020-W01-0", "2020-01-01", "20-W01-1", "2020-w01-1", "1970-W01-1" };
+    for(auto& s : ng) { EXPECT_FALSE(parseIsoWeekDate(s).valid()) << s; }
+    EXPECT_FALSE(parseIsoWeekDate(nullptr).valid());
+    EXPECT_FALSE(ofIsoWeekDate(2020, 1, 0).valid());
+
+    // Round trip
+    for(int32_t ed = 3; ed < 2932896; ed += 13)
+    {
+        auto ld = LocalDate::ofEpochDay(ed);
+        ASSERT_EQ(10U, formatIsoWeekDate(buf, sizeof(buf), ld));
+        ASSERT_EQ(ld, parseIsoWeekDate(buf)) << buf;
+    }
+}
+
+TEST(IsoWeek, Bulk)
+{
+    std::vector<LocalDate> dates;
+    std::vector<time_t> epochs;
+    const auto zo = ZoneOffset::of(-9, -30);
+    for(int32_t ed = 1; ed < 30000; ed += 3)
+    {
+        dates.push_back(LocalDate::ofEpochDay(ed));
+        epochs.push_back(ed * 86400LL + 3600 * 5);
+    }
+    const size_t n = dates.size();
+    std::vector<int8_t> weeks(n);
+    std::vector<int16_t> years(n);
+    isoWeeks(weeks.data(), years.data(), dates.data(), n);
+    std::vector<int32_t> keys(n);
+    isoWeekKeys(keys.data(), epochs.data(), n, zo);
+    for(size_t i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(dates[i].isoWeek(), weeks[i]);
+        ASSERT_EQ(dates[i].weekBasedYear(), years[i]);
+        auto ld = LocalDateTime::ofEpochSecond(epochs[i], zo).toLocalDate();
+        ASSERT_EQ(ld.weekBasedYear() * 100 + ld.isoWeek(), keys[i]) << i;
+    }
+    isoWeeks(weeks.data(), nullptr, dates.data(), n);
+}
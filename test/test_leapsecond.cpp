@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <gob_leap_second.hpp>
+#include "helper.hpp"
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(LeapSecond, Table)
+{
+    auto tbl = leapSecondTable();
+    auto sz = leapSecondTableSize();
+    ASSERT_GT(sz, 0U);
+    EXPECT_EQ(10, tbl[0].taiMinusUtc);
+    for(size_t i = 1; i < sz; ++i)
+    {
+        EXPECT_LT(tbl[i - 1].utc, tbl[i].utc);
+        EXPECT_EQ(tbl[i - 1].taiMinusUtc + 1, tbl[i].taiMinusUtc);
+        // Always at the start of January or July.
+        auto ldt = LocalDateTime::ofEpochSecond(tbl[i].utc, ZoneOffset::UTC);
+        EXPECT_TRUE((ldt.month() == 1 || ldt.month() == 7) && ldt.day() == 1 && ldt.toSecondOfDay() == 0) << ldt.toString().c_str();
+    }
+    EXPECT_EQ(LocalDateTime(2017, 1, 1, 0, 0, 0).toEpochSecond(ZoneOffset::UTC), tbl[sz - 1].utc);
+}
+
+TEST(LeapSecond, TaiMinusUtc)
+{
+    struct UO { LocalDateTime ldt; int32_t offset; };
+    UO tbl[] =
+    {
+        { { 1970,  1,  1,  0,  0,  0 }, 10 },
+        { { 1972,  6, 30, 23, 59, 59 }, 10 },
+        { { 1972,  7,  1,  0,  0,  0 }, 11 },
+        { { 1980,  1,  6,  0,  0,  0 }, 19 },
+        { { 2008, 12, 31, 23, 59, 59 }, 33 },
+        { { 2009,  1,  1,  0,  0,  0 }, 34 },
+        { { 2016, 12, 31, 23, 59, 59 }, 36 },
+        { { 2017,  1,  1,  0,  0,  0 }, 37 },
+        { { 2022, 12, 13, 12, 34, 56 }, 37 },
+    };
+    for(auto& e : tbl)
+    {
+        auto utc = e.ldt.toEpochSecond(ZoneOffset::UTC);
+        EXPECT_EQ(e.offset, taiMinusUtc(utc)) << e.ldt.toString().c_str();
+        EXPECT_EQ(utc + e.offset, utcToTai(utc)) << e.ldt.toString().c_str();
+    }
+}
+
+TEST(LeapSecond, LeapSecond)
+{
+    OffsetDateTime leap = OffsetDateTime::of(2016, 12, 31, 23, 59, 60, ZoneOffset::UTC);
+    OffsetDateTime leapJST = OffsetDateTime::of(2017, 1, 1, 8, 59, 60, ZoneOffset::of(9));
+    OffsetDateTime noLeap = OffsetDateTime::of(2017, 12, 31, 23, 59, 60, ZoneOffset::UTC);
+    EXPECT_TRUE(leap.valid());
+    EXPECT_TRUE(isLeapSecond(leap));
+    EXPECT_TRUE(isLeapSecond(leapJST));
+    EXPECT_FALSE(isLeapSecond(noLeap));
+    EXPECT_FALSE(isLeapSecond(OffsetDateTime::of(2016, 12, 31, 23, 59, 59, ZoneOffset::UTC)));
+
+    auto t59 = toTai(OffsetDateTime::of(2016, 12, 31, 23, 59, 59, ZoneOffset::UTC));
+    auto t60 = toTai(leap);
+    auto t00 = toTai(OffsetDateTime::of(2017, 1, 1, 0, 0, 0, ZoneOffset::UTC));
+    EXPECT_EQ(t59 + 1, t60);
+    EXPECT_EQ(t60 + 1, t00);
+    EXPECT_EQ(t60, toTai(leapJST));
+
+    bool inLeap{};
+    EXPECT_EQ(leap.toEpochSecond() - 1, taiToUtc(t59, &inLeap));
+    EXPECT_FALSE(inLeap);
+    EXPECT_EQ(leap.toEpochSecond(), taiToUtc(t60, &inLeap));
+    EXPECT_TRUE(inLeap);
+    EXPECT_EQ(leap.toEpochSecond(), taiToUtc(t00, &inLeap));
+    EXPECT_FALSE(inLeap);
+
+    auto odt = ofTai(t60);
+    EXPECT_EQ(60, odt.second());
+    EXPECT_STREQ("2016-12-31T23:59:60Z", odt.toString().c_str());
+    EXPECT_STREQ("2017-01-01T08:59:60+09:00", ofTai(t60, ZoneOffset::of(9)).toString().c_str());
+    EXPECT_STREQ("2017-01-01T00:00:00Z", ofTai(t00).toString().c_str());
+    EXPECT_STREQ("2016-12-31T23:59:59Z", ofTai(t59).toString().c_str());
+}
+
+TEST(LeapSecond, GPS)
+{
+    // GPS epoch
+    EXPECT_EQ(0, utcToGps(GPS_EPOCH_UTC));
+    EXPECT_EQ(GPS_EPOCH_UTC, gpsToUtc(0));
+    // GPS - UTC = 18 since 2017
+    auto utc = LocalDateTime(2022, 12, 13, 12, 34, 56).toEpochSecond(ZoneOffset::UTC);
+    EXPECT_EQ(utc - GPS_EPOCH_UTC + 18, utcToGps(utc));
+    EXPECT_EQ(utc, gpsToUtc(utcToGps(utc)));
+    EXPECT_EQ(utcToTai(utc), gpsToTai(taiToGps(utcToTai(utc))));
+}
+
+TEST(LeapSecond, Smear)
+{
+    auto leap = LocalDateTime(2017, 1, 1, 0, 0, 0).toEpochSecond(ZoneOffset::UTC);
+    auto noonBefore = (int64_t)leap - 12 * 3600;
+    auto noonAfter  = (int64_t)leap + 12 * 3600;
+
+    // Outside of the window, same as UTC.
+    EXPECT_EQ((noonBefore - 1) * 1000, taiToSmearedUtcMillis((noonBefore - 1 + 36) * 1000));
+    EXPECT_EQ(noonBefore * 1000, taiToSmearedUtcMillis((noonBefore + 36) * 1000));
+    EXPECT_EQ(noonAfter * 1000, taiToSmearedUtcMillis((noonAfter + 37) * 1000));
+    // Middle of the window, the smeared clock is half a second behind TAI - 36.
+    EXPECT_EQ((int64_t)leap * 1000, taiToSmearedUtcMillis(((int64_t)leap + 36) * 1000 + 500));
+
+    // Monotonic and continuous
+    int64_t prev = taiToSmearedUtcMillis((noonBefore + 36 - 10) * 1000);
+    for(int64_t t = (noonBefore + 36 - 10) * 1000 + 250; t < (noonAfter + 37 + 10) * 1000; t += 250)
+    {
+        auto s = taiToSmearedUtcMillis(t);
+        EXPECT_GT(s, prev) << t;
+        EXPECT_LE(s - prev, 250) << t;
+        prev = s;
+    }
+    // Round trip
+    for(int64_t t = (noonBefore + 36 - 10) * 1000; t < (noonAfter + 37 + 10) * 1000; t += 86401)
+    {
+        auto s = taiToSmearedUtcMillis(t);
+        EXPECT_NEAR(t, smearedUtcMillisToTai(s), 1) << t;
+    }
+}
+
+TEST(LeapSecond, Bulk)
+{
+    std::vector<time_t> utc;
+    for(time_t t = 0; t < 1700000000; t += 86400 * 7) { utc.push_back(t); }
+
+    std::vector<int64_t> tai(utc.size()), gps(utc.size());
+    std::vector<time_t> back(utc.size());
+    utcToTai(utc.data(), tai.data(), utc.size());
+    utcToGps(utc.data(), gps.data(), utc.size());
+    for(size_t i = 0; i < utc.size(); ++i)
+    {
+        EXPECT_EQ(utcToTai(utc[i]), tai[i]) << utc[i];
+        EXPECT_EQ(utcToGps(utc[i]), gps[i]) << utc[i];
+    }
+    taiToUtc(tai.data(), back.data(), tai.size());
+    EXPECT_EQ(utc, back);
+    gpsToUtc(gps.data(), back.data(), gps.size());
+    EXPECT_EQ(utc, back);
+
+    std::vector<int64_t> taiMillis, smeared(tai.size());
+    for(auto& e : tai) { taiMillis.push_back(e * 1000); }
+    taiToSmearedUtcMillis(taiMillis.data(), smeared.data(), taiMillis.size());
+    for(size_t i = 0; i < taiMillis.size(); ++i)
+    {
+        EXPECT_EQ(taiToSmearedUtcMillis(taiMillis[i]), smeared[i]) << taiMillis[i];
+    }
+}
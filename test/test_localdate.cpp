@@ -323,6 +323,37 @@ TEST(LocalDate, StaticMethods)
     }
     resetMockClock();
 
+    // ofEpochDay
+    {
+        for(int32_t eod = 0; eod < 366 * 500; eod += 13)
+        {
+            LocalDate ld = LocalDate::ofEpochDay(eod);
+            time_t t = (time_t)eod * 86400;
+            struct tm tmp{};
+            toGmtime(&t, &tmp);
+            EXPECT_EQ(LocalDate(tmp), ld) << eod;
+            EXPECT_EQ(eod, ld.toEpochDay()) << eod;
+        }
+        EXPECT_EQ(LocalDate::MIN, LocalDate::ofEpochDay(0));
+        EXPECT_EQ(LocalDate::MAX, LocalDate::ofEpochDay(LocalDate::MAX.toEpochDay()));
+    }
+    // ofYearDay
+    {
+        for(auto y : { 1999, 2000, 2100 })
+        {
+            LocalDate ld(y, 1, 1);
+            for(int16_t doy = 0; doy < ld.lengthOfYear(); ++doy)
+            {
+                auto ld2 = LocalDate::ofYearDay(y, doy);
+                EXPECT_TRUE(ld2.valid());
+                EXPECT_EQ(doy, ld2.dayOfYear()) << ld2.toString().c_str();
+                EXPECT_EQ(ld.toEpochDay() + doy, ld2.toEpochDay()) << ld2.toString().c_str();
+            }
+            EXPECT_FALSE(LocalDate::ofYearDay(y, -1).valid());
+            EXPECT_FALSE(LocalDate::ofYearDay(y, ld.lengthOfYear()).valid());
+        }
+    }
+
     // of -> constructor(y, m, d)
     // parse -> construct(str)
 }
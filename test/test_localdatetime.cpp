@@ -253,6 +253,22 @@ TEST(LocalDateTime, StaticMethods)
             EXPECT_EQ(e.lt, ldt.toLocalTime()) << e.e << " : " << e.zo.toString().c_str();
         }
 #endif
+        // Same as gmtime
+#ifdef GOBLIB_DATETIME_USE_TIME_T_GREATER_THAN_32BIT
+        constexpr time_t last = 4133244153; // 2100-12-23
+#else
+        constexpr time_t last = 2147483647 - 86400;
+#endif
+        for(const int32_t off : { 0, 59400, -28800, 50400, -43200, 19800 })
+        {
+            for(time_t e = 43200; e < last; e += 7919 * 3607)
+            {
+                time_t t = e + off;
+                struct tm tmp{};
+                toGmtime(&t, &tmp);
+                ASSERT_EQ(LocalDateTime(tmp), LocalDateTime::ofEpochSecond(e, ZoneOffset(off))) << e << " : " << off;
+            }
+        }
     }
     // parse
     {
@@ -325,3 +341,21 @@ TEST(LocalDateTime, Compare)
         ++idx;
     }
 }
+
+TEST(LocalDateTime, TruncatedTo)
+{
+    LocalDateTime ldt(2022, 12, 15, 13, 34, 56); // Thu
+    EXPECT_EQ(LocalDateTime(2022, 12, 15, 13, 34, 56), ldt.truncatedTo(ChronoUnit::Seconds));
+    EXPECT_EQ(LocalDateTime(2022, 12, 15, 13, 34,  0), ldt.truncatedTo(ChronoUnit::Minutes));
+    EXPECT_EQ(LocalDateTime(2022, 12, 15, 13,  0,  0), ldt.truncatedTo(ChronoUnit::Hours));
+    EXPECT_EQ(LocalDateTime(2022, 12, 15, 12,  0,  0), ldt.truncatedTo(ChronoUnit::HalfDays));
+    EXPECT_EQ(LocalDateTime(2022, 12, 15,  0,  0,  0), ldt.truncatedTo(ChronoUnit::Days));
+    EXPECT_EQ(LocalDateTime(2022, 12, 12,  0,  0,  0), ldt.truncatedTo(ChronoUnit::Weeks));
+    EXPECT_EQ(LocalDateTime(2022, 12,  1,  0,  0,  0), ldt.truncatedTo(ChronoUnit::Months));
+    EXPECT_EQ(LocalDateTime(2022,  1,  1,  0,  0,  0), ldt.truncatedTo(ChronoUnit::Years));
+
+    // Weeks across month and year
+    EXPECT_EQ(LocalDateTime(2022, 12, 26, 0, 0, 0), LocalDateTime(2023, 1, 1, 23, 59, 59).truncatedTo(ChronoUnit::Weeks)); // Sun
+    EXPECT_EQ(LocalDateTime(2023, 1, 2, 0, 0, 0), LocalDateTime(2023, 1, 2, 0, 0, 0).truncatedTo(ChronoUnit::Weeks)); // Mon
+    EXPECT_EQ(LocalDateTime(2024, 2, 26, 0, 0, 0), LocalDateTime(2024, 3, 2, 1, 2, 3).truncatedTo(ChronoUnit::Weeks));
+}
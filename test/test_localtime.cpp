@@ -274,3 +274,15 @@ TEST(LocalTime, Arithmetic)
         EXPECT_EQ(lt2, LocalTime::MAX);
     }
 }
+
+TEST(LocalTime, TruncatedTo)
+{
+    LocalTime lt(13, 34, 56);
+    EXPECT_EQ(LocalTime(13, 34, 56), lt.truncatedTo(ChronoUnit::Seconds));
+    EXPECT_EQ(LocalTime(13, 34,  0), lt.truncatedTo(ChronoUnit::Minutes));
+    EXPECT_EQ(LocalTime(13,  0,  0), lt.truncatedTo(ChronoUnit::Hours));
+    EXPECT_EQ(LocalTime(12,  0,  0), lt.truncatedTo(ChronoUnit::HalfDays));
+    EXPECT_EQ(LocalTime( 0,  0,  0), LocalTime(11, 59, 59).truncatedTo(ChronoUnit::HalfDays));
+    EXPECT_EQ(LocalTime( 0,  0,  0), lt.truncatedTo(ChronoUnit::Days));
+    EXPECT_EQ(LocalTime( 0,  0,  0), lt.truncatedTo(ChronoUnit::Months));
+}
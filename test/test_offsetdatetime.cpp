@@ -364,3 +364,13 @@ TEST(OffsetDateTime, StaticMethods)
     }
 }
 
+
+TEST(OffsetDateTime, TruncatedTo)
+{
+    auto odt = OffsetDateTime::of(2022, 12, 15, 13, 34, 56, ZoneOffset::of(9));
+    EXPECT_STREQ("2022-12-15T13:00:00+09:00", odt.truncatedTo(ChronoUnit::Hours).toString().c_str());
+    EXPECT_STREQ("2022-12-15T00:00:00+09:00", odt.truncatedTo(ChronoUnit::Days).toString().c_str());
+    EXPECT_STREQ("2022-12-12T00:00:00+09:00", odt.truncatedTo(ChronoUnit::Weeks).toString().c_str());
+    EXPECT_STREQ("2022-12-01T00:00:00+09:00", odt.truncatedTo(ChronoUnit::Months).toString().c_str());
+    EXPECT_EQ(odt.offset(), odt.truncatedTo(ChronoUnit::Years).offset());
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <gob_parallel.hpp>
+#include <gob_rfc3339.hpp>
+#include "helper.hpp"
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+
+using namespace goblib::datetime;
+
+namespace
+{
+std::vector<time_t> makeEpochs(const size_t n)
+{
+    std::vector<time_t> v(n);
+    for(size_t i = 0; i < n; ++i) { v[i] = 86400 + static_cast<time_t>(i) * 7919 * 13; }
+    return v;
+}
+}
+
+TEST(Parallel, ThreadPool)
+{
+    for(size_t threads : { 1, 2, 4, 7 })
+    {
+        ThreadPool pool(threads);
+        EXPECT_EQ(threads, pool.size());
+        for(size_t tasks : { 0, 1, 3, 100, 1000 })
+        {
+            std::vector<int> hits(tasks);
+            pool.run(tasks, [&](const size_t i) { ++hits[i]; });
+            for(size_t i = 0; i < tasks; ++i) { ASSERT_EQ(1, hits[i]) << threads << ':' << tasks << ':' << i; }
+        }
+    }
+    EXPECT_GE(ThreadPool::shared().size(), 1U);
+
+    // Chunks
+    {
+        ThreadPool pool(4);
+        for(size_t n : { 0, 1, 2047, 2048, 2049, 10000, 100003 })
+        {
+            for(size_t shift = 0; shift < 3; ++shift)
+            {
+                std::vector<LocalDateTime> buf(n + shift);
+                std::vector<int> hits(n);
+                parallelChunks(buf.data() + shift, n, [&](const size_t b, const size_t e)
+                {
+                    for(size_t i = b; i < e; ++i) { ++hits[i]; }
+                }, pool);
+                for(size_t i = 0; i < n; ++i) { ASSERT_EQ(1, hits[i]) << n << ':' << shift << ':' << i; }
+            }
+        }
+    }
+
+    // Records (Chunks start on the cache line even if the stride is odd)
+    {
+        ThreadPool pool(4);
+        constexpr size_t stride = 33;
+        for(size_t n : { 0, 1, 2048, 2049, 10000, 100003 })
+        {
+            std::vector<char> buf(n * stride + CACHE_LINE_SIZE);
+            const char* out = buf.data() + (CACHE_LINE_SIZE - reinterpret_cast<uintptr_t>(buf.data()) % CACHE_LINE_SIZE) + 1;
+            std::vector<int> hits(n), begins(n);
+            parallelRecords(out, stride, n, [&](const size_t b, const size_t e)
+            {
+                if(b < e) { ++begins[b]; }
+                for(size_t i = b; i < e; ++i) { ++hits[i]; }
+            }, pool);
+            for(size_t i = 0; i < n; ++i)
+            {
+                ASSERT_EQ(1, hits[i]) << n << ':' << i;
+                if(i && begins[i]) { ASSERT_EQ(0U, reinterpret_cast<uintptr_t>(out + i * stride) % CACHE_LINE_SIZE) << n << ':' << i; }
+            }
+        }
+    }
+}
+
+TEST(Parallel, Conversion)
+{
+    ThreadPool pool(4);
+    for(size_t n : { 0, 1, 5000, 100003 })
+    {
+        auto epochs = makeEpochs(n);
+        const auto zo = ZoneOffset::of(9, 30);
+
+        std::vector<LocalDateTime> ldts(n);
+        parallelOfEpochSeconds(ldts.data(), epochs.data(), n, zo, pool);
+        std::vector<OffsetDateTime> odts(n);
+        for(size_t i = 0; i < n; ++i)
+        {
+            ASSERT_EQ(LocalDateTime::ofEpochSecond(epochs[i], zo), ldts[i]) << i;
+            odts[i] = OffsetDateTime(ldts[i], zo);
+        }
+
+        std::vector<time_t> back(n);
+        parallelToEpochSeconds(back.data(), odts.data(), n, pool);
+        EXPECT_EQ(epochs, back);
+
+        std::vector<OffsetDateTime> rezoned(n);
+        parallelWithOffsetSameEpoch(rezoned.data(), odts.data(), n, ZoneOffset::of(-5), pool);
+        for(size_t i = 0; i < n; ++i) { ASSERT_EQ(odts[i].withOffsetSameEpoch(ZoneOffset::of(-5)), rezoned[i]) << i; }
+        // In place
+        parallelWithOffsetSameEpoch(odts.data(), odts.data(), n, ZoneOffset::of(-5), pool);
+        for(size_t i = 0; i < n; ++i)
+        {
+            ASSERT_EQ(rezoned[i].toLocalDateTime(), odts[i].toLocalDateTime()) << i;
+            ASSERT_EQ(ZoneOffset::of(-5), odts[i].offset()) << i;
+        }
+    }
+}
+
+TEST(Parallel, FormatParse)
+{
+    ThreadPool pool(3);
+    for(size_t n : { 0, 1, 300, 20011 })
+    {
+        auto epochs = makeEpochs(n);
+        std::vector<OffsetDateTime> odts(n);
+        for(size_t i = 0; i < n; ++i) { odts[i] = OffsetDateTime(LocalDateTime::ofEpochSecond(epochs[i], ZoneOffset::of(9)), ZoneOffset::of(9)); }
+        if(n > 1) { odts[1] = OffsetDateTime(LocalDateTime(12345, 1, 1, 0, 0, 0), ZoneOffset::UTC); } // Can not format
+
+        constexpr size_t stride = RFC3339_BUFFER_SIZE;
+        std::vector<char> buf(n * stride, 'x');
+        EXPECT_EQ(n > 1 ? n - 1 : n, parallelFormatRFC3339(buf.data(), stride, odts.data(), n, pool));
+
+        std::vector<const char*> strs(n);
+        char expected[RFC3339_BUFFER_SIZE];
+        for(size_t i = 0; i < n; ++i)
+        {
+            strs[i] = buf.data() + i * stride;
+            if(!formatRFC3339(expected, sizeof(expected), odts[i])) { expected[0] = '\0'; }
+            ASSERT_STREQ(expected, strs[i]) << i;
+        }
+
+        std::vector<OffsetDateTime> parsed(n);
+        EXPECT_EQ(n > 1 ? n - 1 : n, parallelParseRFC3339(parsed.data(), strs.data(), n, pool));
+        for(size_t i = 0; i < n; ++i)
+        {
+            if(i == 1) { EXPECT_FALSE(parsed[i].valid()); continue; }
+            ASSERT_EQ(odts[i], parsed[i]) << i;
+        }
+    }
+    // Narrow stride
+    {
+        OffsetDateTime odt(LocalDateTime(2022, 12, 13, 12, 34, 56), ZoneOffset::of(9));
+        char buf[2 * 26];
+        OffsetDateTime odts[2] = { odt, odt };
+        EXPECT_EQ(2U, parallelFormatRFC3339(buf, 26, odts, 2, pool));
+        EXPECT_STREQ("2022-12-13T12:34:56+09:00", buf + 26);
+        EXPECT_EQ(0U, parallelFormatRFC3339(buf, 25, odts, 2, pool));
+        EXPECT_STREQ("", buf + 25);
+    }
+    // Odd stride
+    {
+        constexpr size_t n = 30011;
+        constexpr size_t stride = RFC3339_BUFFER_SIZE + 1;
+        auto epochs = makeEpochs(n);
+        std::vector<OffsetDateTime> odts(n);
+        for(size_t i = 0; i < n; ++i) { odts[i] = OffsetDateTime(LocalDateTime::ofEpochSecond(epochs[i], ZoneOffset::of(-3)), ZoneOffset::of(-3)); }
+        std::vector<char> buf(n * stride + 1, 'x');
+        EXPECT_EQ(n, parallelFormatRFC3339(buf.data() + 1, stride, odts.data(), n, pool));
+        EXPECT_EQ('x', buf[0]);
+        char expected[RFC3339_BUFFER_SIZE];
+        for(size_t i = 0; i < n; ++i)
+        {
+            formatRFC3339(expected, sizeof(expected), odts[i]);
+            ASSERT_STREQ(expected, buf.data() + 1 + i * stride) << i;
+        }
+    }
+    // n * stride overflows
+    {
+        OffsetDateTime odts[2] = { OffsetDateTime(LocalDateTime(2022, 12, 13, 12, 34, 56), ZoneOffset::UTC), OffsetDateTime() };
+        char buf[RFC3339_BUFFER_SIZE] = "x";
+        EXPECT_EQ(0U, parallelFormatRFC3339(buf, SIZE_MAX / 2 + 1, odts, 2, pool));
+        EXPECT_EQ(0U, parallelFormatRFC3339(buf, SIZE_MAX, odts, 2, pool));
+        EXPECT_STREQ("x", buf);
+    }
+}
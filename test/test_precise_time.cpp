@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <gob_precise_time.hpp>
+#include "helper.hpp"
+
+using namespace goblib::datetime;
+
+TEST(PreciseTime, Size)
+{
+    static_assert(sizeof(LocalTimeMillis) == sizeof(LocalTime), "");
+    static_assert(sizeof(LocalDateTimeMillis) == sizeof(LocalDateTime), "");
+    static_assert(sizeof(LocalTimeMicros) == 8, "");
+    static_assert(sizeof(LocalTimeNanos) == 8, "");
+    static_assert(sizeof(PreciseLocalTime<SecondPrecision>) == sizeof(LocalTime), "");
+}
+
+TEST(PreciseTime, LocalTime)
+{
+    {
+        constexpr LocalTimeMillis lt(12, 34, 56, 789);
+        static_assert(lt.valid(), "");
+        static_assert(lt.hour() == 12 && lt.minute() == 34 && lt.second() == 56 && lt.fraction() == 789, "");
+        static_assert(lt.nano() == 789000000U, "");
+        static_assert(lt.toSecondOfDay() == 45296, "");
+        static_assert(lt.toNanoOfDay() == 45296789000000LL, "");
+        EXPECT_EQ(LocalTime(12, 34, 56), lt.toLocalTime());
+        EXPECT_STREQ("12:34:56.789", lt.toString().c_str());
+        EXPECT_EQ(lt, LocalTimeMillis::ofNanoOfDay(45296789999999LL));
+        EXPECT_EQ(LocalTimeMillis(12, 34, 56), LocalTimeMillis::ofSecondOfDay(45296));
+        EXPECT_EQ(LocalTimeMillis(LocalTime(12, 34, 56), 789), lt);
+    }
+    {
+        constexpr LocalTimeNanos lt(23, 59, 59, 999999999);
+        static_assert(lt.valid(), "");
+        static_assert(lt.toNanoOfDay() == 86399999999999LL, "");
+        EXPECT_STREQ("23:59:59.999999999", lt.toString().c_str());
+        EXPECT_STREQ("00:00:00.000001", LocalTimeMicros(0, 0, 0, 1).toString().c_str());
+        EXPECT_STREQ("01:02:03", PreciseLocalTime<SecondPrecision>(1, 2, 3).toString().c_str());
+    }
+    // Invalid
+    {
+        EXPECT_FALSE(LocalTimeMillis(24, 0, 0).valid());
+        EXPECT_FALSE(LocalTimeMillis(-1, 0, 0).valid());
+        EXPECT_FALSE(LocalTimeMillis(0, 60, 0).valid());
+        EXPECT_FALSE(LocalTimeMillis(0, 0, 60).valid());
+        EXPECT_FALSE(LocalTimeMillis(0, 0, 0, 1000).valid());
+        EXPECT_FALSE(LocalTimeMicros::ofNanoOfDay(-1).valid());
+        EXPECT_FALSE(LocalTimeMicros::ofNanoOfDay(86400000000000LL).valid());
+        EXPECT_TRUE(LocalTimeMicros::ofNanoOfDay(86399999999999LL).valid());
+        char buf[32];
+        EXPECT_EQ(0U, LocalTimeMillis(24, 0, 0).toChars(buf, sizeof(buf)));
+        EXPECT_EQ(0U, LocalTimeMillis(1, 0, 0).toChars(buf, 12));
+        EXPECT_EQ(12U, LocalTimeMillis(1, 0, 0).toChars(buf, 13));
+    }
+    // Compare
+    {
+        EXPECT_LT(LocalTimeMillis(12, 0, 0, 1), LocalTimeMillis(12, 0, 0, 2));
+        EXPECT_GT(LocalTimeMillis(12, 0, 1, 0), LocalTimeMillis(12, 0, 0, 999));
+        EXPECT_NE(LocalTimeMillis(12, 0, 1, 0), LocalTimeMillis(12, 0, 1, 1));
+    }
+}
+
+TEST(PreciseTime, Parse)
+{
+    struct { const char* s; uint32_t nanos; } tbl[] =
+    {
+        { "12:34:56", 0 },
+        { "12:34:56.5", 500000000 },
+        { "12:34:56,25", 250000000 },
+        { "12:34:56.123", 123000000 },
+        { "12:34:56.123456", 123456000 },
+        { "12:34:56.123456789", 123456789 },
+        { "12:34:56.1234567891234", 123456789 },
+    };
+    for(auto& e : tbl)
+    {
+        auto ms = LocalTimeMillis::parse(e.s);
+        auto us = LocalTimeMicros::parse(e.s);
+        auto ns = LocalTimeNanos::parse(e.s);
+        EXPECT_TRUE(ms.valid()) << e.s;
+        EXPECT_EQ(45296, ms.toSecondOfDay()) << e.s;
+        EXPECT_EQ(e.nanos / 1000000, ms.fraction()) << e.s;
+        EXPECT_EQ(e.nanos / 1000, us.fraction()) << e.s;
+        EXPECT_EQ(e.nanos, ns.fraction()) << e.s;
+        EXPECT_EQ(e.nanos, ns.nano()) << e.s;
+    }
+    {
+        const char* end{};
+        auto lt = LocalTimeMillis::parse("01:02:03.004Z", &end);
+        EXPECT_EQ(LocalTimeMillis(1, 2, 3, 4), lt);
+        EXPECT_STREQ("Z", end);
+    }
+    const char* ng[] = { "", "1:02:03", "01:02", "01:02:03.", "01-02-03", "24:00:00", "23:60:00", "aa:bb:cc" };
+    for(auto& e : ng) { EXPECT_FALSE(LocalTimeMillis::parse(e).valid()) << e; }
+    EXPECT_FALSE(LocalTimeMillis::parse(nullptr).valid());
+
+    // Round trip
+    for(int64_t nod = 0; nod < 86400000000000LL; nod += 7777777777LL)
+    {
+        auto lt = LocalTimeNanos::ofNanoOfDay(nod);
+        ASSERT_EQ(lt, LocalTimeNanos::parse(lt.toString().c_str())) << nod;
+        auto lt2 = LocalTimeMicros::ofNanoOfDay(nod);
+        ASSERT_EQ(lt2, LocalTimeMicros::parse(lt2.toString().c_str())) << nod;
+    }
+}
+
+TEST(PreciseTime, LocalDateTime)
+{
+    {
+        constexpr LocalDateTimeMicros ldt(2022, 12, 13, 12, 34, 56, 123456);
+        static_assert(ldt.valid(), "");
+        static_assert(ldt.fraction() == 123456 && ldt.nano() == 123456000, "");
+        EXPECT_EQ(LocalDateTime(2022, 12, 13, 12, 34, 56), ldt.toLocalDateTime());
+        EXPECT_STREQ("2022-12-13T12:34:56.123456", ldt.toString().c_str());
+        EXPECT_EQ(ldt, LocalDateTimeMicros::parse("2022-12-13T12:34:56.123456"));
+        EXPECT_EQ(ldt, LocalDateTimeMicros::parse("2022-12-13T12:34:56.1234569"));
+        EXPECT_EQ(LocalDateTime(2022, 12, 13, 12, 34, 56).toEpochSecond(ZoneOffset::of(9)), ldt.toEpochSecond(ZoneOffset::of(9)));
+        EXPECT_EQ(ldt, LocalDateTimeMicros::ofEpochSecond(ldt.toEpochSecond(ZoneOffset::of(9)), 123456, ZoneOffset::of(9)));
+        EXPECT_EQ(LocalDateTimeMicros(LocalDateTime(2022, 12, 13, 12, 34, 56), 123456), ldt);
+    }
+    {
+        const char* end{};
+        auto ldt = LocalDateTimeMillis::parse("2022-12-13T12:34:56.5+09:00", &end);
+        EXPECT_TRUE(ldt.valid());
+        EXPECT_EQ(500U, ldt.fraction());
+        EXPECT_STREQ("+09:00", end);
+    }
+    // Compare
+    {
+        LocalDateTimeMillis a(2022, 12, 13, 12, 34, 56, 1);
+        LocalDateTimeMillis b(2022, 12, 13, 12, 34, 56, 2);
+        LocalDateTimeMillis c(2022, 12, 14, 0, 0, 0, 0);
+        EXPECT_LT(a, b);
+        EXPECT_LT(b, c);
+        EXPECT_GE(c, a);
+        EXPECT_EQ(a, LocalDateTimeMillis(2022, 12, 13, 12, 34, 56, 1));
+    }
+    // Invalid
+    {
+        const char* ng[] = { "", "2022-12-13", "2022-12-13 12:34:56", "2022-13-13T12:34:56", "2022-02-29T12:34:56", "2022-12-13T25:00:00" };
+        for(auto& e : ng) { EXPECT_FALSE(LocalDateTimeMillis::parse(e).valid()) << e; }
+        char buf[40];
+        EXPECT_EQ(0U, LocalDateTimeMillis(2022, 2, 29, 0, 0, 0).toChars(buf, sizeof(buf)));
+        EXPECT_EQ(0U, LocalDateTimeMillis(2022, 2, 28, 0, 0, 0).toChars(buf, 23));
+        EXPECT_EQ(23U, LocalDateTimeMillis(2022, 2, 28, 0, 0, 0).toChars(buf, 24));
+    }
+}
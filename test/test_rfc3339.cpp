@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <gob_rfc3339.hpp>
+#include "helper.hpp"
+#include <cstring>
+
+using namespace goblib::datetime;
+
+TEST(RFC3339, Format)
+{
+    char buf[RFC3339_BUFFER_SIZE];
+    auto odt = OffsetDateTime::of(2022, 12, 3, 4, 5, 6, ZoneOffset::of(9));
+    EXPECT_EQ(25U, formatRFC3339(buf, sizeof(buf), odt));
+    EXPECT_STREQ("2022-12-03T04:05:06+09:00", buf);
+    EXPECT_STREQ(odt.toString().c_str(), buf);
+
+    struct { uint32_t nanos; int precision; const char* s; } tbl[] =
+    {
+        { 123456789, 1, "2022-12-03T04:05:06.1+09:00" },
+        { 123456789, 3, "2022-12-03T04:05:06.123+09:00" },
+        { 123456789, 6, "2022-12-03T04:05:06.123456+09:00" },
+        { 123456789, 9, "2022-12-03T04:05:06.123456789+09:00" },
+        {   1000000, 3, "2022-12-03T04:05:06.001+09:00" },
+        {         0, 6, "2022-12-03T04:05:06.000000+09:00" },
+        { 999999999, 3, "2022-12-03T04:05:06.999+09:00" }, // truncated
+    };
+    for(auto& e : tbl)
+    {
+        EXPECT_EQ(strlen(e.s), formatRFC3339(buf, sizeof(buf), odt, e.nanos, e.precision));
+        EXPECT_STREQ(e.s, buf);
+    }
+
+    // UTC and negative offset
+    formatRFC3339(buf, sizeof(buf), OffsetDateTime::of(1970, 1, 1, 0, 0, 0, ZoneOffset::UTC), 5000000, 3);
+    EXPECT_STREQ("1970-01-01T00:00:00.005Z", buf);
+    formatRFC3339(buf, sizeof(buf), OffsetDateTime::of(2022, 12, 31, 23, 59, 60, ZoneOffset::of(-9, -30)));
+    EXPECT_STREQ("2022-12-31T23:59:60-09:30", buf);
+
+    // Failures
+    EXPECT_EQ(0U, formatRFC3339(buf, 25, odt)); // No room for the terminator
+    EXPECT_EQ(25U, formatRFC3339(buf, 26, odt));
+    EXPECT_EQ(0U, formatRFC3339(buf, sizeof(buf), odt, 0, 10));
+    EXPECT_EQ(0U, formatRFC3339(buf, sizeof(buf), odt, 1000000000, 3));
+    EXPECT_EQ(0U, formatRFC3339(buf, sizeof(buf), OffsetDateTime::of(2022, 1, 1, 0, 0, 0, ZoneOffset::of(1, 2, 3))));
+    EXPECT_EQ(0U, formatRFC3339(buf, sizeof(buf), OffsetDateTime::of(10000, 1, 1, 0, 0, 0, ZoneOffset::UTC)));
+    EXPECT_EQ(0U, formatRFC3339(nullptr, 100, odt));
+}
+
+TEST(RFC3339, Parse)
+{
+    {
+        uint32_t nanos{1};
+        const char* end{};
+        auto odt = parseRFC3339("2022-12-03T04:05:06+09:00", &nanos, &end);
+        EXPECT_TRUE(odt.valid());
+        EXPECT_STREQ("2022-12-03T04:05:06+09:00", odt.toString().c_str());
+        EXPECT_EQ(0U, nanos);
+        EXPECT_EQ('\0', *end);
+    }
+    struct { const char* s; const char* odt; uint32_t nanos; } tbl[] =
+    {
+        { "2022-12-03T04:05:06.1Z",               "2022-12-03T04:05:06Z",      100000000 },
+        { "2022-12-03t04:05:06.123z",             "2022-12-03T04:05:06Z",      123000000 },
+        { "2022-12-03 04:05:06.123456-07:00",     "2022-12-03T04:05:06-07:00", 123456000 },
+        { "2022-12-03T04:05:06.123456789+05:30",  "2022-12-03T04:05:06+05:30", 123456789 },
+        { "2022-12-03T04:05:06.1234567891234Z",   "2022-12-03T04:05:06Z",      123456789 },
+        { "2016-12-31T23:59:60Z",                 "2016-12-31T23:59:60Z",      0 },
+        { "2024-02-29T00:00:00-00:00",            "2024-02-29T00:00:00Z",      0 },
+    };
+    for(auto& e : tbl)
+    {
+        uint32_t nanos{};
+        auto odt = parseRFC3339(e.s, &nanos);
+        EXPECT_TRUE(odt.valid()) << e.s;
+        EXPECT_STREQ(e.odt, odt.toString().c_str()) << e.s;
+        EXPECT_EQ(e.nanos, nanos) << e.s;
+    }
+
+    const char* invalids[] =
+    {
+        "", "2022-12-03", "2022-12-03T04:05:06", "2022-12-03T04:05Z", "2022-12-03X04:05:06Z", "2022-13-03T04:05:06Z",
+        "2023-02-29T04:05:06Z", "2022-12-03T24:05:06Z", "2022-12-03T04:60:06Z", "2022-12-03T04:05:61Z", "2022-12-03T04:05:06.Z",
+        "2022-12-03T04:05:06+0900", "2022-12-03T04:05:06+24:00", "22-12-03T04:05:06Z", "2022-12-3T04:05:06Z",
+    };
+    for(auto& e : invalids) { EXPECT_FALSE(parseRFC3339(e).valid()) << e; }
+    EXPECT_FALSE(parseRFC3339(nullptr).valid());
+
+    // Round trip
+    char buf[RFC3339_BUFFER_SIZE];
+    for(time_t t = 86400; t < 4102444800LL; t += 86400 * 37 + 3671)
+    {
+        const int hh = (int)(t % 27) - 12;
+        auto zo = ZoneOffset::of(hh, (t % 2) ? (hh < 0 ? -30 : 30) : 0);
+        auto odt = OffsetDateTime(LocalDateTime::ofEpochSecond(t, zo), zo);
+        ASSERT_NE(0U, formatRFC3339(buf, sizeof(buf), odt, (uint32_t)(t % 1000000000), 9));
+        uint32_t nanos{};
+        auto p = parseRFC3339(buf, &nanos);
+        EXPECT_EQ(odt.toString(), p.toString()) << buf;
+        EXPECT_EQ((uint32_t)(t % 1000000000), nanos) << buf;
+    }
+}
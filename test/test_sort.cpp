@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <gob_sort.hpp>
+#include "helper.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace goblib::datetime;
+
+namespace
+{
+std::vector<OffsetDateTime> makeOffsetDateTimes(const size_t n, const uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int64_t> epoch(0, 4102444800LL); // 1970 - 2100
+    std::uniform_int_distribution<int> hour(-12, 14);
+    std::vector<OffsetDateTime> v;
+    for(size_t i = 0; i < n; ++i)
+    {
+        auto zo = ZoneOffset::of(hour(rng));
+        v.push_back(OffsetDateTime(LocalDateTime::ofEpochSecond(epoch(rng), zo), zo));
+    }
+    return v;
+}
+//
+}
+
+TEST(Sort, LocalDate)
+{
+    for(size_t n : { 0, 1, 2, 100, 5000 })
+    {
+        std::mt19937 rng(n);
+        std::uniform_int_distribution<int32_t> ed(0, 200000);
+        std::vector<LocalDate> v;
+        for(size_t i = 0; i < n; ++i) { v.push_back(LocalDate::ofEpochDay(ed(rng))); }
+        auto expected = v;
+        std::sort(expected.begin(), expected.end());
+        auto v2 = v;
+        sort(v.data(), v.data() + v.size());
+        stableSort(v2.data(), v2.data() + v2.size());
+        EXPECT_EQ(expected, v) << n;
+        EXPECT_EQ(expected, v2) << n;
+    }
+}
+
+TEST(Sort, LocalDateTime)
+{
+    for(size_t n : { 3, 255, 256, 10000 })
+    {
+        std::mt19937 rng(n);
+        std::uniform_int_distribution<int64_t> epoch(0, 4102444800LL);
+        std::vector<LocalDateTime> v;
+        for(size_t i = 0; i < n; ++i) { v.push_back(LocalDateTime::ofEpochSecond(epoch(rng), ZoneOffset::UTC)); }
+        auto expected = v;
+        std::sort(expected.begin(), expected.end());
+        sort(v.data(), v.data() + v.size());
+        EXPECT_EQ(expected, v) << n;
+    }
+}
+
+TEST(Sort, OffsetDateTime)
+{
+    for(size_t n : { 10, 10000 })
+    {
+        auto v = makeOffsetDateTimes(n, n);
+        // Same instants with different offsets
+        for(size_t i = 0; i + 1 < n; i += 7) { v[i + 1] = v[i].withOffsetSameEpoch(ZoneOffset::of(3)); }
+
+        auto expected = v;
+        std::stable_sort(expected.begin(), expected.end());
+        auto v2 = v;
+        stableSort(v.data(), v.data() + v.size());
+        ASSERT_EQ(expected.size(), v.size());
+        for(size_t i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(expected[i].toString(), v[i].toString()) << i; // Including the offset
+        }
+        sort(v2.data(), v2.data() + v2.size());
+        EXPECT_TRUE(std::is_sorted(v2.begin(), v2.end()));
+    }
+}
+
+TEST(Sort, MergeSorted)
+{
+    auto a = makeOffsetDateTimes(1000, 1);
+    auto b = makeOffsetDateTimes(700, 2);
+    b[10] = a[20].withOffsetSameEpoch(ZoneOffset::of(1)); // Same instant
+    stableSort(a.data(), a.data() + a.size());
+    stableSort(b.data(), b.data() + b.size());
+
+    std::vector<OffsetDateTime> expected(a.size() + b.size()), out(a.size() + b.size());
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin());
+    mergeSorted(a.data(), a.size(), b.data(), b.size(), out.data());
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        EXPECT_EQ(expected[i].toString(), out[i].toString()) << i;
+    }
+
+    std::vector<LocalDate> da = { {2020, 1, 1}, {2021, 1, 1} }, db = { {2020, 6, 1} }, dout(3);
+    mergeSorted(da.data(), da.size(), db.data(), db.size(), dout.data());
+    EXPECT_EQ(LocalDate(2020, 6, 1), dout[1]);
+    mergeSorted(da.data(), 0, db.data(), db.size(), dout.data());
+    EXPECT_EQ(LocalDate(2020, 6, 1), dout[0]);
+}
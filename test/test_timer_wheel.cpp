@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <gob_timer_wheel.hpp>
+#include "helper.hpp"
+#include <vector>
+#include <map>
+#include <random>
+#include <utility>
+#include <algorithm>
+
+using namespace goblib::datetime;
+
+TEST(TimerWheel, Basic)
+{
+    const time_t start = OffsetDateTime::parse("2023-01-01T00:00:00Z").toEpochSecond();
+    TimerWheel<int> wheel(start);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(start, wheel.now());
+    EXPECT_EQ(-1, wheel.nextDue());
+
+    std::vector<std::pair<int, time_t>> log;
+    auto rec = [&](int& v, const time_t due) { log.emplace_back(v, due); };
+
+    auto h1 = wheel.schedule(OffsetDateTime::parse("2023-01-01T09:00:10+09:00"), 1); // start + 10
+    auto h2 = wheel.schedule(start + 5, 2);
+    auto h3 = wheel.schedule(start + 5, 3);
+    auto h4 = wheel.schedule(start + 86400 * 400, 4);
+    auto h5 = wheel.schedule(start - 100, 5); // Already passed
+    EXPECT_EQ(5U, wheel.size());
+    EXPECT_EQ(start, wheel.nextDue());
+    EXPECT_TRUE(wheel.contains(h3));
+
+    EXPECT_EQ(1U, wheel.advance(start, rec));
+    EXPECT_FALSE(wheel.contains(h5));
+    EXPECT_EQ(start + 5, wheel.nextDue());
+
+    EXPECT_TRUE(wheel.cancel(h3));
+    EXPECT_FALSE(wheel.cancel(h3));
+    EXPECT_EQ(1U, wheel.advance(start + 9, rec));
+    EXPECT_EQ(start + 9, wheel.now());
+    EXPECT_EQ(1U, wheel.advance(start + 10, rec));
+    EXPECT_FALSE(wheel.contains(h1));
+    EXPECT_FALSE(wheel.contains(h2));
+    EXPECT_EQ(start + 86400 * 400, wheel.nextDue());
+
+    // Backward does not go back
+    EXPECT_EQ(0U, wheel.advance(start, rec));
+    EXPECT_EQ(start + 10, wheel.now());
+
+    EXPECT_EQ(1U, wheel.advance(start + 86400 * 1000, rec));
+    EXPECT_FALSE(wheel.contains(h4));
+    EXPECT_TRUE(wheel.empty());
+
+    std::vector<std::pair<int, time_t>> expected = { {5, start - 100}, {2, start + 5}, {1, start + 10}, {4, start + 86400 * 400} };
+    EXPECT_EQ(expected, log);
+
+    // Handle is not reused
+    auto h6 = wheel.schedule(start, 6);
+    EXPECT_EQ(h4.index, h6.index);
+    EXPECT_FALSE(wheel.contains(h4));
+    EXPECT_FALSE(wheel.cancel(h4));
+    EXPECT_TRUE(wheel.contains(h6));
+    EXPECT_FALSE(wheel.contains(TimerWheel<int>::Handle()));
+}
+
+TEST(TimerWheel, Zone)
+{
+    auto ny = ZoneRules::ofLocation("America/New_York");
+    TimerWheel<int> wheel(OffsetDateTime::parse("2023-03-11T00:00:00Z").toEpochSecond());
+    wheel.schedule(LocalDateTime(2023, 3, 12, 2, 30, 0), ny, 1); // Gap
+    wheel.schedule(LocalDateTime(2023, 3, 12, 1, 30, 0), ny, 2);
+    std::vector<time_t> dues;
+    wheel.advance(OffsetDateTime::parse("2023-03-13T00:00:00Z").toEpochSecond(), [&](int&, const time_t due) { dues.push_back(due); });
+    ASSERT_EQ(2U, dues.size());
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T01:30:00-05:00").toEpochSecond(), dues[0]);
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T03:30:00-04:00").toEpochSecond(), dues[1]);
+}
+
+TEST(TimerWheel, Callback)
+{
+    TimerWheel<int> wheel(1000);
+    std::vector<int> log;
+    TimerWheel<int>::Handle victim;
+    wheel.schedule(1001, 1);
+    victim = wheel.schedule(1001, 2);
+    wheel.schedule(1003, 3);
+    wheel.advance(1010, [&](int& v, const time_t due)
+    {
+        log.push_back(v);
+        if(v == 1)
+        {
+            EXPECT_TRUE(wheel.cancel(victim));    // Cancel the one in the same slot
+            wheel.schedule(due + 1, 10);          // Fired in this advance
+            wheel.schedule(due, 11);              // Expired, next advance
+        }
+    });
+    EXPECT_EQ(std::vector<int>({ 1, 10, 3 }), log);
+    EXPECT_EQ(1U, wheel.size());
+    wheel.advance(1010, [&](int& v, const time_t) { log.push_back(v); });
+    EXPECT_EQ(std::vector<int>({ 1, 10, 3, 11 }), log);
+
+    // Expired ones scheduled by the callback fire in the order of the epoch
+    log.clear();
+    wheel.schedule(1011, 1);
+    wheel.advance(1020, [&](int& v, const time_t due)
+    {
+        log.push_back(v);
+        if(v == 1)
+        {
+            wheel.schedule(due - 1, 12);
+            wheel.schedule(due - 5, 13);
+            wheel.schedule(due - 1, 14);
+        }
+    });
+    wheel.advance(1020, [&](int& v, const time_t) { log.push_back(v); });
+    EXPECT_EQ(std::vector<int>({ 1, 13, 12, 14 }), log);
+}
+
+// Deadlines already passed are fired in the order of the epoch, not the order of scheduling
+TEST(TimerWheel, Expired)
+{
+    TimerWheel<int> wheel(1000);
+    std::vector<std::pair<time_t, int>> log;
+    auto h = wheel.schedule(700, 1);
+    wheel.schedule(500, 2);
+    wheel.schedule(400, 3);
+    wheel.schedule(500, 4);
+    wheel.schedule(1000, 5);
+    wheel.schedule(1500, 6);
+    wheel.schedule(300, 7);
+    wheel.schedule(800, 8);
+    EXPECT_TRUE(wheel.cancel(h));
+    EXPECT_EQ(1000, wheel.nextDue());
+    EXPECT_EQ(7U, wheel.advance(2000, [&](int& v, const time_t due) { log.emplace_back(due, v); }));
+    const std::vector<std::pair<time_t, int>> expected =
+    {
+        { 300, 7 }, { 400, 3 }, { 500, 2 }, { 500, 4 }, { 800, 8 }, { 1000, 5 }, { 1500, 6 },
+    };
+    EXPECT_EQ(expected, log);
+    EXPECT_TRUE(wheel.empty());
+}
+
+// Compare with the sorted order
+TEST(TimerWheel, Random)
+{
+    std::mt19937_64 rng(52);
+    for(int round = 0; round < 4; ++round)
+    {
+        const time_t start = (round % 2) ? -100000 : 1670000000;
+        TimerWheel<uint32_t> wheel(start);
+        std::multimap<std::pair<time_t, uint32_t>, TimerWheel<uint32_t>::Handle> ref; // (due, seq)
+        std::vector<std::pair<time_t, uint32_t>> fired, expected;
+        uint32_t seq{};
+        time_t now = start;
+        const time_t spans[] = { 300, 86400, 86400LL * 365 * 50, 1LL << 40 };
+        std::uniform_int_distribution<time_t> dist(-10, spans[round]);
+
+        for(int step = 0; step < 200; ++step)
+        {
+            for(int i = 0; i < 50; ++i)
+            {
+                const time_t due = now + dist(rng);
+                auto h = wheel.schedule(due, seq);
+                ref.emplace(std::make_pair(due, seq), h);
+                ++seq;
+            }
+            // Cancel some
+            for(int i = 0; i < 10 && !ref.empty(); ++i)
+            {
+                auto it = ref.begin();
+                std::advance(it, rng() % ref.size());
+                ASSERT_TRUE(wheel.cancel(it->second));
+                ref.erase(it);
+            }
+            ASSERT_EQ(ref.size(), wheel.size());
+            if(!ref.empty()) { ASSERT_EQ(std::max(ref.begin()->first.first, now), wheel.nextDue()) << round << ':' << step; }
+
+            now += std::uniform_int_distribution<time_t>(0, spans[round] / 40)(rng);
+            const size_t from = fired.size();
+            wheel.advance(now, [&](uint32_t& v, const time_t due) { fired.emplace_back(due, v); });
+            ASSERT_TRUE(std::is_sorted(fired.begin() + from, fired.end())) << round << ':' << step;
+            while(!ref.empty() && ref.begin()->first.first <= now)
+            {
+                expected.push_back(ref.begin()->first);
+                ref.erase(ref.begin());
+            }
+            ASSERT_EQ(expected.size(), fired.size()) << round << ':' << step;
+        }
+        // Expired ones fire at the next advance, so the whole sequence is sorted only in each advance.
+        std::sort(fired.begin(), fired.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(expected, fired);
+    }
+}
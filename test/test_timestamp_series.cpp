@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <gob_timestamp_series.hpp>
+#include "helper.hpp"
+#include <random>
+#include <vector>
+
+using namespace goblib::datetime;
+
+TEST(TimestampSeries, Regular)
+{
+    TimestampSeries ts;
+    EXPECT_TRUE(ts.empty());
+    std::vector<time_t> v;
+    for(int i = 0; i < 100000; ++i) { v.push_back(1600000000 + i * 60); ts.append(v.back(), ZoneOffset::of(9)); }
+    EXPECT_EQ(v.size(), ts.size());
+    EXPECT_FALSE(ts.empty());
+
+    // 1 bit per sample + index
+    EXPECT_LE(ts.bitsOfSamples(), v.size());
+    EXPECT_LT(ts.serializedSize() * 8.0 / v.size(), 2.0);
+
+    std::vector<time_t> d(v.size());
+    EXPECT_EQ(v.size(), ts.decode(d.data(), 0, d.size()));
+    EXPECT_EQ(v, d);
+    EXPECT_EQ(v[777], ts.epochAt(777));
+    EXPECT_STREQ("2020-09-13T21:26:40+09:00", ts.at(0).toString().c_str());
+}
+
+TEST(TimestampSeries, Irregular)
+{
+    std::mt19937 rng(52);
+    std::uniform_int_distribution<int> jitter(-3, 3);
+    std::uniform_int_distribution<int> big(0, 99);
+
+    for(size_t bs : { 1, 2, 3, 64, 512 })
+    {
+        TimestampSeries ts(bs);
+        std::vector<time_t> v;
+        std::vector<ZoneOffset> z;
+        time_t t = 1000000000;
+        for(int i = 0; i < 5000; ++i)
+        {
+            auto r = big(rng);
+            // Various delta-of-delta classes, including negative deltas.
+            t += (r < 80) ? 10 + jitter(rng) : (r < 90) ? 200 : (r < 95) ? -1500 : (r < 98) ? 100000 : -4000000000LL;
+            v.push_back(t);
+            z.push_back(ZoneOffset::of((i / 1000) - 2));
+            ts.append(t, z.back());
+        }
+        ASSERT_EQ(v.size(), ts.size());
+        std::vector<time_t> d(v.size());
+        ts.decode(d.data(), 0, d.size());
+        EXPECT_EQ(v, d) << bs;
+
+        // Random access and partial decode
+        for(size_t i = 0; i < v.size(); i += 37)
+        {
+            EXPECT_EQ(v[i], ts.epochAt(i)) << bs << ":" << i;
+            EXPECT_EQ(z[i], ts.offsetAt(i)) << bs << ":" << i;
+        }
+        std::vector<time_t> part(100);
+        EXPECT_EQ(100U, ts.decode(part.data(), 1234, 100));
+        EXPECT_TRUE(std::equal(part.begin(), part.end(), v.begin() + 1234));
+        EXPECT_EQ(10U, ts.decode(part.data(), v.size() - 10, 100));
+        EXPECT_EQ(0U, ts.decode(part.data(), v.size(), 100));
+    }
+}
+
+TEST(TimestampSeries, OffsetDateTime)
+{
+    TimestampSeries ts(16);
+    std::vector<OffsetDateTime> v;
+    for(int i = 0; i < 100; ++i)
+    {
+        auto zo = ZoneOffset::of((i / 30) * 3, 0);
+        v.push_back(OffsetDateTime(LocalDateTime::ofEpochSecond(1671000000 + i * 3600, zo), zo));
+        ts.append(v.back());
+    }
+    std::vector<OffsetDateTime> d(v.size());
+    EXPECT_EQ(v.size() - 5, ts.decode(d.data(), 5, v.size()));
+    for(size_t i = 5; i < v.size(); ++i) { EXPECT_EQ(v[i].toString(), d[i - 5].toString()) << i; }
+    EXPECT_EQ(v[31].toString(), ts.at(31).toString());
+}
+
+TEST(TimestampSeries, Serialize)
+{
+    TimestampSeries ts(8);
+    std::vector<time_t> v;
+    for(int i = 0; i < 21; ++i) { v.push_back(1671000000 + i * i * 5); ts.append(v.back(), ZoneOffset::of(i < 10 ? 1 : -1)); }
+
+    std::vector<uint8_t> bytes;
+    ts.serialize(bytes);
+    EXPECT_EQ(ts.serializedSize(), bytes.size());
+
+    auto r = TimestampSeries::deserialize(bytes.data(), bytes.size());
+    ASSERT_EQ(ts.size(), r.size());
+    EXPECT_EQ(8U, r.blockSize());
+    for(size_t i = 0; i < v.size(); ++i) { EXPECT_EQ(ts.at(i).toString(), r.at(i).toString()) << i; }
+
+    // Continue appending
+    for(int i = 21; i < 40; ++i) { v.push_back(1671000000 + i * i * 5); r.append(v.back(), ZoneOffset::of(-1)); }
+    std::vector<time_t> d(v.size());
+    r.decode(d.data(), 0, d.size());
+    EXPECT_EQ(v, d);
+
+    // Broken data
+    EXPECT_TRUE(TimestampSeries::deserialize(bytes.data(), bytes.size() - 1).empty());
+    EXPECT_TRUE(TimestampSeries::deserialize(nullptr, 0).empty());
+    // Truncated anywhere
+    for(size_t len = 0; len < bytes.size(); ++len) { EXPECT_TRUE(TimestampSeries::deserialize(bytes.data(), len).empty()) << len; }
+    // Run table: u32 blockSize, u64 size, u32 runCount, then { u64 index, i32 offset } from byte 16
+    ASSERT_EQ(2U, bytes[12]);
+    {
+        auto b = bytes;
+        b[16] = 1; // The first run does not start at 0
+        EXPECT_TRUE(TimestampSeries::deserialize(b.data(), b.size()).empty());
+    }
+    {
+        auto b = bytes;
+        b[28] = 0; // The second run index is the same as the first
+        EXPECT_TRUE(TimestampSeries::deserialize(b.data(), b.size()).empty());
+    }
+    {
+        TimestampSeries t3(8);
+        for(int i = 0; i < 20; ++i) { t3.append(1671000000 + i * 60, ZoneOffset::of(i < 5 ? 0 : i < 12 ? 1 : 2)); }
+        std::vector<uint8_t> b;
+        t3.serialize(b);
+        ASSERT_EQ(3U, b[12]);
+        ASSERT_FALSE(TimestampSeries::deserialize(b.data(), b.size()).empty());
+        b[40] = 3; // The third run (index 12) before the second (index 5)
+        EXPECT_TRUE(TimestampSeries::deserialize(b.data(), b.size()).empty());
+    }
+    // Counts that wrap the length check (blocks * 24 == 2^64 * 6)
+    {
+        std::vector<uint8_t> b(4 + 8 + 4 + 12 + 8);
+        b[0] = 1;                    // blockSize 1
+        b[4 + 7] = 0x40;             // size 2^62
+        b[12] = 1;                   // One run at index 0
+        EXPECT_TRUE(TimestampSeries::deserialize(b.data(), b.size()).empty());
+        b[28 + 7] = 0x40;            // bits 2^62
+        EXPECT_TRUE(TimestampSeries::deserialize(b.data(), b.size()).empty());
+        b[4 + 7] = 0; b[4] = 1;      // size 1, and the words overflow
+        EXPECT_TRUE(TimestampSeries::deserialize(b.data(), b.size()).empty());
+    }
+
+    ts.clear();
+    EXPECT_TRUE(ts.empty());
+    EXPECT_EQ(0U, ts.bitsOfSamples());
+}
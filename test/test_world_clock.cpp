@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <gob_world_clock.hpp>
+#include <gob_rfc3339.hpp>
+#include "helper.hpp"
+#include <vector>
+#include <string>
+
+using namespace goblib::datetime;
+
+namespace
+{
+const char* locations[] =
+{
+    "Asia/Tokyo", "America/Los_Angeles", "America/New_York", "America/St_Johns", "America/Sao_Paulo",
+    "America/Santiago", "Europe/London", "Europe/Dublin", "Asia/Kolkata", "Asia/Kathmandu",
+    "Australia/Lord_Howe", "Pacific/Chatham", "Pacific/Kiritimati", "Pacific/Pago_Pago",
+};
+//
+}
+
+TEST(WorldClock, Basic)
+{
+    WorldClock wc;
+    EXPECT_TRUE(wc.empty());
+    EXPECT_TRUE(wc.add(ZoneRules::ofLocation("Asia/Tokyo")));
+    EXPECT_TRUE(wc.add(ZoneRules::ofLocation("America/New_York")));
+    EXPECT_TRUE(wc.add(ZoneRules()));
+    EXPECT_FALSE(wc.add(ZoneRules::parse("???")));
+    ASSERT_EQ(3U, wc.size());
+    EXPECT_EQ(ZoneRules::ofLocation("America/New_York").standardOffset(), wc.rules(1).standardOffset());
+
+    const time_t epoch = OffsetDateTime::parse("2023-03-12T06:59:59Z").toEpochSecond();
+    OffsetDateTime odts[3];
+    wc.convert(odts, epoch);
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T15:59:59+09:00"), odts[0]);
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T01:59:59-05:00"), odts[1]);
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T06:59:59Z"), odts[2]);
+    // Across the transition
+    wc.convert(odts, epoch + 1);
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T03:00:00-04:00"), odts[1]);
+    // Back again
+    wc.convert(odts, epoch);
+    EXPECT_EQ(OffsetDateTime::parse("2023-03-12T01:59:59-05:00"), odts[1]);
+
+    char strs[3][RFC3339_BUFFER_SIZE];
+    EXPECT_EQ(3U, wc.format(strs[0], RFC3339_BUFFER_SIZE, epoch + 1));
+    EXPECT_STREQ("2023-03-12T16:00:00+09:00", strs[0]);
+    EXPECT_STREQ("2023-03-12T03:00:00-04:00", strs[1]);
+    EXPECT_STREQ("2023-03-12T07:00:00Z", strs[2]);
+
+    // Short stride
+    char shorts[3][21];
+    EXPECT_EQ(1U, wc.format(shorts[0], sizeof(shorts[0]), epoch));
+    EXPECT_STREQ("", shorts[0]);
+    EXPECT_STREQ("", shorts[1]);
+    EXPECT_STREQ("2023-03-12T06:59:59Z", shorts[2]);
+    EXPECT_EQ(0U, wc.format(nullptr, RFC3339_BUFFER_SIZE, epoch));
+
+    // Seconds in the offset are not formatted
+    {
+        WorldClock w2;
+        w2.add(ZoneRules(ZoneOffset(3600 + 30)));
+        char buf[RFC3339_BUFFER_SIZE] = "x";
+        EXPECT_EQ(0U, w2.format(buf, sizeof(buf), epoch));
+        EXPECT_STREQ("", buf);
+    }
+
+    wc.clear();
+    EXPECT_TRUE(wc.empty());
+    wc.convert(odts, epoch); // Nothing
+}
+
+TEST(WorldClock, Convert)
+{
+    std::vector<ZoneRules> zones;
+    for(auto& loc : locations) { zones.push_back(ZoneRules::ofLocation(loc)); }
+    WorldClock wc(zones);
+    ASSERT_EQ(zones.size(), wc.size());
+
+    // Sorted around the new year and the transitions, then shuffled
+    std::vector<time_t> epochs;
+    for(time_t t = OffsetDateTime::parse("2022-12-30T00:00:00Z").toEpochSecond(); t < OffsetDateTime::parse("2024-01-02T00:00:00Z").toEpochSecond(); t += 1799) { epochs.push_back(t); }
+    for(time_t t = -86400 * 2; t < 86400 * 2; t += 3607) { epochs.push_back(t); }
+    const size_t sorted = epochs.size();
+    for(size_t i = 0; i < sorted; i += 7) { epochs.push_back(epochs[(i * 7919) % sorted]); }
+
+    const size_t zn = wc.size();
+    std::vector<OffsetDateTime> out(epochs.size() * zn);
+    wc.convert(out.data(), epochs.data(), epochs.size());
+    std::vector<char> strs(epochs.size() * zn * RFC3339_BUFFER_SIZE);
+    EXPECT_EQ(epochs.size() * zn, wc.format(strs.data(), RFC3339_BUFFER_SIZE, epochs.data(), epochs.size()));
+
+    for(size_t j = 0; j < epochs.size(); ++j)
+    {
+        for(size_t i = 0; i < zn; ++i)
+        {
+            const auto zo = zones[i].offset(epochs[j]);
+            const OffsetDateTime expected(LocalDateTime::ofEpochSecond(epochs[j], zo), zo);
+            const auto& odt = out[j * zn + i];
+            ASSERT_EQ(expected, odt) << locations[i] << ' ' << epochs[j];
+            ASSERT_EQ(expected.offset(), odt.offset()) << locations[i] << ' ' << epochs[j];
+            char buf[RFC3339_BUFFER_SIZE];
+            formatRFC3339(buf, sizeof(buf), expected);
+            ASSERT_STREQ(buf, &strs[(j * zn + i) * RFC3339_BUFFER_SIZE]) << locations[i] << ' ' << epochs[j];
+        }
+    }
+}
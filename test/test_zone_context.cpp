@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <gob_zone_context.hpp>
+#include "helper.hpp"
+#include <thread>
+
+using namespace goblib::datetime;
+
+namespace
+{
+const char* locations[] =
+{
+    "Asia/Tokyo", "America/Los_Angeles", "America/St_Johns", "Europe/London", "Europe/Paris",
+    "Asia/Kathmandu", "Australia/Lord_Howe", "Pacific/Chatham",
+};
+const time_t epochs[] =
+{
+    86400, 33177600, 389561696, 1100264399, 1583656200, 1604210400, 1671000000, 2000000000,
+};
+//
+}
+
+TEST(ZoneContext, Basic)
+{
+    {
+        constexpr ZoneContext ctx;
+        EXPECT_TRUE(ctx.valid());
+        EXPECT_EQ(ZoneOffset::UTC, ctx.offset(1671000000));
+        EXPECT_EQ(LocalDateTime(2022, 12, 14, 6, 40, 0), ctx.toLocalDateTime(1671000000));
+    }
+    {
+        auto ctx = ZoneContext::ofLocation("America/Los_Angeles");
+        EXPECT_TRUE(ctx.valid());
+        EXPECT_EQ(ZoneOffset::of(-8), ctx.offset(1671000000));
+        auto odt = ctx.toOffsetDateTime(1671000000);
+        EXPECT_EQ(LocalDateTime(2022, 12, 13, 22, 40, 0), odt.toLocalDateTime());
+        EXPECT_EQ(ZoneOffset::of(-8), odt.offset());
+        EXPECT_EQ(1671000000, ctx.toEpochSecond(odt.toLocalDateTime()));
+        EXPECT_EQ(odt, ctx.toOffsetDateTime(odt.toLocalDateTime()));
+
+        // Gap is shifted later
+        auto gap = ctx.toOffsetDateTime(LocalDateTime(2020, 3, 8, 2, 30, 0));
+        EXPECT_EQ(LocalDateTime(2020, 3, 8, 3, 30, 0), gap.toLocalDateTime());
+        EXPECT_EQ(ZoneOffset::of(-7), gap.offset());
+    }
+    {
+        EXPECT_TRUE(ZoneContext::parse("JST-9").valid());
+        EXPECT_FALSE(ZoneContext::parse("").valid());
+        EXPECT_FALSE(ZoneContext::ofLocation("Nowhere/Nothing").valid());
+    }
+}
+
+TEST(ZoneContext, Current)
+{
+    EXPECT_EQ(nullptr, ZoneContext::current());
+    EXPECT_FALSE(ZoneContext::setCurrent(ZoneContext::ofLocation("Nowhere/Nothing")));
+    EXPECT_EQ(nullptr, ZoneContext::current());
+
+    EXPECT_TRUE(ZoneContext::setCurrent(ZoneContext::ofLocation("Asia/Tokyo")));
+    ASSERT_NE(nullptr, ZoneContext::current());
+    EXPECT_EQ(ZoneOffset::of(9), ZoneContext::current()->rules().standardOffset());
+    {
+        ScopedZoneContext scope(ZoneContext::ofLocation("Asia/Kolkata"));
+        EXPECT_EQ(ZoneOffset::of(5, 30), ZoneContext::current()->rules().standardOffset());
+        {
+            ScopedZoneContext scope2(ZoneContext::ofLocation("Europe/London"));
+            EXPECT_EQ(ZoneOffset::UTC, ZoneContext::current()->rules().standardOffset());
+        }
+        EXPECT_EQ(ZoneOffset::of(5, 30), ZoneContext::current()->rules().standardOffset());
+    }
+    EXPECT_EQ(ZoneOffset::of(9), ZoneContext::current()->rules().standardOffset());
+
+    ZoneContext::resetCurrent();
+    EXPECT_EQ(nullptr, ZoneContext::current());
+    {
+        ScopedZoneContext scope(ZoneContext::ofLocation("Asia/Kolkata"));
+        EXPECT_NE(nullptr, ZoneContext::current());
+    }
+    EXPECT_EQ(nullptr, ZoneContext::current());
+}
+
+// Same results as the TZ environment. (Except around epoch 0 with negative offsets, where mkgmtime fails)
+TEST(ZoneContext, Now)
+{
+    for(auto& loc : locations)
+    {
+        auto ctx = ZoneContext::ofLocation(loc);
+        ASSERT_TRUE(ctx.valid()) << loc;
+        for(auto& t : epochs)
+        {
+            injectMockClock(MockClock(t));
+
+            pushTimezone(loc);
+            auto ldt = LocalDateTime::now();
+            auto odt = OffsetDateTime::now();
+            auto ot = OffsetTime::now();
+            auto ld = LocalDate::now();
+            auto lt = LocalTime::now();
+            popTimezone();
+
+            // Explicit
+            EXPECT_EQ(ldt, LocalDateTime::now(ctx)) << loc << ':' << t;
+            EXPECT_EQ(odt.toLocalDateTime(), OffsetDateTime::now(ctx).toLocalDateTime()) << loc << ':' << t;
+            EXPECT_EQ(odt.offset(), OffsetDateTime::now(ctx).offset()) << loc << ':' << t;
+            EXPECT_EQ(ot.toLocalTime(), OffsetTime::now(ctx).toLocalTime()) << loc << ':' << t;
+            EXPECT_EQ(ot.offset(), OffsetTime::now(ctx).offset()) << loc << ':' << t;
+            EXPECT_EQ(ld, LocalDate::now(ctx)) << loc << ':' << t;
+            EXPECT_EQ(lt, LocalTime::now(ctx)) << loc << ':' << t;
+
+            // Current thread (TZ environment is not used)
+            {
+                ScopedZoneContext scope(ctx);
+                EXPECT_EQ(ldt, LocalDateTime::now()) << loc << ':' << t;
+                EXPECT_EQ(odt.toLocalDateTime(), OffsetDateTime::now().toLocalDateTime()) << loc << ':' << t;
+                EXPECT_EQ(odt.offset(), OffsetDateTime::now().offset()) << loc << ':' << t;
+                EXPECT_EQ(ot.toLocalTime(), OffsetTime::now().toLocalTime()) << loc << ':' << t;
+                EXPECT_EQ(ld, LocalDate::now()) << loc << ':' << t;
+                EXPECT_EQ(lt, LocalTime::now()) << loc << ':' << t;
+            }
+            resetMockClock();
+        }
+    }
+}
+
+TEST(ZoneContext, Threads)
+{
+    constexpr time_t t = 1671000000; // 2022-12-14T06:40:00Z
+    injectMockClock(MockClock(t));
+
+    struct Result { const char* location; LocalDateTime expected; int mismatch; };
+    Result results[] =
+    {
+        { "Asia/Tokyo",          LocalDateTime(2022, 12, 14, 15, 40, 0), 0 },
+        { "America/Los_Angeles", LocalDateTime(2022, 12, 13, 22, 40, 0), 0 },
+        { "Asia/Kathmandu",      LocalDateTime(2022, 12, 14, 12, 25, 0), 0 },
+        { "Pacific/Chatham",     LocalDateTime(2022, 12, 14, 20, 25, 0), 0 },
+    };
+    std::thread threads[4];
+    for(int i = 0; i < 4; ++i)
+    {
+        threads[i] = std::thread([&results, i]()
+        {
+            ScopedZoneContext scope(ZoneContext::ofLocation(results[i].location));
+            for(int k = 0; k < 10000; ++k)
+            {
+                if(LocalDateTime::now() != results[i].expected) { ++results[i].mismatch; }
+            }
+        });
+    }
+    for(auto& th : threads) { th.join(); }
+    for(auto& r : results) { EXPECT_EQ(0, r.mismatch) << r.location; }
+
+    // Not affected by other threads.
+    EXPECT_EQ(nullptr, ZoneContext::current());
+    resetMockClock();
+}
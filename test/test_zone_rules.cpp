@@ -0,0 +1,306 @@
+#include <gtest/gtest.h>
+#include <gob_zone_rules.hpp>
+#include "helper.hpp"
+
+using namespace goblib::datetime;
+
+namespace
+{
+const char* locations[] =
+{
+    "Asia/Tokyo", "America/Los_Angeles", "America/New_York", "America/St_Johns", "America/Sao_Paulo",
+    "America/Santiago", "America/Havana", "America/Scoresbysund", "Europe/London", "Europe/Paris", "Europe/Dublin",
+    "Europe/Chisinau", "Asia/Jerusalem", "Asia/Kolkata", "Asia/Kathmandu", "Australia/Sydney",
+    "Australia/Lord_Howe", "Pacific/Auckland", "Pacific/Chatham", "Africa/Cairo", "Asia/Gaza",
+};
+//
+}
+
+TEST(ZoneRules, Parse)
+{
+    {
+        auto zr = ZoneRules::parse("JST-9");
+        EXPECT_TRUE(zr.valid());
+        EXPECT_TRUE(zr.isFixedOffset());
+        EXPECT_EQ(ZoneOffset::of(9), zr.standardOffset());
+        EXPECT_EQ(ZoneOffset::of(9), zr.daylightOffset());
+    }
+    {
+        auto zr = ZoneRules::parse("PST8PDT,M3.2.0,M11.1.0");
+        EXPECT_TRUE(zr.valid());
+        EXPECT_FALSE(zr.isFixedOffset());
+        EXPECT_EQ(ZoneOffset::of(-8), zr.standardOffset());
+        EXPECT_EQ(ZoneOffset::of(-7), zr.daylightOffset());
+        EXPECT_EQ(ZoneRules::Rule::Type::MonthWeekDay, zr.startRule().type);
+        EXPECT_EQ(3, zr.startRule().month);
+        EXPECT_EQ(2, zr.startRule().week);
+        EXPECT_EQ(0, zr.startRule().dayOfWeek);
+        EXPECT_EQ(7200, zr.startRule().time);
+        EXPECT_EQ(11, zr.endRule().month);
+        EXPECT_EQ(1, zr.endRule().week);
+    }
+    {
+        auto zr = ZoneRules::parse("<+1030>-10:30<+11>-11,M10.1.0,M4.1.0");
+        EXPECT_TRUE(zr.valid());
+        EXPECT_EQ(ZoneOffset::of(10, 30), zr.standardOffset());
+        EXPECT_EQ(ZoneOffset::of(11), zr.daylightOffset());
+    }
+    {
+        auto zr = ZoneRules::parse("<-03>3<-02>,M3.5.0/-2,M10.5.0/-1");
+        EXPECT_TRUE(zr.valid());
+        EXPECT_EQ(-7200, zr.startRule().time);
+        EXPECT_EQ(-3600, zr.endRule().time);
+    }
+    {
+        auto zr = ZoneRules::parse("<+0330>-3:30<+0430>,J79/24,J263/24");
+        EXPECT_TRUE(zr.valid());
+        EXPECT_EQ(ZoneRules::Rule::Type::Julian1, zr.startRule().type);
+        EXPECT_EQ(79, zr.startRule().day);
+        EXPECT_EQ(24 * 3600, zr.startRule().time);
+    }
+    // Default rule
+    {
+        auto zr = ZoneRules::parse("EST5EDT");
+        EXPECT_TRUE(zr.valid());
+        EXPECT_FALSE(zr.isFixedOffset());
+        EXPECT_EQ(3, zr.startRule().month);
+        EXPECT_EQ(11, zr.endRule().month);
+    }
+    // Invalid
+    {
+        const char* tbl[] = { "", "J", "JST", "JST-", "JST-9J", "PST8PDT,M3.2.0", "PST8PDT,M13.2.0,M11.1.0", "PST8PDT,M3.6.0,M11.1.0", "JST-99", "<+09-9" };
+        for(auto& e : tbl) { EXPECT_FALSE(ZoneRules::parse(e).valid()) << e; }
+        EXPECT_FALSE(ZoneRules::parse(nullptr).valid());
+        EXPECT_FALSE(ZoneRules::ofLocation("Asia/Nowhere").valid());
+    }
+}
+
+TEST(ZoneRules, Offset)
+{
+    // Compare with localtime_r
+    for(auto& loc : locations)
+    {
+        auto zr = ZoneRules::ofLocation(loc);
+        ASSERT_TRUE(zr.valid()) << loc;
+        pushTimezone(loc);
+        for(time_t t = 0; t < 2000000000; t += 3600 * 7 + 1234)
+        {
+            struct tm tmp{};
+            toLocaltime(&t, &tmp);
+            auto off = LocalDateTime(tmp).toEpochSecond(ZoneOffset::UTC) - t;
+            EXPECT_EQ(off, zr.offset(t).totalSeconds()) << loc << ":" << t;
+            EXPECT_EQ(tmp.tm_isdst > 0, zr.isDaylightSavings(t)) << loc << ":" << t;
+        }
+        popTimezone();
+    }
+}
+
+TEST(ZoneRules, Transition)
+{
+    auto zr = ZoneRules::ofLocation("America/Los_Angeles");
+    EXPECT_EQ(LocalDateTime(2020, 3, 8, 2, 0, 0).toEpochSecond(ZoneOffset::of(-8)), zr.daylightStart(2020));
+    EXPECT_EQ(LocalDateTime(2020, 11, 1, 2, 0, 0).toEpochSecond(ZoneOffset::of(-7)), zr.daylightEnd(2020));
+
+    ZoneOffset zo[2];
+    // Gap
+    EXPECT_EQ(0, zr.validOffsets(LocalDateTime(2020, 3, 8, 2, 30, 0), zo));
+    EXPECT_EQ(LocalDateTime(2020, 3, 8, 3, 30, 0).toEpochSecond(ZoneOffset::of(-7)), zr.toEpochSecond(LocalDateTime(2020, 3, 8, 2, 30, 0)));
+    // Overlap
+    EXPECT_EQ(2, zr.validOffsets(LocalDateTime(2020, 11, 1, 1, 30, 0), zo));
+    EXPECT_EQ(ZoneOffset::of(-7), zo[0]);
+    EXPECT_EQ(ZoneOffset::of(-8), zo[1]);
+    EXPECT_EQ(LocalDateTime(2020, 11, 1, 1, 30, 0).toEpochSecond(ZoneOffset::of(-7)), zr.toEpochSecond(LocalDateTime(2020, 11, 1, 1, 30, 0)));
+    // Normal
+    EXPECT_EQ(1, zr.validOffsets(LocalDateTime(2020, 7, 1, 0, 0, 0), zo));
+    EXPECT_EQ(ZoneOffset::of(-7), zo[0]);
+    EXPECT_EQ(1, zr.validOffsets(LocalDateTime(2020, 12, 1, 0, 0, 0), zo));
+    EXPECT_EQ(ZoneOffset::of(-8), zo[0]);
+
+    // Negative DST (Europe/Dublin : IST in summer is the standard time)
+    auto dublin = ZoneRules::ofLocation("Europe/Dublin");
+    EXPECT_EQ(0, dublin.validOffsets(LocalDateTime(2022, 3, 27, 1, 30, 0), zo));
+    EXPECT_EQ(2, dublin.validOffsets(LocalDateTime(2022, 10, 30, 1, 30, 0), zo));
+    EXPECT_EQ(ZoneOffset::of(1), zo[0]);
+    EXPECT_EQ(ZoneOffset::UTC, zo[1]);
+}
+
+TEST(ZoneRules, TransitionQuery)
+{
+    {
+        auto ny = ZoneRules::ofLocation("America/New_York");
+        ZoneOffsetTransition tr[2];
+        ASSERT_EQ(2U, ny.transitionsInYear(2023, tr));
+        EXPECT_EQ(OffsetDateTime::parse("2023-03-12T07:00:00Z").toEpochSecond(), tr[0].epochSecond());
+        EXPECT_EQ(ZoneOffset::of(-5), tr[0].offsetBefore());
+        EXPECT_EQ(ZoneOffset::of(-4), tr[0].offsetAfter());
+        EXPECT_TRUE(tr[0].isGap());
+        EXPECT_EQ(3600, tr[0].durationSeconds());
+        EXPECT_EQ(LocalDateTime(2023, 3, 12, 2, 0, 0), tr[0].dateTimeBefore());
+        EXPECT_EQ(LocalDateTime(2023, 3, 12, 3, 0, 0), tr[0].dateTimeAfter());
+        EXPECT_EQ(OffsetDateTime::parse("2023-11-05T06:00:00Z").toEpochSecond(), tr[1].epochSecond());
+        EXPECT_TRUE(tr[1].isOverlap());
+        EXPECT_EQ(LocalDateTime(2023, 11, 5, 2, 0, 0), tr[1].dateTimeBefore());
+        EXPECT_EQ(LocalDateTime(2023, 11, 5, 1, 0, 0), tr[1].dateTimeAfter());
+
+        EXPECT_EQ(tr[0], ny.nextTransition(OffsetDateTime::parse("2023-01-01T00:00:00Z").toEpochSecond()));
+        EXPECT_EQ(tr[1], ny.nextTransition(tr[0].epochSecond()));
+        EXPECT_EQ(tr[0], ny.nextTransition(tr[0].epochSecond() - 1));
+        EXPECT_EQ(tr[0], ny.previousTransition(tr[1].epochSecond()));
+        EXPECT_EQ(tr[1], ny.previousTransition(tr[1].epochSecond() + 1));
+        EXPECT_EQ(tr[1], ny.previousTransition(OffsetDateTime::parse("2024-01-01T00:00:00Z").toEpochSecond()));
+    }
+    // Southern hemisphere
+    {
+        auto sydney = ZoneRules::ofLocation("Australia/Sydney");
+        ZoneOffsetTransition tr[2];
+        ASSERT_EQ(2U, sydney.transitionsInYear(2023, tr));
+        EXPECT_EQ(LocalDateTime(2023, 4, 2, 3, 0, 0), tr[0].dateTimeBefore());
+        EXPECT_TRUE(tr[0].isOverlap());
+        EXPECT_EQ(LocalDateTime(2023, 10, 1, 2, 0, 0), tr[1].dateTimeBefore());
+        EXPECT_TRUE(tr[1].isGap());
+        EXPECT_EQ(tr[0], sydney.nextTransition(OffsetDateTime::parse("2023-01-01T00:00:00Z").toEpochSecond()));
+        EXPECT_EQ(tr[1], sydney.previousTransition(OffsetDateTime::parse("2023-12-31T00:00:00Z").toEpochSecond()));
+    }
+    // Fixed
+    {
+        auto tokyo = ZoneRules::ofLocation("Asia/Tokyo");
+        ZoneOffsetTransition tr[2];
+        EXPECT_EQ(0U, tokyo.transitionsInYear(2023, tr));
+        EXPECT_FALSE(tokyo.nextTransition(0).valid());
+        EXPECT_FALSE(tokyo.previousTransition(1700000000).valid());
+        EXPECT_FALSE(ZoneOffsetTransition().valid());
+    }
+
+    // Same as probing the offsets
+    for(auto& loc : locations)
+    {
+        auto zr = ZoneRules::ofLocation(loc);
+        time_t t = OffsetDateTime::parse("2019-12-01T00:00:00Z").toEpochSecond();
+        const time_t end = OffsetDateTime::parse("2025-01-01T00:00:00Z").toEpochSecond();
+        ZoneOffsetTransition prev{};
+        for(;;)
+        {
+            auto next = zr.nextTransition(t);
+            // Find the change by probing every 15 minutes
+            time_t probe = t;
+            auto zo = zr.offset(t);
+            while(probe < end && zr.offset(probe + 900) == zo) { probe += 900; }
+            if(probe >= end) { break; }
+            ASSERT_TRUE(next.valid()) << loc;
+            ASSERT_GT(next.epochSecond(), probe) << loc;
+            ASSERT_LE(next.epochSecond(), probe + 900) << loc;
+            ASSERT_EQ(zo, next.offsetBefore()) << loc;
+            ASSERT_EQ(zr.offset(next.epochSecond()), next.offsetAfter()) << loc;
+            ASSERT_EQ(zr.offset(next.epochSecond() - 1), next.offsetBefore()) << loc;
+            if(prev.valid()) { ASSERT_EQ(prev, zr.previousTransition(next.epochSecond())) << loc; }
+            prev = next;
+            t = next.epochSecond();
+        }
+    }
+}
+
+TEST(ZoneRules, Resolve)
+{
+    auto ny = ZoneRules::ofLocation("America/New_York");
+    // Normal
+    {
+        auto r = ny.resolve(LocalDateTime(2023, 7, 1, 12, 0, 0));
+        EXPECT_TRUE(r.valid());
+        EXPECT_EQ(ZoneResolution::Kind::Normal, r.kind());
+        EXPECT_FALSE(r.transition().valid());
+        EXPECT_EQ(OffsetDateTime::parse("2023-07-01T12:00:00-04:00"), r.toOffsetDateTime());
+        EXPECT_TRUE(ny.resolve(LocalDateTime(2023, 7, 1, 12, 0, 0), ResolvePolicy::Reject).valid());
+    }
+    // Gap
+    {
+        const LocalDateTime ldt(2023, 3, 12, 2, 30, 0);
+        auto r = ny.resolve(ldt);
+        EXPECT_TRUE(r.valid());
+        EXPECT_TRUE(r.isGap());
+        EXPECT_EQ(LocalDateTime(2023, 3, 12, 2, 0, 0), r.transition().dateTimeBefore());
+        EXPECT_EQ(OffsetDateTime::parse("2023-03-12T03:30:00-04:00"), r.toOffsetDateTime());
+        EXPECT_EQ(ny.toEpochSecond(ldt), r.epochSecond());
+        EXPECT_EQ(r.epochSecond(), ny.resolve(ldt, ResolvePolicy::Later).epochSecond());
+        EXPECT_EQ(OffsetDateTime::parse("2023-03-12T01:30:00-05:00"), ny.resolve(ldt, ResolvePolicy::Earlier).toOffsetDateTime());
+        EXPECT_EQ(OffsetDateTime::parse("2023-03-12T03:00:00-04:00"), ny.resolve(ldt, ResolvePolicy::ShiftForward).toOffsetDateTime());
+        EXPECT_FALSE(ny.resolve(ldt, ResolvePolicy::Reject).valid());
+        EXPECT_TRUE(ny.resolve(ldt, ResolvePolicy::Reject).isGap());
+        // Bounds of the gap
+        EXPECT_FALSE(ny.resolve(LocalDateTime(2023, 3, 12, 1, 59, 59)).isGap());
+        EXPECT_TRUE(ny.resolve(LocalDateTime(2023, 3, 12, 2, 0, 0)).isGap());
+        EXPECT_FALSE(ny.resolve(LocalDateTime(2023, 3, 12, 3, 0, 0)).isGap());
+    }
+    // Overlap
+    {
+        const LocalDateTime ldt(2023, 11, 5, 1, 30, 0);
+        auto r = ny.resolve(ldt);
+        EXPECT_TRUE(r.valid());
+        EXPECT_TRUE(r.isOverlap());
+        EXPECT_EQ(OffsetDateTime::parse("2023-11-05T01:30:00-04:00"), r.toOffsetDateTime());
+        EXPECT_EQ(r.epochSecond(), ny.resolve(ldt, ResolvePolicy::Earlier).epochSecond());
+        EXPECT_EQ(r.epochSecond(), ny.resolve(ldt, ResolvePolicy::ShiftForward).epochSecond());
+        EXPECT_EQ(OffsetDateTime::parse("2023-11-05T01:30:00-05:00"), ny.resolve(ldt, ResolvePolicy::Later).toOffsetDateTime());
+        EXPECT_FALSE(ny.resolve(ldt, ResolvePolicy::Reject).valid());
+        EXPECT_FALSE(ny.resolve(LocalDateTime(2023, 11, 5, 0, 59, 59)).isOverlap());
+        EXPECT_TRUE(ny.resolve(LocalDateTime(2023, 11, 5, 1, 0, 0)).isOverlap());
+        EXPECT_FALSE(ny.resolve(LocalDateTime(2023, 11, 5, 2, 0, 0)).isOverlap());
+    }
+    // Negative DST (Winter time is the daylight saving of the rule)
+    {
+        auto dublin = ZoneRules::ofLocation("Europe/Dublin");
+        EXPECT_TRUE(dublin.resolve(LocalDateTime(2023, 3, 26, 1, 30, 0)).isGap());
+        EXPECT_EQ(OffsetDateTime::parse("2023-03-26T02:30:00+01:00"), dublin.resolve(LocalDateTime(2023, 3, 26, 1, 30, 0)).toOffsetDateTime());
+        EXPECT_TRUE(dublin.resolve(LocalDateTime(2023, 10, 29, 1, 30, 0)).isOverlap());
+        EXPECT_EQ(OffsetDateTime::parse("2023-10-29T01:30:00+01:00"), dublin.resolve(LocalDateTime(2023, 10, 29, 1, 30, 0)).toOffsetDateTime());
+    }
+    // Fixed
+    {
+        auto tokyo = ZoneRules::ofLocation("Asia/Tokyo");
+        auto r = tokyo.resolve(LocalDateTime(2023, 3, 12, 2, 30, 0), ResolvePolicy::Reject);
+        EXPECT_TRUE(r.valid());
+        EXPECT_EQ(OffsetDateTime::parse("2023-03-12T02:30:00+09:00"), r.toOffsetDateTime());
+    }
+
+    // Same as probing the offsets
+    for(auto& loc : locations)
+    {
+        auto zr = ZoneRules::ofLocation(loc);
+        ZoneOffsetTransition tr[2];
+        ZoneOffset cand[2] = { zr.offset(0), zr.offset(0) };
+        if(zr.transitionsInYear(2023, tr)) { cand[0] = tr[0].offsetBefore(); cand[1] = tr[0].offsetAfter(); }
+        const time_t end = LocalDateTime(2024, 1, 15, 0, 0, 0).toEpochSecond(ZoneOffset::UTC);
+        for(time_t local = LocalDateTime(2022, 12, 15, 0, 0, 0).toEpochSecond(ZoneOffset::UTC); local < end; local += 900)
+        {
+            auto ldt = LocalDateTime::ofEpochSecond(local, ZoneOffset::UTC);
+            int n{};
+            ZoneOffset valid[2];
+            for(int i = 0; i < (cand[0] == cand[1] ? 1 : 2); ++i)
+            {
+                if(zr.offset(local - cand[i].totalSeconds()) == cand[i]) { valid[n++] = cand[i]; }
+            }
+            auto r = zr.resolve(ldt);
+            ASSERT_TRUE(r.valid()) << loc << ' ' << ldt.toString();
+            if(n == 0)
+            {
+                ASSERT_TRUE(r.isGap()) << loc << ' ' << ldt.toString();
+                ASSERT_FALSE(zr.resolve(ldt, ResolvePolicy::Reject).valid()) << loc;
+                ASSERT_EQ(r.transition().epochSecond(), zr.resolve(ldt, ResolvePolicy::ShiftForward).epochSecond()) << loc;
+            }
+            else if(n == 1)
+            {
+                ASSERT_EQ(ZoneResolution::Kind::Normal, r.kind()) << loc << ' ' << ldt.toString();
+                ASSERT_EQ(valid[0], r.offset()) << loc << ' ' << ldt.toString();
+                ASSERT_EQ(local - valid[0].totalSeconds(), r.epochSecond()) << loc;
+            }
+            else
+            {
+                ASSERT_TRUE(r.isOverlap()) << loc << ' ' << ldt.toString();
+                const ZoneOffset& greater = valid[0] > valid[1] ? valid[0] : valid[1];
+                const ZoneOffset& lesser = valid[0] > valid[1] ? valid[1] : valid[0];
+                ASSERT_EQ(local - greater.totalSeconds(), r.epochSecond()) << loc;
+                ASSERT_EQ(local - lesser.totalSeconds(), zr.resolve(ldt, ResolvePolicy::Later).epochSecond()) << loc;
+            }
+            ASSERT_EQ(zr.offset(r.epochSecond()), r.offset()) << loc << ' ' << ldt.toString();
+        }
+    }
+}
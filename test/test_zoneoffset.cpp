@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <gob_datetime.hpp>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
 #include "helper.hpp"
 
 using namespace goblib::datetime;
@@ -197,3 +200,71 @@ TEST(ZoneOffset, Compare)
         EXPECT_GE(e, zo_b0) << e.toString().c_str() << " :cmp: " << zo_b0.toString().c_str();
     }
 }
+
+TEST(ZoneOffset, Text)
+{
+    // All quarter-hour offsets
+    for(int32_t sec = -18 * 3600; sec <= 18 * 3600; sec += 900)
+    {
+        ZoneOffset zo(sec);
+        int a = std::abs(sec);
+        char expected[16];
+        if(sec) { snprintf(expected, sizeof(expected), "%c%02d:%02d", sec < 0 ? '-' : '+', a / 3600, a / 60 % 60); }
+        else    { snprintf(expected, sizeof(expected), "Z"); }
+
+        EXPECT_STREQ(expected, zo.toString().c_str()) << sec;
+        char buf[16];
+        EXPECT_EQ(strlen(expected), zo.toChars(buf, sizeof(buf))) << sec;
+        EXPECT_STREQ(expected, buf) << sec;
+        EXPECT_EQ(zo, ZoneOffset::of(expected)) << expected;
+    }
+    // toChars
+    {
+        char buf[16];
+        EXPECT_EQ(0U, ZoneOffset(32400).toChars(buf, 6));
+        EXPECT_EQ(6U, ZoneOffset(32400).toChars(buf, 7));
+        EXPECT_EQ(0U, ZoneOffset(0).toChars(buf, 1));
+        EXPECT_EQ(1U, ZoneOffset(0).toChars(buf, 2));
+        EXPECT_EQ(0U, ZoneOffset(-3723).toChars(buf, 9));
+        EXPECT_EQ(9U, ZoneOffset(-3723).toChars(buf, 10));
+        EXPECT_STREQ("-01:02:03", buf);
+        EXPECT_EQ(0U, ZoneOffset(0).toChars(nullptr, 16));
+        // Invalid offset is output too
+        EXPECT_EQ(12U, ZoneOffset(0xBADBEAF).toChars(buf, sizeof(buf)));
+        EXPECT_STREQ("+54426:38:39", buf);
+    }
+    // of
+    {
+        struct { const char* str; int32_t sec; } tbl[] =
+        {
+            { "+09", 9 * 3600 },
+            { "-05", -5 * 3600 },
+            { "+0930", 9 * 3600 + 30 * 60 },
+            { "-0345", -(3 * 3600 + 45 * 60) },
+            { "+05:45", 5 * 3600 + 45 * 60 },
+            { "-00:30", -30 * 60 },
+            { "+00:00", 0 },
+            { "-00", 0 },
+            { "+18:00", 18 * 3600 },
+            { "-18:00:00", -18 * 3600 },
+            { "+00:00:01", 1 },
+        };
+        for(auto& e : tbl)
+        {
+            auto zo = ZoneOffset::of(e.str);
+            EXPECT_TRUE(zo.valid()) << e.str;
+            EXPECT_EQ(e.sec, zo.totalSeconds()) << e.str;
+        }
+        const char* ng[] =
+        {
+            "", "Z0", "z", "+", "+1", "+9:00", "+123", "+12345", "+0930:00",
+            "+09:0", "+09:", "+09:00:", "+09:00:0", "+09:00:00Z",
+            "+19:00", "+18:00:01", "-18:15", "+12:60", "+12:00:60", "09:00", " +09:00",
+        };
+        for(auto& e : ng)
+        {
+            EXPECT_FALSE(ZoneOffset::of(e).valid()) << e;
+        }
+        EXPECT_FALSE(ZoneOffset::of(nullptr).valid());
+    }
+}